@@ -8,13 +8,97 @@
  
 /* Inclusion */
 #include "DIO.h"
-#include <assert.h>
-#include <stdio.h>
+#include "DioShadow.h"	/* Shadowed access to the output data registers */
+#if(DioDevErrorDetect == STD_ON)
+#include "Det.h"			/* Development errors reporting */
+#endif /* DioDevErrorDetect check */
 
 /* Private Variables */
 extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
 
 #define DIO_PortsAddresses HW_PortsAddresses
+
+/* Channels lookup table */
+#define DIO_NO_OF_CHANNEL_IDS	(HW_NO_OF_PORTS << 4)	/*!< Channel IDs 0x00 to 0x5F, the pin nibble spans 16 IDs per port */
+
+/* Data address of a channel: the bit-band alias of its GPIODATA bit or the GPIODATA address masked to it,
+   either way a word read returns only the pin level and a write of 0xFF (0x00) sets (clears) only the pin */
+#if((DioBitBandAccess == STD_ON) && (DioShadowRegisters == STD_ON))
+#error "DioBitBandAccess needs DioShadowRegisters off, the shadow writes the channels through the masked GPIODATA address"
+#endif /* DioBitBandAccess and DioShadowRegisters check */
+#if(DioBitBandAccess == STD_ON)
+#define DIO_CHANNEL_ADDRESS(PORT_BASE, PIN)	HW_BITBAND_ALIAS((PORT_BASE) + HW_GPIODATA_OFFSET + 0x3FC, PIN)
+#else
+#define DIO_CHANNEL_ADDRESS(PORT_BASE, PIN)	((PORT_BASE) + HW_GPIODATA_OFFSET + ((1 << (PIN)) << 2))
+#endif /* DioBitBandAccess check */
+
+/* Entry of an existing channel: data address, pin bit and port */
+#define DIO_CHANNEL(PORT_BASE, PORT_ID, PIN)	\
+	{(HW_AddressBusSizeType)DIO_CHANNEL_ADDRESS(PORT_BASE, PIN), (uint8)(1 << (PIN)), (uint8)(PORT_ID)}
+
+/* Entry of a channel ID which doesn't exist, a zero pin bit is the sentinel */
+#define DIO_NO_CHANNEL	{0, 0, 0}
+
+/* Entries of the IDs 0x08 to 0x0F of a port, which don't exist */
+#define DIO_NO_CHANNELS_8	\
+	DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNEL,	\
+	DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNEL
+
+/* Entries of the 8 pins of a port */
+#define DIO_PORT_CHANNELS_8(PORT_BASE, PORT_ID)	\
+	DIO_CHANNEL(PORT_BASE, PORT_ID, 0), DIO_CHANNEL(PORT_BASE, PORT_ID, 1),	\
+	DIO_CHANNEL(PORT_BASE, PORT_ID, 2), DIO_CHANNEL(PORT_BASE, PORT_ID, 3),	\
+	DIO_CHANNEL(PORT_BASE, PORT_ID, 4), DIO_CHANNEL(PORT_BASE, PORT_ID, 5),	\
+	DIO_CHANNEL(PORT_BASE, PORT_ID, 6), DIO_CHANNEL(PORT_BASE, PORT_ID, 7)
+
+/* Defined data types */
+typedef struct{
+	HW_AddressBusSizeType	Dio_Address;	/*!< Data address of the pin, see DIO_CHANNEL_ADDRESS */
+	uint8					Dio_Mask;		/*!< Bit of the pin in its port, 0 if the channel doesn't exist */
+	uint8					Dio_Port;		/*!< Port of the channel */
+}Dio_ChannelEntryType;	/*!< Precomputed access data of a channel */
+
+static const Dio_ChannelEntryType Dio_ChannelTable[DIO_NO_OF_CHANNEL_IDS] = {
+	DIO_PORT_CHANNELS_8(HW_GPIOPORTA_BASE, DIO_PORTA), DIO_NO_CHANNELS_8,
+	DIO_PORT_CHANNELS_8(HW_GPIOPORTB_BASE, DIO_PORTB), DIO_NO_CHANNELS_8,
+	DIO_PORT_CHANNELS_8(HW_GPIOPORTC_BASE, DIO_PORTC), DIO_NO_CHANNELS_8,
+	DIO_PORT_CHANNELS_8(HW_GPIOPORTD_BASE, DIO_PORTD), DIO_NO_CHANNELS_8,
+	/* PORT E has pins 0 to 5 only */
+	DIO_CHANNEL(HW_GPIOPORTE_BASE, DIO_PORTE, 0), DIO_CHANNEL(HW_GPIOPORTE_BASE, DIO_PORTE, 1),
+	DIO_CHANNEL(HW_GPIOPORTE_BASE, DIO_PORTE, 2), DIO_CHANNEL(HW_GPIOPORTE_BASE, DIO_PORTE, 3),
+	DIO_CHANNEL(HW_GPIOPORTE_BASE, DIO_PORTE, 4), DIO_CHANNEL(HW_GPIOPORTE_BASE, DIO_PORTE, 5),
+	DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNELS_8,
+	/* PORT F has pins 0 to 4 only */
+	DIO_CHANNEL(HW_GPIOPORTF_BASE, DIO_PORTF, 0), DIO_CHANNEL(HW_GPIOPORTF_BASE, DIO_PORTF, 1),
+	DIO_CHANNEL(HW_GPIOPORTF_BASE, DIO_PORTF, 2), DIO_CHANNEL(HW_GPIOPORTF_BASE, DIO_PORTF, 3),
+	DIO_CHANNEL(HW_GPIOPORTF_BASE, DIO_PORTF, 4),
+	DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNEL, DIO_NO_CHANNELS_8
+};	/*!< Access data of every channel ID, indexed by Dio_ChannelType */
+
+#if(DioReadAllPortsApi == STD_ON)
+/* Ports image bits */
+#define DIO_NO_IMAGE_BIT	63	/*!< Bit of the IDs which don't exist, above the ports so it is always cleared */
+
+/* Image bits of the 8 pins of a port followed by the IDs 0x08 to 0x0F of the port */
+#define DIO_PORT_IMAGE_BITS_16(PORT_ID)	\
+	((PORT_ID) << 3) + 0, ((PORT_ID) << 3) + 1, ((PORT_ID) << 3) + 2, ((PORT_ID) << 3) + 3,	\
+	((PORT_ID) << 3) + 4, ((PORT_ID) << 3) + 5, ((PORT_ID) << 3) + 6, ((PORT_ID) << 3) + 7,	\
+	DIO_NO_IMAGE_BIT, DIO_NO_IMAGE_BIT, DIO_NO_IMAGE_BIT, DIO_NO_IMAGE_BIT,					\
+	DIO_NO_IMAGE_BIT, DIO_NO_IMAGE_BIT, DIO_NO_IMAGE_BIT, DIO_NO_IMAGE_BIT
+
+static const uint8 Dio_ImageBitTable[DIO_NO_OF_CHANNEL_IDS] = {
+	DIO_PORT_IMAGE_BITS_16(DIO_PORTA), DIO_PORT_IMAGE_BITS_16(DIO_PORTB),
+	DIO_PORT_IMAGE_BITS_16(DIO_PORTC), DIO_PORT_IMAGE_BITS_16(DIO_PORTD),
+	DIO_PORT_IMAGE_BITS_16(DIO_PORTE), DIO_PORT_IMAGE_BITS_16(DIO_PORTF)
+};	/*!< Bit of every channel ID in Dio_PortsImageType, indexed by Dio_ChannelType */
+
+#if(DioSnapshotSkewMeasure == STD_ON)
+static uint32 Dio_SnapshotSkew = 0;	/*!< Cycles between the first and the last port reads of the last Dio_ReadAllPorts(),
+									 for the debugger, accounting builds record it as the "Dio_ReadAllPorts skew" sample */
+#endif /* DioSnapshotSkewMeasure check */
+#endif /* DioReadAllPortsApi check */
+
+#if(DioDevErrorDetect == STD_ON)
 /* Private Functions Proto Types */
 /**
  *	\brief		To check the passed ChannelId.
@@ -40,10 +124,21 @@ static Std_ReturnType DIO_PortIdCheck(Dio_PortType PortId);
  */
 static Std_ReturnType DIO_ChannelOffsetCheck(uint8 ChannelOffset);
 
+#if(DioChannelListApi == STD_ON)
+/**
+ *	\brief		To check the channels of a list.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		Std_ReturnType:	-	E_OK: All the channels exist.
+ *								-	E_NOT_OK:  A channel doesn't exist.
+ */
+static Std_ReturnType DIO_ChannelListCheck(const Dio_ChannelType* ChannelIdsPtr, uint8 NoOfChannels);
+#endif /* DioChannelListApi check */
+
 
 
 /* Functions Declaration */
-/* Public Functions Declaration */
+/* Private Functions Declaration */
 /**
  *	\brief		To check the passed ChannelId.
  *	\param[in] 	ChannelId: ID of DIO channel.
@@ -56,23 +151,9 @@ static Std_ReturnType DIO_ChannelIdCheck(Dio_ChannelType ChannelId)
 	Std_ReturnType DIO_RetData = E_OK; 
 	
 	/* Function Logic */
-	if(ChannelId >= DIO_CHANNEL_A0 && ChannelId <= DIO_CHANNEL_A7){
-		DIO_RetData = E_OK; /* PORT A Channel */
-	}
-	else if(ChannelId >= DIO_CHANNEL_B0 && ChannelId <= DIO_CHANNEL_B7){
-		DIO_RetData = E_OK; /* PORT B Channel */
-	}
-	else if(ChannelId >= DIO_CHANNEL_C0 && ChannelId <= DIO_CHANNEL_C7){
-		DIO_RetData = E_OK; /* PORT C Channel */
-	}
-	else if(ChannelId >= DIO_CHANNEL_D0 && ChannelId <= DIO_CHANNEL_D7){
-		DIO_RetData = E_OK; /* PORT D Channel */
-	}
-	else if(ChannelId >= DIO_CHANNEL_E0 && ChannelId <= DIO_CHANNEL_E5){
-		DIO_RetData = E_OK; /* PORT E Channel */
-	}
-	else if(ChannelId >= DIO_CHANNEL_F0 && ChannelId <= DIO_CHANNEL_F4){
-		DIO_RetData = E_OK; /* PORT F Channel */
+	/* The channels table holds the sentinel for the IDs which don't exist */
+	if((ChannelId < DIO_NO_OF_CHANNEL_IDS) && (0 != Dio_ChannelTable[ChannelId].Dio_Mask)){
+		DIO_RetData = E_OK;
 	}
 	else{
 		DIO_RetData = E_NOT_OK; /* Channel doesn't exist */	
@@ -125,7 +206,7 @@ static Std_ReturnType DIO_ChannelOffsetCheck(uint8 ChannelOffset)
 	Std_ReturnType DIO_RetData = E_OK; 
 	
 	/* Function Logic */
-	if(ChannelOffset >= 0 && ChannelOffset <= 7){
+	if(ChannelOffset <= 7){
 		DIO_RetData = E_OK;
 	}
 	else{
@@ -140,6 +221,39 @@ static Std_ReturnType DIO_ChannelOffsetCheck(uint8 ChannelOffset)
 	return DIO_RetData;
 }
 
+#if(DioChannelListApi == STD_ON)
+/**
+ *	\brief		To check the channels of a list.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		Std_ReturnType:	-	E_OK: All the channels exist.
+ *								-	E_NOT_OK:  A channel doesn't exist.
+ */
+static Std_ReturnType DIO_ChannelListCheck(const Dio_ChannelType* ChannelIdsPtr, uint8 NoOfChannels)
+{
+	/* Return data definition */
+	Std_ReturnType DIO_RetData = E_OK; 
+	uint8 DIO_Index;
+	
+	/* Function Logic */
+	for(DIO_Index = 0; DIO_Index < NoOfChannels; DIO_Index++)
+	{
+		if(E_OK != DIO_ChannelIdCheck(ChannelIdsPtr[DIO_Index]))
+		{
+			DIO_RetData = E_NOT_OK;
+		}
+		else
+		{
+			/* Channel exists */
+		}
+	}
+	
+	/* Return Data */
+	return DIO_RetData;
+}
+#endif /* DioChannelListApi check */
+#endif /* DioDevErrorDetect check */
+
 
 
 /* Public Functions Declaration */
@@ -154,24 +268,35 @@ static Std_ReturnType DIO_ChannelOffsetCheck(uint8 ChannelOffset)
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
 	/* Needed Variables */
-	Dio_PortType 	DIO_Port 	= (Dio_PortType)0xFF;	/* Initialization Data */
-	uint8			DIO_Pin		= (uint8)0xFF;			/* Initialization Data */
-	uint8			DIO_RegOffset = (uint8)0;			/* Initialization Data */
+	const Dio_ChannelEntryType* DIO_ChannelPtr;
 	Dio_LevelType	DIO_ReturnData = STD_LOW;			/* Initialization Data */
-	/* Parameters check */
-	assert(E_OK == DIO_ChannelIdCheck(ChannelId));
 	
-	/* Read the state of the channel */
-	/* Tiva C supports bit addressing so we need to calculate the address 
-	   to be accessed by adding 4*2^b as b is the bit number.
-	   ChannelId has 2 bytes: Higher from 0 to 5 identifies the port
-							  Lower from 0 to 7 identifies bit number */
-	
-	DIO_Port = (Dio_PortType)((ChannelId & 0xF0)>>4);
-	DIO_Pin = (uint8)(ChannelId & 0x0F);
-	DIO_RegOffset = (uint8)(1 << DIO_Pin);
-	
-	DIO_ReturnData = HW_R_8RIG(DIO_PortsAddresses[DIO_Port] + (DIO_RegOffset<<2)) ? STD_HIGH: STD_LOW;
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_ChannelIdCheck(ChannelId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* Read the state of the channel */
+		/* Tiva C supports bit addressing, the table holds the GPIODATA address
+		   masked to the pin (or its bit-band alias) so only the pin bit is read */
+		DIO_ChannelPtr = &Dio_ChannelTable[ChannelId];
+		
+#if(DioShadowRegisters == STD_ON)
+		if(0 != (DIO_SHADOW_KNOWN_OUTPUTS(DIO_ChannelPtr->Dio_Port) & DIO_ChannelPtr->Dio_Mask))
+		{
+			/* Push-pull output, its level is the last written one */
+			DIO_ReturnData = (Dio_Shadow[DIO_ChannelPtr->Dio_Port].Dio_Data & DIO_ChannelPtr->Dio_Mask) ? STD_HIGH: STD_LOW;
+		}
+		else
+#endif /* DioShadowRegisters check */
+		{
+			DIO_ReturnData = HW_R_8RIG(DIO_ChannelPtr->Dio_Address) ? STD_HIGH: STD_LOW;
+		}
+	}
 	return DIO_ReturnData;
 }
 
@@ -184,25 +309,29 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
 	/* Needed Variables */
-	Dio_PortType 	DIO_Port 	= (Dio_PortType)0xFF;	/* Initialization Data */
-	uint8			DIO_Pin		= (uint8)0xFF;			/* Initialization Data */
-	uint8			DIO_RegOffset = (uint8)0;
+	const Dio_ChannelEntryType* DIO_ChannelPtr;
+	uint8			DIO_Data = (STD_LOW == Level) ? 0x00: 0xFF;	/* Only the pin bit is written */
 
 	/* Parameters check */
-	assert(E_OK == DIO_ChannelIdCheck(ChannelId));
-	assert(Level == STD_HIGH || Level == STD_LOW);
-	
-	/* Write the state of the channel */
-	/* Tiva C supports bit addressing so we need to calculate the address 
-	   to be accessed by adding 4*2^b as b is the bit number.
-	   ChannelId has 2 bytes: Higher from 0 to 5 identifies the port
-							  Lower from 0 to 7 identifies bit number */
-	
-	DIO_Port = (Dio_PortType)((ChannelId & 0xF0)>>4);
-	DIO_Pin = (uint8)(ChannelId & 0x0F);
-	DIO_RegOffset = (uint8)(1<<DIO_Pin);
-	
-	HW_W_8RIG(DIO_PortsAddresses[DIO_Port] + (DIO_RegOffset<<2), Level<<DIO_Pin);
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_ChannelIdCheck(ChannelId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* Write the state of the channel */
+		/* Tiva C supports bit addressing, the table holds the GPIODATA address
+		   masked to the pin (or its bit-band alias) so the other pins of the port aren't affected */
+		DIO_ChannelPtr = &Dio_ChannelTable[ChannelId];
+		
+#if(DioShadowRegisters == STD_ON)
+		Dio_ShadowWriteData(DIO_ChannelPtr->Dio_Port, DIO_ChannelPtr->Dio_Mask, DIO_Data);
+#else
+		HW_W_8RIG(DIO_ChannelPtr->Dio_Address, DIO_Data);
+#endif /* DioShadowRegisters check */
+	}
 }
 
 /**
@@ -212,12 +341,23 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
  */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 {
+	/* Return data definition */
+	Dio_PortLevelType DIO_ReturnData = 0;
+	
 	/* Parameters check */
-	assert(E_OK == DIO_PortIdCheck(PortId));
-
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_PortIdCheck(PortId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		DIO_ReturnData = (Dio_PortLevelType)HW_R_8RIG(DIO_PortsAddresses[PortId] + 0x3FC);
+	}
 	
 	/* Return needed data */
-	return HW_R_8RIG(DIO_PortsAddresses[PortId] + 0x3FC);
+	return DIO_ReturnData;
 }
 
 /**
@@ -229,10 +369,17 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 void Dio_WritePort (Dio_PortType PortId, Dio_PortLevelType Level)
 {
 	/* Parameters check */
-	assert(E_OK == DIO_PortIdCheck(PortId));
-	
-	/* Write needed level */
-	HW_W_8RIG(DIO_PortsAddresses[PortId] + 0x3FC, Level);
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_PortIdCheck(PortId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* Write needed level */
+		Dio_ShadowWriteData((uint8)PortId, 0xFF, Level);
+	}
 }
 
 /**
@@ -242,13 +389,28 @@ void Dio_WritePort (Dio_PortType PortId, Dio_PortLevelType Level)
  */
 Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr)
 {
+	/* Return data definition */
+	Dio_PortLevelType DIO_ReturnData = 0;
+	
 	/* Parameters check */
-	assert(NULL_PTR != ChannelGroupIdPtr); /* NULL pointer check */
-	assert(E_OK == DIO_ChannelOffsetCheck(ChannelGroupIdPtr->offset));	/* Check the offset of ChannelGroup */
-	assert(E_OK == DIO_PortIdCheck(ChannelGroupIdPtr->port));			/* Check Port ID ChannelGroup */
+#if(DioDevErrorDetect == STD_ON)
+	if(NULL_PTR == ChannelGroupIdPtr)
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+	}
+	else if((E_OK != DIO_ChannelOffsetCheck(ChannelGroupIdPtr->offset)) ||	/* Check the offset of ChannelGroup */
+			(E_OK != DIO_PortIdCheck(ChannelGroupIdPtr->port)))				/* Check Port ID ChannelGroup */
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		DIO_ReturnData = (Dio_PortLevelType)HW_R_8RIG(DIO_PortsAddresses[ChannelGroupIdPtr->port] + 
+						(ChannelGroupIdPtr->mask << (2 + ChannelGroupIdPtr->offset)));
+	}
 	
-	return HW_R_8RIG(DIO_PortsAddresses[ChannelGroupIdPtr->port] + 
-					(ChannelGroupIdPtr->mask << (2 + ChannelGroupIdPtr->offset)));
+	return DIO_ReturnData;
 }
 
 /**
@@ -261,12 +423,22 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr,
 							Dio_PortLevelType Level)
 {
 	/* Parameters check */
-	assert(NULL_PTR != ChannelGroupIdPtr); /* NULL pointer check */
-	assert(E_OK == DIO_ChannelOffsetCheck(ChannelGroupIdPtr->offset));	/* Check the offset of ChannelGroup */
-	assert(E_OK == DIO_PortIdCheck(ChannelGroupIdPtr->port));			/* Check Port ID ChannelGroup */
-	
-	HW_W_8RIG(DIO_PortsAddresses[ChannelGroupIdPtr->port] + 
-						(ChannelGroupIdPtr->mask << (2 + ChannelGroupIdPtr->offset)),  Level);
+#if(DioDevErrorDetect == STD_ON)
+	if(NULL_PTR == ChannelGroupIdPtr)
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+	}
+	else if((E_OK != DIO_ChannelOffsetCheck(ChannelGroupIdPtr->offset)) ||	/* Check the offset of ChannelGroup */
+			(E_OK != DIO_PortIdCheck(ChannelGroupIdPtr->port)))				/* Check Port ID ChannelGroup */
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		Dio_ShadowWriteData((uint8)ChannelGroupIdPtr->port,
+							(uint8)(ChannelGroupIdPtr->mask << ChannelGroupIdPtr->offset), Level);
+	}
 }
 
 #if(DioVersionInfoApi == STD_ON)					
@@ -285,6 +457,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo)
 /**
  *	\brief		Service to flip (change from 1 to 0 or from 0 to 1) the level
  *				of a channel and return the level of the channel after flip.
+ *				The pin is read at most once and written once with interrupts locked.
  *	\param[in] 	ChannelId: ID of DIO channel.
  *	\return		Dio_LevelType:	-	STD_HIGH: 	The physical level of the 
  *												corresponding Pin is STD_HIGH.
@@ -293,19 +466,99 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo)
  */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	Dio_LevelType DIO_ReturnLevel;
-	/* Parameters check */
-	assert(E_OK == DIO_ChannelIdCheck(ChannelId));
-	
-	/* read and invert the current level */
-	DIO_ReturnLevel = (Dio_LevelType)! Dio_ReadChannel(ChannelId);
+	/* Needed Variables */
+	const Dio_ChannelEntryType* DIO_ChannelPtr;
+	Dio_LevelType DIO_ReturnLevel = STD_LOW;
+	uint32 DIO_IntState;
 	
-	/* Apply the inverted level */
-	Dio_WriteChannel(ChannelId, DIO_ReturnLevel);
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_ChannelIdCheck(ChannelId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		DIO_ChannelPtr = &Dio_ChannelTable[ChannelId];
+		
+		/* No ISR may change the pin between reading and writing it back */
+		HW_ENTER_CRITICAL(DIO_IntState);
+#if(DioShadowRegisters == STD_ON)
+		if(0 != (DIO_SHADOW_KNOWN_OUTPUTS(DIO_ChannelPtr->Dio_Port) & DIO_ChannelPtr->Dio_Mask))
+		{
+			/* Push-pull output, invert the last written level without reading the pin */
+			DIO_ReturnLevel = (Dio_Shadow[DIO_ChannelPtr->Dio_Port].Dio_Data & DIO_ChannelPtr->Dio_Mask) ? STD_LOW: STD_HIGH;
+		}
+		else
+#endif /* DioShadowRegisters check */
+		{
+			DIO_ReturnLevel = HW_R_8RIG(DIO_ChannelPtr->Dio_Address) ? STD_LOW: STD_HIGH;
+		}
+		
+		/* Apply the inverted level */
+#if(DioShadowRegisters == STD_ON)
+		Dio_ShadowWriteData(DIO_ChannelPtr->Dio_Port, DIO_ChannelPtr->Dio_Mask, (STD_LOW == DIO_ReturnLevel) ? 0x00: 0xFF);
+#else
+		HW_W_8RIG(DIO_ChannelPtr->Dio_Address, (STD_LOW == DIO_ReturnLevel) ? 0x00: 0xFF);
+#endif /* DioShadowRegisters check */
+		HW_EXIT_CRITICAL(DIO_IntState);
+	}
 		
 	/* Return new level */
 	return DIO_ReturnLevel;
 }
+
+/**
+ *	\brief		Service to flip the levels of many channels, one masked read and one masked
+ *				write per touched port, each port flipped atomically.
+ *	\param[in] 	MasksPtr: 	Pointer to the channels to be flipped, a mask per port indexed by port ID.
+ *	\return		None.
+ */
+void Dio_FlipChannels(const Dio_PortLevelType* MasksPtr)
+{
+	/* Needed Variables */
+	uint8 DIO_Port;
+	uint8 DIO_Mask;
+	uint8 DIO_Data;
+	uint32 DIO_IntState;
+	
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if(NULL_PTR == MasksPtr)
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNELS_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+		{
+			DIO_Mask = MasksPtr[DIO_Port];
+			if(0 != DIO_Mask)
+			{
+				HW_ENTER_CRITICAL(DIO_IntState);
+#if(DioShadowRegisters == STD_ON)
+				if(DIO_Mask == (DIO_SHADOW_KNOWN_OUTPUTS(DIO_Port) & DIO_Mask))
+				{
+					/* All pins are push-pull outputs, invert the last written levels */
+					DIO_Data = Dio_Shadow[DIO_Port].Dio_Data;
+				}
+				else
+#endif /* DioShadowRegisters check */
+				{
+					DIO_Data = (uint8)HW_R_8RIG(DIO_PortsAddresses[DIO_Port] + HW_GPIODATA_OFFSET + (DIO_Mask << 2));
+				}
+				Dio_ShadowWriteData(DIO_Port, DIO_Mask, (uint8)~DIO_Data);
+				HW_EXIT_CRITICAL(DIO_IntState);
+			}
+			else
+			{
+				/* No channels to be flipped in this port */
+			}
+		}
+	}
+}
 #endif /* DioFlipChannelApi check */
 
 #if(DioMaskedWritePortApi == STD_ON)
@@ -320,8 +573,370 @@ void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level,
 						Dio_PortLevelType Mask)
 {
 	/* Parameters check */
-	assert(E_OK == DIO_PortIdCheck(PortId));
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_PortIdCheck(PortId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		Dio_ShadowWriteData((uint8)PortId, (uint8)Mask, Level);
+	}
+}
+#endif /* DioMaskedWritePortApi check */
+
+#if(DioChannelListApi == STD_ON)
+/**
+ *	\brief		Service to set the levels of a list of channels.
+ *				The channels are grouped by port, one masked write per touched port.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[in] 	LevelsPtr: 		Pointer to the levels to be written, one per channel.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		None.
+ */
+void Dio_WriteChannelList(const Dio_ChannelType* ChannelIdsPtr, const Dio_LevelType* LevelsPtr,
+						  uint8 NoOfChannels)
+{
+	/* Needed Variables */
+	const Dio_ChannelEntryType* DIO_ChannelPtr;
+	uint8 DIO_Masks[HW_NO_OF_PORTS] = {0};	/* Pins of the list in every port */
+	uint8 DIO_Data[HW_NO_OF_PORTS] = {0};	/* Levels of the list pins in every port */
+	uint8 DIO_Index;
+	
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if((NULL_PTR == ChannelIdsPtr) || (NULL_PTR == LevelsPtr))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_LIST_SID, DIO_E_PARAM_POINTER);
+	}
+	else if(E_OK != DIO_ChannelListCheck(ChannelIdsPtr, NoOfChannels))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_LIST_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* Group the levels by port */
+		for(DIO_Index = 0; DIO_Index < NoOfChannels; DIO_Index++)
+		{
+			DIO_ChannelPtr = &Dio_ChannelTable[ChannelIdsPtr[DIO_Index]];
+			DIO_Masks[DIO_ChannelPtr->Dio_Port] |= DIO_ChannelPtr->Dio_Mask;
+			if(STD_LOW != LevelsPtr[DIO_Index])
+			{
+				DIO_Data[DIO_ChannelPtr->Dio_Port] |= DIO_ChannelPtr->Dio_Mask;
+			}
+			else
+			{
+				/* Pin bit stays cleared */
+			}
+		}
+		
+		/* One masked write per touched port */
+		for(DIO_Index = 0; DIO_Index < HW_NO_OF_PORTS; DIO_Index++)
+		{
+			if(0 != DIO_Masks[DIO_Index])
+			{
+				Dio_ShadowWriteData(DIO_Index, DIO_Masks[DIO_Index], DIO_Data[DIO_Index]);
+			}
+			else
+			{
+				/* Port isn't touched by the list */
+			}
+		}
+	}
+}
+
+/**
+ *	\brief		Service to read the levels of a list of channels.
+ *				The channels are grouped by port, one masked read per touched port.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[out] LevelsPtr: 		Pointer to where to store the levels, one per channel.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		None.
+ */
+void Dio_ReadChannelList(const Dio_ChannelType* ChannelIdsPtr, Dio_LevelType* LevelsPtr,
+						 uint8 NoOfChannels)
+{
+	/* Needed Variables */
+	const Dio_ChannelEntryType* DIO_ChannelPtr;
+	uint8 DIO_Masks[HW_NO_OF_PORTS] = {0};	/* Pins of the list in every port */
+	uint8 DIO_Data[HW_NO_OF_PORTS];			/* Levels of the list pins in every port */
+	uint8 DIO_Index;
 	
-	HW_W_8RIG(DIO_PortsAddresses[PortId] + (Mask << 2),  Level);
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if((NULL_PTR == ChannelIdsPtr) || (NULL_PTR == LevelsPtr))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_LIST_SID, DIO_E_PARAM_POINTER);
+	}
+	else if(E_OK != DIO_ChannelListCheck(ChannelIdsPtr, NoOfChannels))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_LIST_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* Group the pins by port */
+		for(DIO_Index = 0; DIO_Index < NoOfChannels; DIO_Index++)
+		{
+			DIO_ChannelPtr = &Dio_ChannelTable[ChannelIdsPtr[DIO_Index]];
+			DIO_Masks[DIO_ChannelPtr->Dio_Port] |= DIO_ChannelPtr->Dio_Mask;
+		}
+		
+		/* One masked read per touched port */
+		for(DIO_Index = 0; DIO_Index < HW_NO_OF_PORTS; DIO_Index++)
+		{
+			if(0 != DIO_Masks[DIO_Index])
+			{
+				DIO_Data[DIO_Index] = (uint8)HW_R_8RIG(DIO_PortsAddresses[DIO_Index] + HW_GPIODATA_OFFSET +
+													   (DIO_Masks[DIO_Index] << 2));
+			}
+			else
+			{
+				/* Port isn't touched by the list */
+			}
+		}
+		
+		/* Scatter the levels */
+		for(DIO_Index = 0; DIO_Index < NoOfChannels; DIO_Index++)
+		{
+			DIO_ChannelPtr = &Dio_ChannelTable[ChannelIdsPtr[DIO_Index]];
+			LevelsPtr[DIO_Index] = (DIO_Data[DIO_ChannelPtr->Dio_Port] & DIO_ChannelPtr->Dio_Mask) ? STD_HIGH: STD_LOW;
+		}
+	}
+}
+
+/**
+ *	\brief		Decodes and groups a list of channels by port into a channel set.
+ *	\param[out] ChannelSetPtr: 	Pointer to the channel set to be created.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		Std_ReturnType:	-	E_OK: The set is created.
+ *								-	E_NOT_OK: A pointer is NULL, a channel doesn't exist or the
+ *											  list is longer than DioChannelSetMaxSize.
+ */
+Std_ReturnType Dio_CreateChannelSet(Dio_ChannelSetType* ChannelSetPtr, const Dio_ChannelType* ChannelIdsPtr,
+									uint8 NoOfChannels)
+{
+	/* Needed Variables */
+	const Dio_ChannelEntryType* DIO_ChannelPtr;
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_Index;
+	
+	/* The set is built once, its parameters are always checked */
+	if((NULL_PTR == ChannelSetPtr) || (NULL_PTR == ChannelIdsPtr) || (NoOfChannels > DioChannelSetMaxSize))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		ChannelSetPtr->Dio_NoOfChannels = 0;
+		ChannelSetPtr->Dio_NoOfPorts = 0;
+		for(DIO_Index = 0; DIO_Index < HW_NO_OF_PORTS; DIO_Index++)
+		{
+			ChannelSetPtr->Dio_PortMasks[DIO_Index] = 0;
+		}
+		
+		for(DIO_Index = 0; (DIO_Index < NoOfChannels) && (E_OK == DIO_RetData); DIO_Index++)
+		{
+			if((ChannelIdsPtr[DIO_Index] >= DIO_NO_OF_CHANNEL_IDS) ||
+			   (0 == Dio_ChannelTable[ChannelIdsPtr[DIO_Index]].Dio_Mask))
+			{
+				DIO_RetData = E_NOT_OK;	/* Channel doesn't exist */
+			}
+			else
+			{
+				DIO_ChannelPtr = &Dio_ChannelTable[ChannelIdsPtr[DIO_Index]];
+				ChannelSetPtr->Dio_ChannelPorts[DIO_Index] = DIO_ChannelPtr->Dio_Port;
+				ChannelSetPtr->Dio_ChannelMasks[DIO_Index] = DIO_ChannelPtr->Dio_Mask;
+				
+				/* First channel of its port, the port is touched by the set */
+				if(0 == ChannelSetPtr->Dio_PortMasks[DIO_ChannelPtr->Dio_Port])
+				{
+					ChannelSetPtr->Dio_Ports[ChannelSetPtr->Dio_NoOfPorts] = DIO_ChannelPtr->Dio_Port;
+					ChannelSetPtr->Dio_NoOfPorts++;
+				}
+				else
+				{
+					/* Port already touched by the set */
+				}
+				ChannelSetPtr->Dio_PortMasks[DIO_ChannelPtr->Dio_Port] |= DIO_ChannelPtr->Dio_Mask;
+			}
+		}
+		
+		if(E_OK == DIO_RetData)
+		{
+			ChannelSetPtr->Dio_NoOfChannels = NoOfChannels;
+		}
+		else
+		{
+			/* Leave an empty set */
+			ChannelSetPtr->Dio_NoOfPorts = 0;
+		}
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Service to set the levels of the channels of a set, one masked write per touched port.
+ *	\param[in] 	ChannelSetPtr: 	Pointer to a set created by Dio_CreateChannelSet().
+ *	\param[in] 	LevelsPtr: 		Pointer to the levels to be written, in the order of the set channels.
+ *	\return		None.
+ */
+void Dio_WriteChannelSet(const Dio_ChannelSetType* ChannelSetPtr, const Dio_LevelType* LevelsPtr)
+{
+	/* Needed Variables */
+	uint8 DIO_Data[HW_NO_OF_PORTS] = {0};	/* Levels of the set pins in every port */
+	uint8 DIO_Index;
+	uint8 DIO_Port;
+	
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if((NULL_PTR == ChannelSetPtr) || (NULL_PTR == LevelsPtr))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SET_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* Gather the levels, the channels are already decoded */
+		for(DIO_Index = 0; DIO_Index < ChannelSetPtr->Dio_NoOfChannels; DIO_Index++)
+		{
+			if(STD_LOW != LevelsPtr[DIO_Index])
+			{
+				DIO_Data[ChannelSetPtr->Dio_ChannelPorts[DIO_Index]] |= ChannelSetPtr->Dio_ChannelMasks[DIO_Index];
+			}
+			else
+			{
+				/* Pin bit stays cleared */
+			}
+		}
+		
+		/* One masked write per touched port */
+		for(DIO_Index = 0; DIO_Index < ChannelSetPtr->Dio_NoOfPorts; DIO_Index++)
+		{
+			DIO_Port = ChannelSetPtr->Dio_Ports[DIO_Index];
+			Dio_ShadowWriteData(DIO_Port, ChannelSetPtr->Dio_PortMasks[DIO_Port], DIO_Data[DIO_Port]);
+		}
+	}
+}
+
+/**
+ *	\brief		Service to read the levels of the channels of a set, one masked read per touched port.
+ *	\param[in] 	ChannelSetPtr: 	Pointer to a set created by Dio_CreateChannelSet().
+ *	\param[out] LevelsPtr: 		Pointer to where to store the levels, in the order of the set channels.
+ *	\return		None.
+ */
+void Dio_ReadChannelSet(const Dio_ChannelSetType* ChannelSetPtr, Dio_LevelType* LevelsPtr)
+{
+	/* Needed Variables */
+	uint8 DIO_Data[HW_NO_OF_PORTS];		/* Levels of the set pins in every port */
+	uint8 DIO_Index;
+	uint8 DIO_Port;
+	
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if((NULL_PTR == ChannelSetPtr) || (NULL_PTR == LevelsPtr))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SET_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		/* One masked read per touched port */
+		for(DIO_Index = 0; DIO_Index < ChannelSetPtr->Dio_NoOfPorts; DIO_Index++)
+		{
+			DIO_Port = ChannelSetPtr->Dio_Ports[DIO_Index];
+			DIO_Data[DIO_Port] = (uint8)HW_R_8RIG(DIO_PortsAddresses[DIO_Port] + HW_GPIODATA_OFFSET +
+												  (ChannelSetPtr->Dio_PortMasks[DIO_Port] << 2));
+		}
+		
+		/* Scatter the levels */
+		for(DIO_Index = 0; DIO_Index < ChannelSetPtr->Dio_NoOfChannels; DIO_Index++)
+		{
+			LevelsPtr[DIO_Index] = (DIO_Data[ChannelSetPtr->Dio_ChannelPorts[DIO_Index]] &
+									ChannelSetPtr->Dio_ChannelMasks[DIO_Index]) ? STD_HIGH: STD_LOW;
+		}
+	}
+}
+#endif /* DioChannelListApi check */
+
+#if(DioReadAllPortsApi == STD_ON)
+/**
+ *	\brief		Reads all ports back to back with interrupts locked, so the levels
+ *				of all the channels are sampled as close together as possible.
+ *	\param		None.
+ *	\return		Dio_PortsImageType:	Levels of all ports, PORT n in bits 8n to 8n+7.
+ */
+Dio_PortsImageType Dio_ReadAllPorts(void)
+{
+	/* Needed Variables */
+	uint32 DIO_Levels[HW_NO_OF_PORTS];	/* Sampled levels, packed after the sampling */
+	Dio_PortsImageType DIO_Image = 0;
+	uint32 DIO_IntState;
+	uint8 DIO_Port;
+#if(DioSnapshotSkewMeasure == STD_ON)
+	uint32 DIO_StartCycle;
+	uint32 DIO_EndCycle;
+	
+	HW_CYCLE_COUNTER_ENABLE();
+#endif /* DioSnapshotSkewMeasure check */
+	
+	/* Sample every port, nothing else between the reads */
+	HW_ENTER_CRITICAL(DIO_IntState);
+#if(DioSnapshotSkewMeasure == STD_ON)
+	DIO_StartCycle = HW_CYCLE_COUNT();
+#endif /* DioSnapshotSkewMeasure check */
+	DIO_Levels[DIO_PORTA] = HW_R_8RIG(HW_GPIOPORTA_BASE + HW_GPIODATA_OFFSET + 0x3FC);
+	DIO_Levels[DIO_PORTB] = HW_R_8RIG(HW_GPIOPORTB_BASE + HW_GPIODATA_OFFSET + 0x3FC);
+	DIO_Levels[DIO_PORTC] = HW_R_8RIG(HW_GPIOPORTC_BASE + HW_GPIODATA_OFFSET + 0x3FC);
+	DIO_Levels[DIO_PORTD] = HW_R_8RIG(HW_GPIOPORTD_BASE + HW_GPIODATA_OFFSET + 0x3FC);
+	DIO_Levels[DIO_PORTE] = HW_R_8RIG(HW_GPIOPORTE_BASE + HW_GPIODATA_OFFSET + 0x3FC);
+	DIO_Levels[DIO_PORTF] = HW_R_8RIG(HW_GPIOPORTF_BASE + HW_GPIODATA_OFFSET + 0x3FC);
+#if(DioSnapshotSkewMeasure == STD_ON)
+	DIO_EndCycle = HW_CYCLE_COUNT();
+#endif /* DioSnapshotSkewMeasure check */
+	HW_EXIT_CRITICAL(DIO_IntState);
+	
+#if(DioSnapshotSkewMeasure == STD_ON)
+	Dio_SnapshotSkew = DIO_EndCycle - DIO_StartCycle;
+	HW_ACCOUNTING_SAMPLE("Dio_ReadAllPorts skew", Dio_SnapshotSkew);
+#endif /* DioSnapshotSkewMeasure check */
+	
+	/* Pack the image */
+	for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+	{
+		DIO_Image |= (Dio_PortsImageType)(DIO_Levels[DIO_Port] & 0xFF) << (DIO_Port << 3);
+	}
+	
+	return DIO_Image;
+}
+
+/**
+ *	\brief		Extracts the level of a channel from an image returned by Dio_ReadAllPorts().
+ *	\param[in] 	Image: 		Levels of all ports.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Dio_LevelType:	Level of the channel in the image.
+ */
+Dio_LevelType Dio_GetImageChannel(Dio_PortsImageType Image, Dio_ChannelType ChannelId)
+{
+	/* Return data definition */
+	Dio_LevelType DIO_ReturnData = STD_LOW;
+	
+	/* Parameters check */
+#if(DioDevErrorDetect == STD_ON)
+	if(E_OK != DIO_ChannelIdCheck(ChannelId))
+	{
+		(void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_IMAGE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	}
+	else
+#endif /* DioDevErrorDetect check */
+	{
+		DIO_ReturnData = (Dio_LevelType)((Image >> Dio_ImageBitTable[ChannelId]) & 1);
+	}
+	
+	return DIO_ReturnData;
 }
-#endif /* DioMaskedWritePortApi check */
\ No newline at end of file
+#endif /* DioReadAllPortsApi check */
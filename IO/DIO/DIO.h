@@ -17,6 +17,27 @@
 #include "DioGeneral.h"	
 
 /* Macros */
+/* Module identification */
+#define DIO_MODULE_ID					120		/*!< AUTOSAR module ID of DIO */
+#define DIO_INSTANCE_ID					0		/*!< Index of the only DIO instance */
+
+/* Service IDs */
+#define DIO_READ_CHANNEL_SID			0x00	/*!< Dio_ReadChannel() service ID */
+#define DIO_WRITE_CHANNEL_SID			0x01	/*!< Dio_WriteChannel() service ID */
+#define DIO_READ_PORT_SID				0x02	/*!< Dio_ReadPort() service ID */
+#define DIO_WRITE_PORT_SID				0x03	/*!< Dio_WritePort() service ID */
+#define DIO_READ_CHANNEL_GROUP_SID		0x04	/*!< Dio_ReadChannelGroup() service ID */
+#define DIO_WRITE_CHANNEL_GROUP_SID		0x05	/*!< Dio_WriteChannelGroup() service ID */
+#define DIO_FLIP_CHANNEL_SID			0x11	/*!< Dio_FlipChannel() service ID */
+#define DIO_GET_VERSION_INFO_SID		0x12	/*!< Dio_GetVersionInfo() service ID */
+#define DIO_MASKED_WRITE_PORT_SID		0x13	/*!< Dio_MaskedWritePort() service ID */
+#define DIO_WRITE_CHANNEL_LIST_SID		0x20	/*!< Dio_WriteChannelList() service ID */
+#define DIO_READ_CHANNEL_LIST_SID		0x21	/*!< Dio_ReadChannelList() service ID */
+#define DIO_WRITE_CHANNEL_SET_SID		0x22	/*!< Dio_WriteChannelSet() service ID */
+#define DIO_READ_CHANNEL_SET_SID		0x23	/*!< Dio_ReadChannelSet() service ID */
+#define DIO_FLIP_CHANNELS_SID			0x24	/*!< Dio_FlipChannels() service ID */
+#define DIO_GET_IMAGE_CHANNEL_SID		0x25	/*!< Dio_GetImageChannel() service ID */
+
 /* Development Errors */
 #define DIO_E_PARAM_INVALID_CHANNEL_ID	0x0A	/*!< Invalid channel requested */
 #define DIO_E_PARAM_INVALID_PORT_ID		0x14	/*!< Invalid port requested */
@@ -108,6 +129,22 @@ typedef uint8 Dio_LevelType;		/*!< These are the possible levels a DIO channel c
 
 typedef uint8 Dio_PortLevelType;	/*!< The type for the value of a DIO port.*/
 
+#if(DioChannelListApi == STD_ON)
+typedef struct{
+	uint8	Dio_NoOfChannels;							/*!< Number of channels in the set */
+	uint8	Dio_ChannelPorts[DioChannelSetMaxSize];		/*!< Port of every channel */
+	uint8	Dio_ChannelMasks[DioChannelSetMaxSize];		/*!< Bit of every channel in its port */
+	uint8	Dio_NoOfPorts;								/*!< Number of ports touched by the set */
+	uint8	Dio_Ports[HW_NO_OF_PORTS];					/*!< Ports touched by the set */
+	uint8	Dio_PortMasks[HW_NO_OF_PORTS];				/*!< Pins of the set in every port, indexed by port ID */
+}Dio_ChannelSetType;	/*!< Channels grouped by port once by Dio_CreateChannelSet(),
+							 so repeated batches don't decode nor group them again */
+#endif /* DioChannelListApi check */
+
+#if(DioReadAllPortsApi == STD_ON)
+typedef uint64 Dio_PortsImageType;	/*!< Levels of all ports, PORT n in bits 8n to 8n+7 */
+#endif /* DioReadAllPortsApi check */
+
 
 /* Functions Proto Types */
 /**
@@ -172,6 +209,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo);
 /**
  *	\brief		Service to flip (change from 1 to 0 or from 0 to 1) the level
  *				of a channel and return the level of the channel after flip.
+ *				The pin is read at most once and written once with interrupts locked.
  *	\param[in] 	ChannelId: ID of DIO channel.
  *	\return		Dio_LevelType:	-	STD_HIGH: 	The physical level of the 
  *												corresponding Pin is STD_HIGH.
@@ -179,6 +217,14 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo);
  *												corresponding Pin is STD_LOW.
  */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Service to flip the levels of many channels, one masked read and one masked
+ *				write per touched port, each port flipped atomically.
+ *	\param[in] 	MasksPtr: 	Pointer to the channels to be flipped, a mask per port indexed by port ID.
+ *	\return		None.
+ */
+void Dio_FlipChannels(const Dio_PortLevelType* MasksPtr);
 #endif /* DioFlipChannelApi */
 
 #if(DioMaskedWritePortApi == STD_ON)
@@ -192,4 +238,74 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level,
 						Dio_PortLevelType Mask);
 #endif /* DioMaskedWritePortApi check */
+
+#if(DioChannelListApi == STD_ON)
+/**
+ *	\brief		Service to set the levels of a list of channels.
+ *				The channels are grouped by port, one masked write per touched port.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[in] 	LevelsPtr: 		Pointer to the levels to be written, one per channel.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		None.
+ */
+void Dio_WriteChannelList(const Dio_ChannelType* ChannelIdsPtr, const Dio_LevelType* LevelsPtr,
+						  uint8 NoOfChannels);
+
+/**
+ *	\brief		Service to read the levels of a list of channels.
+ *				The channels are grouped by port, one masked read per touched port.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[out] LevelsPtr: 		Pointer to where to store the levels, one per channel.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		None.
+ */
+void Dio_ReadChannelList(const Dio_ChannelType* ChannelIdsPtr, Dio_LevelType* LevelsPtr,
+						 uint8 NoOfChannels);
+
+/**
+ *	\brief		Decodes and groups a list of channels by port into a channel set.
+ *	\param[out] ChannelSetPtr: 	Pointer to the channel set to be created.
+ *	\param[in] 	ChannelIdsPtr: 	Pointer to the IDs of the channels.
+ *	\param[in] 	NoOfChannels: 	Number of channels in the list.
+ *	\return		Std_ReturnType:	-	E_OK: The set is created.
+ *								-	E_NOT_OK: A pointer is NULL, a channel doesn't exist or the
+ *											  list is longer than DioChannelSetMaxSize.
+ */
+Std_ReturnType Dio_CreateChannelSet(Dio_ChannelSetType* ChannelSetPtr, const Dio_ChannelType* ChannelIdsPtr,
+									uint8 NoOfChannels);
+
+/**
+ *	\brief		Service to set the levels of the channels of a set, one masked write per touched port.
+ *	\param[in] 	ChannelSetPtr: 	Pointer to a set created by Dio_CreateChannelSet().
+ *	\param[in] 	LevelsPtr: 		Pointer to the levels to be written, in the order of the set channels.
+ *	\return		None.
+ */
+void Dio_WriteChannelSet(const Dio_ChannelSetType* ChannelSetPtr, const Dio_LevelType* LevelsPtr);
+
+/**
+ *	\brief		Service to read the levels of the channels of a set, one masked read per touched port.
+ *	\param[in] 	ChannelSetPtr: 	Pointer to a set created by Dio_CreateChannelSet().
+ *	\param[out] LevelsPtr: 		Pointer to where to store the levels, in the order of the set channels.
+ *	\return		None.
+ */
+void Dio_ReadChannelSet(const Dio_ChannelSetType* ChannelSetPtr, Dio_LevelType* LevelsPtr);
+#endif /* DioChannelListApi check */
+
+#if(DioReadAllPortsApi == STD_ON)
+/**
+ *	\brief		Reads all ports back to back with interrupts locked, so the levels
+ *				of all the channels are sampled as close together as possible.
+ *	\param		None.
+ *	\return		Dio_PortsImageType:	Levels of all ports, PORT n in bits 8n to 8n+7.
+ */
+Dio_PortsImageType Dio_ReadAllPorts(void);
+
+/**
+ *	\brief		Extracts the level of a channel from an image returned by Dio_ReadAllPorts().
+ *	\param[in] 	Image: 		Levels of all ports.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Dio_LevelType:	Level of the channel in the image.
+ */
+Dio_LevelType Dio_GetImageChannel(Dio_PortsImageType Image, Dio_ChannelType ChannelId);
+#endif /* DioReadAllPortsApi check */
 #endif /* DIO_H_ */ 
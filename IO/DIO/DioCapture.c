@@ -0,0 +1,251 @@
+/**
+ *  \file	DioCapture.c
+ *  \brief 	Logic analyzer capture of DIO ports with run-length compression.
+ *  		A sample costs one GPIODATA read per sampled port and a compare, memory
+ *  		is only written when the levels change.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioCapture.h"
+
+#if(DioCaptureApi == STD_ON)
+/* Macros */
+/* Largest delta of a record, a record is stored when it is reached even without a change */
+#define DIO_CAPTURE_MAX_DELTA	0xFFFF
+
+/* Shared Variables */
+Dio_CaptureBufferType Dio_CaptureBuffer;	/*!< Capture buffer, read it once the capture is done */
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static volatile Dio_CaptureStateType Dio_CaptureState = DIO_CAPTURE_IDLE;	/*!< State of the capture */
+static HW_AddressBusSizeType Dio_CaptureAddresses[DIO_CAPTURE_MAX_PORTS];	/*!< GPIODATA addresses of the sampled ports, all pins unmasked */
+static uint8 Dio_CaptureNoOfPorts;			/*!< Number of sampled ports */
+static uint32 Dio_CaptureLast;				/*!< Levels of the last record */
+static uint16 Dio_CaptureDelta;				/*!< Samples since the last record */
+static boolean Dio_CaptureFirst;			/*!< Next sample is the first one */
+static uint32 Dio_CaptureTriggerMask;		/*!< Image bits compared to the trigger pattern */
+static uint32 Dio_CaptureTriggerPattern;	/*!< Image levels of the masked bits which trigger */
+static uint16 Dio_CapturePostTrigger;		/*!< Records to be stored after the trigger */
+static uint16 Dio_CapturePostLeft;			/*!< Records left to be stored after the trigger */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Stores a record and runs the trigger.
+ *	\param[in] 	Image: 	Sampled levels.
+ *	\param[in] 	Delta: 	Samples since the previous record.
+ *	\return		None.
+ */
+static void Dio_CaptureStore(uint32 Image, uint16 Delta);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Stores a record and runs the trigger.
+ *	\param[in] 	Image: 	Sampled levels.
+ *	\param[in] 	Delta: 	Samples since the previous record.
+ *	\return		None.
+ */
+static void Dio_CaptureStore(uint32 Image, uint16 Delta)
+{
+	/* Needed Variables */
+	Dio_CaptureRecordType* DIO_RecordPtr = &Dio_CaptureBuffer.Dio_Records[Dio_CaptureBuffer.Dio_Next];
+	uint16 DIO_Index = Dio_CaptureBuffer.Dio_Next;
+	
+	DIO_RecordPtr->Dio_Image = Image;
+	DIO_RecordPtr->Dio_Delta = Delta;
+	Dio_CaptureBuffer.Dio_Next = (uint16)((DIO_Index + 1) % DioCaptureRecords);
+	if(Dio_CaptureBuffer.Dio_Count < (uint16)DioCaptureRecords)
+	{
+		Dio_CaptureBuffer.Dio_Count++;
+	}
+	else
+	{
+		/* Ring full, the oldest record was overwritten */
+	}
+	
+	if(DIO_CAPTURE_ARMED == Dio_CaptureState)
+	{
+		if((Image & Dio_CaptureTriggerMask) == Dio_CaptureTriggerPattern)
+		{
+			Dio_CaptureBuffer.Dio_Trigger = DIO_Index;
+			Dio_CapturePostLeft = Dio_CapturePostTrigger;
+			Dio_CaptureState = (0 != Dio_CapturePostLeft) ? DIO_CAPTURE_TRIGGERED : DIO_CAPTURE_DONE;
+		}
+		else
+		{
+			/* Keep recording the history */
+		}
+	}
+	else
+	{
+		Dio_CapturePostLeft--;
+		if(0 == Dio_CapturePostLeft)
+		{
+			Dio_CaptureState = DIO_CAPTURE_DONE;
+		}
+		else
+		{
+			/* Records left after the trigger */
+		}
+	}
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Starts a capture, the first sample is recorded as the initial levels.
+ *				To be called while Dio_CaptureSample() isn't running or the capture is done.
+ *	\param[in] 	ConfigPtr: 	Pointer to the capture configuration.
+ *	\return		Std_ReturnType:	-	E_OK: The capture is armed.
+ *								-	E_NOT_OK: NULL pointer, no port, too many ports or a port
+ *											  doesn't exist.
+ */
+Std_ReturnType Dio_CaptureStart(const Dio_CaptureConfigType* ConfigPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_Port;
+	uint8 DIO_NoOfPorts = 0;
+	
+	if((NULL_PTR == ConfigPtr) || (0 == ConfigPtr->Dio_PortsMask) ||
+	   (0 != (ConfigPtr->Dio_PortsMask >> HW_NO_OF_PORTS)))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		Dio_CaptureState = DIO_CAPTURE_IDLE;
+	
+		/* Image bytes in ascending port order */
+		for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+		{
+			if(0 != (ConfigPtr->Dio_PortsMask & (1 << DIO_Port)))
+			{
+				if(DIO_NoOfPorts < DIO_CAPTURE_MAX_PORTS)
+				{
+					Dio_CaptureAddresses[DIO_NoOfPorts] = HW_PortsAddresses[DIO_Port] + HW_GPIODATA_OFFSET + (0xFF << 2);
+					Dio_CaptureBuffer.Dio_Ports[DIO_NoOfPorts] = DIO_Port;
+				}
+				else
+				{
+					DIO_RetData = E_NOT_OK;
+				}
+				DIO_NoOfPorts++;
+			}
+			else
+			{
+				/* Port isn't sampled */
+			}
+		}
+	}
+	
+	if(E_OK == DIO_RetData)
+	{
+		for(DIO_Port = DIO_NoOfPorts; DIO_Port < DIO_CAPTURE_MAX_PORTS; DIO_Port++)
+		{
+			Dio_CaptureBuffer.Dio_Ports[DIO_Port] = DIO_CAPTURE_NO_PORT;
+		}
+		Dio_CaptureNoOfPorts = DIO_NoOfPorts;
+		Dio_CaptureBuffer.Dio_Magic = DIO_CAPTURE_MAGIC;
+		Dio_CaptureBuffer.Dio_Size = (uint16)DioCaptureRecords;
+		Dio_CaptureBuffer.Dio_Count = 0;
+		Dio_CaptureBuffer.Dio_Next = 0;
+		Dio_CaptureBuffer.Dio_Trigger = DIO_CAPTURE_NO_TRIGGER;
+		Dio_CaptureBuffer.Dio_SamplePeriodNs = ConfigPtr->Dio_SamplePeriodNs;
+		Dio_CaptureTriggerMask = ConfigPtr->Dio_TriggerMask;
+		Dio_CaptureTriggerPattern = ConfigPtr->Dio_TriggerPattern & ConfigPtr->Dio_TriggerMask;
+	
+		/* The trigger record is never overwritten */
+		Dio_CapturePostTrigger = (ConfigPtr->Dio_PostTrigger < (uint16)DioCaptureRecords) ?
+								 ConfigPtr->Dio_PostTrigger : (uint16)(DioCaptureRecords - 1);
+		Dio_CaptureDelta = 0;
+		Dio_CaptureFirst = TRUE;
+	
+		/* The configuration is written before the sampling sees the capture armed */
+		HW_MEMORY_BARRIER();
+		Dio_CaptureState = DIO_CAPTURE_ARMED;
+	}
+	else
+	{
+		/* Capture not started */
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Samples the ports, to be called from a periodic timer interrupt.
+ *				A record is stored only if the levels changed or the delta would overflow.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_CaptureSample(void)
+{
+	/* Needed Variables */
+	uint32 DIO_Image = 0;
+	uint8 DIO_Index;
+	
+	if((DIO_CAPTURE_ARMED == Dio_CaptureState) || (DIO_CAPTURE_TRIGGERED == Dio_CaptureState))
+	{
+		for(DIO_Index = 0; DIO_Index < Dio_CaptureNoOfPorts; DIO_Index++)
+		{
+			DIO_Image |= (uint32)(uint8)HW_R_8RIG(Dio_CaptureAddresses[DIO_Index]) << (DIO_Index << 3);
+		}
+	
+		if(TRUE == Dio_CaptureFirst)
+		{
+			Dio_CaptureFirst = FALSE;
+			Dio_CaptureLast = DIO_Image;
+			Dio_CaptureStore(DIO_Image, 0);
+		}
+		else
+		{
+			Dio_CaptureDelta++;
+			if((DIO_Image != Dio_CaptureLast) || (DIO_CAPTURE_MAX_DELTA == Dio_CaptureDelta))
+			{
+				Dio_CaptureLast = DIO_Image;
+				Dio_CaptureStore(DIO_Image, Dio_CaptureDelta);
+				Dio_CaptureDelta = 0;
+			}
+			else
+			{
+				/* Same levels, nothing stored */
+			}
+		}
+	}
+	else
+	{
+		/* Capture not running */
+	}
+}
+
+/**
+ *	\brief		Stops the capture, the buffer keeps the records captured so far.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_CaptureStop(void)
+{
+	if(DIO_CAPTURE_IDLE != Dio_CaptureState)
+	{
+		Dio_CaptureState = DIO_CAPTURE_DONE;
+	}
+	else
+	{
+		/* Nothing captured */
+	}
+}
+
+/**
+ *	\brief		Returns the state of the capture.
+ *	\param		None.
+ *	\return		Dio_CaptureStateType:	DIO_CAPTURE_IDLE, DIO_CAPTURE_ARMED,
+ *										DIO_CAPTURE_TRIGGERED or DIO_CAPTURE_DONE.
+ */
+Dio_CaptureStateType Dio_CaptureGetState(void)
+{
+	return Dio_CaptureState;
+}
+#endif /* DioCaptureApi check */
@@ -0,0 +1,102 @@
+/**
+ *  \file	DioCapture.h
+ *  \brief 	Logic analyzer capture of DIO ports. Up to four ports are sampled at a fixed rate
+ *  		by Dio_CaptureSample() and only the changes are stored, as run-length records
+ *  		(samples since the previous record and the new levels) in a ring buffer.
+ *  		The ring keeps the history before the trigger (a mask and a pattern on the
+ *  		sampled levels) and the capture stops a number of records after the trigger.
+ *  		Dio_CaptureBuffer is self-describing, a memory dump of it is converted to VCD
+ *  		by Tools/DioCaptureVcd.
+ *  		Enabled by DioCaptureApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_CAPTURE_H_
+#define DIO_CAPTURE_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioCaptureApi == STD_ON)
+/* Macros */
+#define DIO_CAPTURE_MAGIC		0x50414344	/*!< "DCAP", identifies Dio_CaptureBuffer in a memory dump */
+#define DIO_CAPTURE_MAX_PORTS	4			/*!< Ports sampled at most, a byte of the image each */
+#define DIO_CAPTURE_NO_PORT		0xFF		/*!< Unused byte of the image */
+#define DIO_CAPTURE_NO_TRIGGER	0xFFFF		/*!< Dio_Trigger before the trigger */
+
+/* Dio_CaptureStateType Macros */
+#define DIO_CAPTURE_IDLE		0x00	/*!< Not started */
+#define DIO_CAPTURE_ARMED		0x01	/*!< Recording the history, waiting for the trigger */
+#define DIO_CAPTURE_TRIGGERED	0x02	/*!< Recording the records after the trigger */
+#define DIO_CAPTURE_DONE		0x03	/*!< Stopped, the buffer can be read */
+
+/* Defined data types */
+typedef uint8 Dio_CaptureStateType;	/*!< State of the capture */
+
+typedef struct{
+	uint8	Dio_PortsMask;			/*!< Sampled ports, a bit per port ID, at most DIO_CAPTURE_MAX_PORTS bits */
+	uint32	Dio_TriggerMask;		/*!< Image bits compared to the trigger pattern, 0 triggers at once */
+	uint32	Dio_TriggerPattern;		/*!< Image levels of the masked bits which trigger */
+	uint16	Dio_PostTrigger;		/*!< Records kept after the trigger record, the rest of the ring keeps the history */
+	uint32	Dio_SamplePeriodNs;		/*!< Period of Dio_CaptureSample() calls, only stored for the decoder */
+}Dio_CaptureConfigType;	/*!< Capture configuration */
+
+typedef struct{
+	uint32	Dio_Image;	/*!< Levels of the sampled ports, byte n holds port Dio_Ports[n] */
+	uint16	Dio_Delta;	/*!< Samples since the previous record */
+}Dio_CaptureRecordType;	/*!< Change of the sampled levels */
+
+typedef struct{
+	uint32	Dio_Magic;								/*!< DIO_CAPTURE_MAGIC */
+	uint8	Dio_Ports[DIO_CAPTURE_MAX_PORTS];		/*!< Port ID of every image byte, DIO_CAPTURE_NO_PORT if unused */
+	uint16	Dio_Size;								/*!< Number of records of the ring */
+	uint16	Dio_Count;								/*!< Number of valid records */
+	uint16	Dio_Next;								/*!< Index of the next record, the oldest one once the ring is full */
+	uint16	Dio_Trigger;							/*!< Index of the trigger record, DIO_CAPTURE_NO_TRIGGER before it */
+	uint32	Dio_SamplePeriodNs;						/*!< Period of the samples */
+	Dio_CaptureRecordType	Dio_Records[DioCaptureRecords];	/*!< Records ring */
+}Dio_CaptureBufferType;	/*!< Capture buffer */
+
+/* Shared variables */
+extern Dio_CaptureBufferType Dio_CaptureBuffer;	/*!< Capture buffer, read it once the capture is done */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Starts a capture, the first sample is recorded as the initial levels.
+ *				To be called while Dio_CaptureSample() isn't running or the capture is done.
+ *	\param[in] 	ConfigPtr: 	Pointer to the capture configuration.
+ *	\return		Std_ReturnType:	-	E_OK: The capture is armed.
+ *								-	E_NOT_OK: NULL pointer, no port, too many ports or a port
+ *											  doesn't exist.
+ */
+Std_ReturnType Dio_CaptureStart(const Dio_CaptureConfigType* ConfigPtr);
+
+/**
+ *	\brief		Samples the ports, to be called from a periodic timer interrupt.
+ *				A record is stored only if the levels changed or the delta would overflow.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_CaptureSample(void);
+
+/**
+ *	\brief		Stops the capture, the buffer keeps the records captured so far.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_CaptureStop(void);
+
+/**
+ *	\brief		Returns the state of the capture.
+ *	\param		None.
+ *	\return		Dio_CaptureStateType:	DIO_CAPTURE_IDLE, DIO_CAPTURE_ARMED,
+ *										DIO_CAPTURE_TRIGGERED or DIO_CAPTURE_DONE.
+ */
+Dio_CaptureStateType Dio_CaptureGetState(void);
+#endif /* DioCaptureApi check */
+
+#endif /* DIO_CAPTURE_H_ */
@@ -0,0 +1,258 @@
+/**
+ *  \file	DioDebounce.c
+ *  \brief 	Debounces DIO input channels. Whole ports are sampled with Dio_ReadPort()
+ *  		and every channel of a port is debounced at once by bit-sliced (vertical)
+ *  		counters, so the cost of a tick depends on the number of ports only.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioDebounce.h"
+
+#if(DioDebounceApi == STD_ON)
+/* Macros */
+/* Get the port of a channel from its ID */
+#define DIO_DEBOUNCE_GET_PORT(CHANNEL_ID)	(uint8)(((CHANNEL_ID) & 0xF0) >> 4)
+
+/* Get the bit of a channel in its port from its ID */
+#define DIO_DEBOUNCE_GET_MASK(CHANNEL_ID)	(uint8)(1 << ((CHANNEL_ID) & 0x07))
+
+/* Defined data types */
+typedef struct{
+	uint8	Dio_Channels;								/*!< Debounced channels of the port */
+	uint8	Dio_Stable;									/*!< Stable levels */
+	uint8	Dio_Changed;								/*!< Channels whose stable level changed */
+	uint8	Dio_Counter[DioDebounceCounterBits];		/*!< Counters bit planes, plane n holds bit n of every channel counter */
+	uint8	Dio_Threshold[DioDebounceCounterBits];		/*!< Thresholds bit planes */
+}Dio_DebouncePortType;	/*!< Debounce state of a port */
+
+/* Private Variables */
+static Dio_DebouncePortType Dio_DebouncePorts[HW_NO_OF_PORTS];	/*!< Debounce state of every port */
+static uint8 Dio_DebounceActivePorts[HW_NO_OF_PORTS];			/*!< Ports having debounced channels */
+static uint8 Dio_DebounceNoOfActivePorts = 0;					/*!< Number of ports having debounced channels */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Runs one debounce tick on a port.
+ *	\param[in] 	PortPtr: 	Pointer to the debounce state of the port.
+ *	\param[in] 	Sample: 	Sampled levels of the port.
+ *	\return		None.
+ */
+static void Dio_DebouncePort(Dio_DebouncePortType* PortPtr, uint8 Sample);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Runs one debounce tick on a port.
+ *	\param[in] 	PortPtr: 	Pointer to the debounce state of the port.
+ *	\param[in] 	Sample: 	Sampled levels of the port.
+ *	\return		None.
+ */
+static void Dio_DebouncePort(Dio_DebouncePortType* PortPtr, uint8 Sample)
+{
+	/* Needed Variables */
+	uint8 DIO_Differ = (uint8)((Sample ^ PortPtr->Dio_Stable) & PortPtr->Dio_Channels);	/* Sampled level isn't the stable one */
+	uint8 DIO_Carry = DIO_Differ;
+	uint8 DIO_Reached = DIO_Differ;		/* Counter equals the threshold */
+	uint8 DIO_Bit;
+	uint8 DIO_Plane;
+	
+	for(DIO_Plane = 0; DIO_Plane < (uint8)DioDebounceCounterBits; DIO_Plane++)
+	{
+		/* Channels sampling the stable level restart counting, the others count one more tick */
+		DIO_Bit = (uint8)(PortPtr->Dio_Counter[DIO_Plane] & DIO_Differ);
+		PortPtr->Dio_Counter[DIO_Plane] = (uint8)(DIO_Bit ^ DIO_Carry);
+		DIO_Carry = (uint8)(DIO_Bit & DIO_Carry);
+		
+		DIO_Reached &= (uint8)~(PortPtr->Dio_Counter[DIO_Plane] ^ PortPtr->Dio_Threshold[DIO_Plane]);
+	}
+	
+	/* The new level was sampled for threshold ticks, it is stable now */
+	if(0 != DIO_Reached)
+	{
+		PortPtr->Dio_Stable ^= DIO_Reached;
+		PortPtr->Dio_Changed |= DIO_Reached;
+		for(DIO_Plane = 0; DIO_Plane < (uint8)DioDebounceCounterBits; DIO_Plane++)
+		{
+			PortPtr->Dio_Counter[DIO_Plane] &= (uint8)~DIO_Reached;
+		}
+	}
+	else
+	{
+		/* No stable level changed */
+	}
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Initializes the debouncing of a set of channels.
+ *				The current levels of the channels are taken as stable.
+ *	\param[in] 	ConfigPtr: 	Pointer to the debounce configuration set.
+ *	\return		Std_ReturnType:	-	E_OK: The channels are debounced from now on.
+ *								-	E_NOT_OK: NULL pointer, a channel doesn't exist or a threshold
+ *											  is out of range, no channel is debounced.
+ */
+Std_ReturnType Dio_DebounceInit(const Dio_DebounceConfigType* ConfigPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	const Dio_DebounceChannelType* DIO_ChannelPtr;
+	Dio_DebouncePortType* DIO_PortPtr;
+	uint8 DIO_Index;
+	uint8 DIO_Plane;
+	uint8 DIO_Mask;
+	
+	/* Stop debouncing */
+	Dio_DebounceNoOfActivePorts = 0;
+	for(DIO_Index = 0; DIO_Index < HW_NO_OF_PORTS; DIO_Index++)
+	{
+		DIO_PortPtr = &Dio_DebouncePorts[DIO_Index];
+		DIO_PortPtr->Dio_Channels = 0;
+		DIO_PortPtr->Dio_Changed = 0;
+		for(DIO_Plane = 0; DIO_Plane < (uint8)DioDebounceCounterBits; DIO_Plane++)
+		{
+			DIO_PortPtr->Dio_Counter[DIO_Plane] = 0;
+			DIO_PortPtr->Dio_Threshold[DIO_Plane] = 0;
+		}
+	}
+	
+	if(NULL_PTR == ConfigPtr)
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* Slice the thresholds into the bit planes of their ports */
+		for(DIO_Index = 0; (DIO_Index < ConfigPtr->Dio_NoOfChannels) && (E_OK == DIO_RetData); DIO_Index++)
+		{
+			DIO_ChannelPtr = &ConfigPtr->Dio_Channels[DIO_Index];
+			if((DIO_DEBOUNCE_GET_PORT(DIO_ChannelPtr->Dio_ChannelId) >= HW_NO_OF_PORTS) ||
+			   ((DIO_ChannelPtr->Dio_ChannelId & 0x0F) > 7) ||
+			   (0 == DIO_ChannelPtr->Dio_Threshold) ||
+			   (DIO_ChannelPtr->Dio_Threshold >= (1 << DioDebounceCounterBits)))
+			{
+				DIO_RetData = E_NOT_OK;
+			}
+			else
+			{
+				DIO_PortPtr = &Dio_DebouncePorts[DIO_DEBOUNCE_GET_PORT(DIO_ChannelPtr->Dio_ChannelId)];
+				DIO_Mask = DIO_DEBOUNCE_GET_MASK(DIO_ChannelPtr->Dio_ChannelId);
+				DIO_PortPtr->Dio_Channels |= DIO_Mask;
+				for(DIO_Plane = 0; DIO_Plane < (uint8)DioDebounceCounterBits; DIO_Plane++)
+				{
+					if(0 != (DIO_ChannelPtr->Dio_Threshold & (1 << DIO_Plane)))
+					{
+						DIO_PortPtr->Dio_Threshold[DIO_Plane] |= DIO_Mask;
+					}
+					else
+					{
+						DIO_PortPtr->Dio_Threshold[DIO_Plane] &= (uint8)~DIO_Mask;
+					}
+				}
+			}
+		}
+		
+		if(E_OK == DIO_RetData)
+		{
+			/* Current levels are the stable ones */
+			for(DIO_Index = 0; DIO_Index < HW_NO_OF_PORTS; DIO_Index++)
+			{
+				if(0 != Dio_DebouncePorts[DIO_Index].Dio_Channels)
+				{
+					Dio_DebouncePorts[DIO_Index].Dio_Stable = (uint8)(Dio_ReadPort((Dio_PortType)DIO_Index) &
+																	  Dio_DebouncePorts[DIO_Index].Dio_Channels);
+					Dio_DebounceActivePorts[Dio_DebounceNoOfActivePorts] = DIO_Index;
+					Dio_DebounceNoOfActivePorts++;
+				}
+				else
+				{
+					/* No debounced channels in this port */
+				}
+			}
+		}
+		else
+		{
+			/* Leave no channel debounced */
+			for(DIO_Index = 0; DIO_Index < HW_NO_OF_PORTS; DIO_Index++)
+			{
+				Dio_DebouncePorts[DIO_Index].Dio_Channels = 0;
+			}
+		}
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Debounce tick, samples every port having debounced channels once.
+ *				To be called cyclically, the thresholds are counted in calls.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_DebounceMainFunction(void)
+{
+	/* Needed Variables */
+	uint8 DIO_Index;
+	uint8 DIO_Port;
+	
+	for(DIO_Index = 0; DIO_Index < Dio_DebounceNoOfActivePorts; DIO_Index++)
+	{
+		DIO_Port = Dio_DebounceActivePorts[DIO_Index];
+		Dio_DebouncePort(&Dio_DebouncePorts[DIO_Port], Dio_ReadPort((Dio_PortType)DIO_Port));
+	}
+}
+
+/**
+ *	\brief		Returns the stable levels of all ports and the channels whose stable level
+ *				changed since the previous call.
+ *	\param[out] StablePtr: 	Pointer to the stable levels, a level per port indexed by port ID.
+ *	\param[out] ChangedPtr: Pointer to the changed channels, a mask per port indexed by port ID.
+ *	\return		None.
+ */
+void Dio_DebounceGetImage(Dio_PortLevelType* StablePtr, Dio_PortLevelType* ChangedPtr)
+{
+	/* Needed Variables */
+	uint8 DIO_Port;
+	uint32 DIO_IntState;
+	
+	if((NULL_PTR != StablePtr) && (NULL_PTR != ChangedPtr))
+	{
+		/* The tick may run from an interrupt, the image and the changes have to match */
+		HW_ENTER_CRITICAL(DIO_IntState);
+		for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+		{
+			StablePtr[DIO_Port] = Dio_DebouncePorts[DIO_Port].Dio_Stable;
+			ChangedPtr[DIO_Port] = Dio_DebouncePorts[DIO_Port].Dio_Changed;
+			Dio_DebouncePorts[DIO_Port].Dio_Changed = 0;
+		}
+		HW_EXIT_CRITICAL(DIO_IntState);
+	}
+	else
+	{
+		/* Nowhere to store the image */
+	}
+}
+
+/**
+ *	\brief		Returns the stable level of a debounced channel.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Dio_LevelType:	Stable level of the channel.
+ */
+Dio_LevelType Dio_DebounceGetChannel(Dio_ChannelType ChannelId)
+{
+	/* Return data definition */
+	Dio_LevelType DIO_ReturnData = STD_LOW;
+	
+	if(DIO_DEBOUNCE_GET_PORT(ChannelId) < HW_NO_OF_PORTS)
+	{
+		DIO_ReturnData = (Dio_DebouncePorts[DIO_DEBOUNCE_GET_PORT(ChannelId)].Dio_Stable &
+						  DIO_DEBOUNCE_GET_MASK(ChannelId)) ? STD_HIGH: STD_LOW;
+	}
+	else
+	{
+		/* Channel doesn't exist */
+	}
+	
+	return DIO_ReturnData;
+}
+#endif /* DioDebounceApi check */
@@ -0,0 +1,69 @@
+/**
+ *  \file	DioDebounce.h
+ *  \brief 	Debounces DIO input channels. Whole ports are sampled with Dio_ReadPort()
+ *  		and every channel of a port is debounced at once by bit-sliced (vertical)
+ *  		counters, so the cost of a tick depends on the number of ports only.
+ *  		Enabled by DioDebounceApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_DEBOUNCE_H_
+#define DIO_DEBOUNCE_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioDebounceApi == STD_ON)
+/* Defined data types */
+typedef struct{
+	Dio_ChannelType	Dio_ChannelId;	/*!< Debounced channel */
+	uint8			Dio_Threshold;	/*!< Consecutive ticks a new level must be sampled before it is stable,
+										 from 1 to 2^DioDebounceCounterBits - 1 */
+}Dio_DebounceChannelType;	/*!< Debounce configuration of a channel */
+
+typedef struct{
+	const Dio_DebounceChannelType*	Dio_Channels;	/*!< Debounced channels */
+	uint8							Dio_NoOfChannels;	/*!< Number of debounced channels */
+}Dio_DebounceConfigType;	/*!< Debounce configuration set */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Initializes the debouncing of a set of channels.
+ *				The current levels of the channels are taken as stable.
+ *	\param[in] 	ConfigPtr: 	Pointer to the debounce configuration set.
+ *	\return		Std_ReturnType:	-	E_OK: The channels are debounced from now on.
+ *								-	E_NOT_OK: NULL pointer, a channel doesn't exist or a threshold
+ *											  is out of range, no channel is debounced.
+ */
+Std_ReturnType Dio_DebounceInit(const Dio_DebounceConfigType* ConfigPtr);
+
+/**
+ *	\brief		Debounce tick, samples every port having debounced channels once.
+ *				To be called cyclically, the thresholds are counted in calls.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_DebounceMainFunction(void);
+
+/**
+ *	\brief		Returns the stable levels of all ports and the channels whose stable level
+ *				changed since the previous call.
+ *	\param[out] StablePtr: 	Pointer to the stable levels, a level per port indexed by port ID.
+ *	\param[out] ChangedPtr: Pointer to the changed channels, a mask per port indexed by port ID.
+ *	\return		None.
+ */
+void Dio_DebounceGetImage(Dio_PortLevelType* StablePtr, Dio_PortLevelType* ChangedPtr);
+
+/**
+ *	\brief		Returns the stable level of a debounced channel.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Dio_LevelType:	Stable level of the channel.
+ */
+Dio_LevelType Dio_DebounceGetChannel(Dio_ChannelType ChannelId);
+#endif /* DioDebounceApi check */
+
+#endif /* DIO_DEBOUNCE_H_ */
@@ -0,0 +1,221 @@
+/**
+ *  \file	DioEdge.c
+ *  \brief 	Edge (and level) notifications of DIO channels through the GPIO ports interrupts.
+ *  		The interrupt handler of a port costs one GPIOMIS read, one GPIOICR write and
+ *  		one count leading zeros per pending channel.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioEdge.h"
+
+#if(DioEdgeApi == STD_ON)
+/* Macros */
+/* Get the port of a channel from its ID */
+#define DIO_EDGE_GET_PORT(CHANNEL_ID)	(uint8)(((CHANNEL_ID) & 0xF0) >> 4)
+
+/* Get the pin of a channel in its port from its ID */
+#define DIO_EDGE_GET_PIN(CHANNEL_ID)	(uint8)((CHANNEL_ID) & 0x0F)
+
+/* Check that a channel ID addresses a pin of a port */
+#define DIO_EDGE_CHANNEL_EXISTS(CHANNEL_ID)	\
+	((DIO_EDGE_GET_PORT(CHANNEL_ID) < HW_NO_OF_PORTS) && (DIO_EDGE_GET_PIN(CHANNEL_ID) < 8))
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static Dio_EdgeNotificationType Dio_EdgeNotifications[HW_NO_OF_PORTS][8];	/*!< Notification of every channel */
+
+static const uint8 Dio_EdgeIrqs[HW_NO_OF_PORTS] = {
+	HW_GPIOA_IRQ,
+	HW_GPIOB_IRQ,
+	HW_GPIOC_IRQ,
+	HW_GPIOD_IRQ,
+	HW_GPIOE_IRQ,
+	HW_GPIOF_IRQ
+};	/*!< Interrupt number of every port */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Registers the notification of a channel.
+ *				Removing the notification (NULL_PTR) disables it.
+ *	\param[in] 	ChannelId: 		ID of DIO channel.
+ *	\param[in] 	Notification: 	Function called on the channel interrupt, NULL_PTR to remove it.
+ *	\return		Std_ReturnType:	-	E_OK: The notification is registered.
+ *								-	E_NOT_OK: The channel doesn't exist.
+ */
+Std_ReturnType Dio_EdgeSetNotification(Dio_ChannelType ChannelId, Dio_EdgeNotificationType Notification)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	
+	if(!DIO_EDGE_CHANNEL_EXISTS(ChannelId))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		if(NULL_PTR == Notification)
+		{
+			/* The handler must not find an unmasked channel without notification */
+			(void)Dio_EdgeDisableNotification(ChannelId);
+		}
+		else
+		{
+			/* Keep the channel state */
+		}
+		Dio_EdgeNotifications[DIO_EDGE_GET_PORT(ChannelId)][DIO_EDGE_GET_PIN(ChannelId)] = Notification;
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Enables the notification of a channel.
+ *				An interrupt latched before is discarded, then the channel interrupt
+ *				is unmasked and the interrupt of its port is enabled in the NVIC.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Std_ReturnType:	-	E_OK: The notification is enabled.
+ *								-	E_NOT_OK: The channel doesn't exist or has no notification.
+ */
+Std_ReturnType Dio_EdgeEnableNotification(Dio_ChannelType ChannelId)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	HW_AddressBusSizeType DIO_BaseAddress;
+	uint8 DIO_Port;
+	uint8 DIO_Mask;
+	uint32 DIO_IntState;
+	
+	if((!DIO_EDGE_CHANNEL_EXISTS(ChannelId)) ||
+	   (NULL_PTR == Dio_EdgeNotifications[DIO_EDGE_GET_PORT(ChannelId)][DIO_EDGE_GET_PIN(ChannelId)]))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		DIO_Port = DIO_EDGE_GET_PORT(ChannelId);
+		DIO_Mask = (uint8)(1 << DIO_EDGE_GET_PIN(ChannelId));
+		DIO_BaseAddress = HW_PortsAddresses[DIO_Port];
+	
+		/* GPIOIM is shared by all channels of the port */
+		HW_ENTER_CRITICAL(DIO_IntState);
+		HW_W_8RIG((DIO_BaseAddress + HW_GPIOICR_OFFSET), DIO_Mask);
+		HW_W_8RIG((DIO_BaseAddress + HW_GPIOIM_OFFSET),
+				  HW_R_8RIG(DIO_BaseAddress + HW_GPIOIM_OFFSET) | DIO_Mask);
+		HW_EXIT_CRITICAL(DIO_IntState);
+	
+		/* Set enable register, no read-modify-write needed */
+		HW_W_8RIG(HW_NVIC_EN0_ADDRESS, (uint32)1 << Dio_EdgeIrqs[DIO_Port]);
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Disables the notification of a channel by masking its interrupt.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Std_ReturnType:	-	E_OK: The notification is disabled.
+ *								-	E_NOT_OK: The channel doesn't exist.
+ */
+Std_ReturnType Dio_EdgeDisableNotification(Dio_ChannelType ChannelId)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	HW_AddressBusSizeType DIO_BaseAddress;
+	uint32 DIO_IntState;
+	
+	if(!DIO_EDGE_CHANNEL_EXISTS(ChannelId))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		DIO_BaseAddress = HW_PortsAddresses[DIO_EDGE_GET_PORT(ChannelId)];
+	
+		/* GPIOIM is shared by all channels of the port */
+		HW_ENTER_CRITICAL(DIO_IntState);
+		HW_W_8RIG((DIO_BaseAddress + HW_GPIOIM_OFFSET),
+				  HW_R_8RIG(DIO_BaseAddress + HW_GPIOIM_OFFSET) & ~((uint32)1 << DIO_EDGE_GET_PIN(ChannelId)));
+		HW_EXIT_CRITICAL(DIO_IntState);
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Dispatches the pending interrupts of a port to the notifications of their channels.
+ *				GPIOMIS is read once and cleared by a single GPIOICR write, then only the
+ *				pending channels are visited. Level interrupts stay pending until their
+ *				notification removes the level or disables the notification.
+ *				A pending channel without notification is acknowledged and skipped.
+ *	\param[in] 	PortId: 	ID of DIO Port.
+ *	\return		None.
+ */
+void Dio_EdgeIsr(Dio_PortType PortId)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType DIO_BaseAddress = HW_PortsAddresses[PortId];
+	const Dio_EdgeNotificationType* DIO_Notifications = Dio_EdgeNotifications[PortId];
+	Dio_EdgeNotificationType DIO_Notification;
+	uint32 DIO_Pending;
+	uint8 DIO_Pin;
+	
+	/* Clear before dispatching, an edge during a notification interrupts again */
+	DIO_Pending = (uint32)HW_R_8RIG(DIO_BaseAddress + HW_GPIOMIS_OFFSET) & 0xFF;
+	HW_W_8RIG((DIO_BaseAddress + HW_GPIOICR_OFFSET), DIO_Pending);
+	
+	/* Highest pending pin first */
+	while(0 != DIO_Pending)
+	{
+		DIO_Pin = (uint8)(31 - HW_CLZ(DIO_Pending));
+		DIO_Pending &= ~((uint32)1 << DIO_Pin);
+		DIO_Notification = DIO_Notifications[DIO_Pin];
+		if(NULL_PTR != DIO_Notification)
+		{
+			DIO_Notification((Dio_ChannelType)(((uint8)PortId << 4) | DIO_Pin));
+		}
+		else
+		{
+			/* Unmasked outside DioEdge or removed by a notification of this dispatch,
+			   the interrupt is only acknowledged */
+		}
+	}
+}
+
+/**
+ *	\brief		Interrupt handlers of the GPIO ports, to be placed in the vector table.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_EdgePortA_Handler(void)
+{
+	Dio_EdgeIsr(DIO_PORTA);
+}
+
+void Dio_EdgePortB_Handler(void)
+{
+	Dio_EdgeIsr(DIO_PORTB);
+}
+
+void Dio_EdgePortC_Handler(void)
+{
+	Dio_EdgeIsr(DIO_PORTC);
+}
+
+void Dio_EdgePortD_Handler(void)
+{
+	Dio_EdgeIsr(DIO_PORTD);
+}
+
+void Dio_EdgePortE_Handler(void)
+{
+	Dio_EdgeIsr(DIO_PORTE);
+}
+
+void Dio_EdgePortF_Handler(void)
+{
+	Dio_EdgeIsr(DIO_PORTF);
+}
+#endif /* DioEdgeApi check */
@@ -0,0 +1,79 @@
+/**
+ *  \file	DioEdge.h
+ *  \brief 	Edge (and level) notifications of DIO channels through the GPIO ports interrupts.
+ *  		The interrupt sense of a channel is set by its PORT configuration, a notification
+ *  		is registered per channel and the interrupt handler of a port calls the
+ *  		notifications of its pending channels only.
+ *  		Enabled by DioEdgeApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_EDGE_H_
+#define DIO_EDGE_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioEdgeApi == STD_ON)
+/* Defined data types */
+typedef void (*Dio_EdgeNotificationType)(Dio_ChannelType ChannelId);	/*!< Notification of a channel, called
+																			 from the interrupt of its port */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Registers the notification of a channel.
+ *				Removing the notification (NULL_PTR) disables it.
+ *	\param[in] 	ChannelId: 		ID of DIO channel.
+ *	\param[in] 	Notification: 	Function called on the channel interrupt, NULL_PTR to remove it.
+ *	\return		Std_ReturnType:	-	E_OK: The notification is registered.
+ *								-	E_NOT_OK: The channel doesn't exist.
+ */
+Std_ReturnType Dio_EdgeSetNotification(Dio_ChannelType ChannelId, Dio_EdgeNotificationType Notification);
+
+/**
+ *	\brief		Enables the notification of a channel.
+ *				An interrupt latched before is discarded, then the channel interrupt
+ *				is unmasked and the interrupt of its port is enabled in the NVIC.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Std_ReturnType:	-	E_OK: The notification is enabled.
+ *								-	E_NOT_OK: The channel doesn't exist or has no notification.
+ */
+Std_ReturnType Dio_EdgeEnableNotification(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Disables the notification of a channel by masking its interrupt.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		Std_ReturnType:	-	E_OK: The notification is disabled.
+ *								-	E_NOT_OK: The channel doesn't exist.
+ */
+Std_ReturnType Dio_EdgeDisableNotification(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Dispatches the pending interrupts of a port to the notifications of their channels.
+ *				GPIOMIS is read once and cleared by a single GPIOICR write, then only the
+ *				pending channels are visited. Level interrupts stay pending until their
+ *				notification removes the level or disables the notification.
+ *				A pending channel without notification is acknowledged and skipped.
+ *	\param[in] 	PortId: 	ID of DIO Port.
+ *	\return		None.
+ */
+void Dio_EdgeIsr(Dio_PortType PortId);
+
+/**
+ *	\brief		Interrupt handlers of the GPIO ports, to be placed in the vector table.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_EdgePortA_Handler(void);
+void Dio_EdgePortB_Handler(void);
+void Dio_EdgePortC_Handler(void);
+void Dio_EdgePortD_Handler(void);
+void Dio_EdgePortE_Handler(void);
+void Dio_EdgePortF_Handler(void);
+#endif /* DioEdgeApi check */
+
+#endif /* DIO_EDGE_H_ */
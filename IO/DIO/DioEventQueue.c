@@ -0,0 +1,214 @@
+/**
+ *  \file	DioEventQueue.c
+ *  \brief 	Queue of timestamped edge events of DIO channels.
+ *  		Single producer / single consumer ring: the producer owns the head, the
+ *  		consumer owns the tail and every shared variable has one writer only, so
+ *  		both sides are wait-free and no interrupt is locked.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioEventQueue.h"
+
+#if(DioEventQueueApi == STD_ON)
+/* Macros */
+/* Mask of the ring indices */
+#define DIO_EVENT_QUEUE_MASK	(uint8)(DioEventQueueSize - 1)
+
+/* Get the port of a channel from its ID */
+#define DIO_EVENT_GET_PORT(CHANNEL_ID)	(uint8)(((CHANNEL_ID) & 0xF0) >> 4)
+
+/* Get the index of a channel in the per channel counters from its ID */
+#define DIO_EVENT_GET_INDEX(CHANNEL_ID)	(uint8)((DIO_EVENT_GET_PORT(CHANNEL_ID) << 3) | ((CHANNEL_ID) & 0x07))
+
+/* Check that a channel ID addresses a pin of a port */
+#define DIO_EVENT_CHANNEL_EXISTS(CHANNEL_ID)	\
+	((DIO_EVENT_GET_PORT(CHANNEL_ID) < HW_NO_OF_PORTS) && (((CHANNEL_ID) & 0x0F) < 8))
+
+#if((DioEventQueueSize < 2) || (DioEventQueueSize > 128) || (0 != (DioEventQueueSize & (DioEventQueueSize - 1))))
+#error "DioEventQueueSize shall be a power of two from 2 to 128"
+#endif
+
+/* Private Variables */
+static Dio_EventType Dio_EventBuffer[DioEventQueueSize];	/*!< Events ring */
+static volatile uint8 Dio_EventHead = 0;	/*!< Free running index of the next pushed event, written by the producer */
+static volatile uint8 Dio_EventTail = 0;	/*!< Free running index of the next popped event, written by the consumer */
+static Dio_EventQueueStatsType Dio_EventStats;	/*!< Statistics, written by the producer */
+#if(DioEventQueueCoalesce == STD_ON)
+static uint8 Dio_EventPushed[HW_NO_OF_PORTS << 3];			/*!< Events pushed per channel, written by the producer */
+static volatile uint8 Dio_EventPopped[HW_NO_OF_PORTS << 3];	/*!< Events popped per channel, written by the consumer */
+#endif /* DioEventQueueCoalesce check */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Empties the queue, clears its statistics and enables the cycle counter
+ *				used for the timestamps. To be called before the events are pushed.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_EventQueueInit(void)
+{
+#if(DioEventQueueCoalesce == STD_ON)
+	/* Needed Variables */
+	uint8 DIO_Index;
+	
+	for(DIO_Index = 0; DIO_Index < (uint8)(HW_NO_OF_PORTS << 3); DIO_Index++)
+	{
+		Dio_EventPushed[DIO_Index] = 0;
+		Dio_EventPopped[DIO_Index] = 0;
+	}
+#endif /* DioEventQueueCoalesce check */
+	Dio_EventHead = 0;
+	Dio_EventTail = 0;
+	Dio_EventStats.Dio_Overflows = 0;
+	Dio_EventStats.Dio_Coalesced = 0;
+	Dio_EventStats.Dio_HighWater = 0;
+	HW_CYCLE_COUNTER_ENABLE();
+}
+
+/**
+ *	\brief		Pushes an event, producer side.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\param[in] 	Edge: 		Edge of the channel.
+ *	\param[in] 	Timestamp: 	Time of the edge.
+ *	\return		Std_ReturnType:	-	E_OK: The event is queued (or coalesced).
+ *								-	E_NOT_OK: The channel doesn't exist or the queue is full,
+ *											  the event is dropped.
+ */
+Std_ReturnType Dio_EventQueuePush(Dio_ChannelType ChannelId, Dio_EdgeType Edge, uint32 Timestamp)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_Head = Dio_EventHead;
+	uint8 DIO_Used;
+	Dio_EventType* DIO_EventPtr;
+	
+	if(!DIO_EVENT_CHANNEL_EXISTS(ChannelId))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+#if(DioEventQueueCoalesce == STD_ON)
+	else if(Dio_EventPushed[DIO_EVENT_GET_INDEX(ChannelId)] != Dio_EventPopped[DIO_EVENT_GET_INDEX(ChannelId)])
+	{
+		/* An event of the channel is still queued, it keeps the first edge */
+		Dio_EventStats.Dio_Coalesced++;
+	}
+#endif /* DioEventQueueCoalesce check */
+	else
+	{
+		DIO_Used = (uint8)(DIO_Head - Dio_EventTail);
+		if(DIO_Used >= (uint8)DioEventQueueSize)
+		{
+			Dio_EventStats.Dio_Overflows++;
+			DIO_RetData = E_NOT_OK;
+		}
+		else
+		{
+			DIO_EventPtr = &Dio_EventBuffer[DIO_Head & DIO_EVENT_QUEUE_MASK];
+			DIO_EventPtr->Dio_Timestamp = Timestamp;
+			DIO_EventPtr->Dio_ChannelId = ChannelId;
+			DIO_EventPtr->Dio_Edge = Edge;
+#if(DioEventQueueCoalesce == STD_ON)
+			Dio_EventPushed[DIO_EVENT_GET_INDEX(ChannelId)]++;
+#endif /* DioEventQueueCoalesce check */
+	
+			/* The event is written before it is published */
+			HW_MEMORY_BARRIER();
+			Dio_EventHead = (uint8)(DIO_Head + 1);
+	
+			DIO_Used++;
+			if(DIO_Used > Dio_EventStats.Dio_HighWater)
+			{
+				Dio_EventStats.Dio_HighWater = DIO_Used;
+			}
+			else
+			{
+				/* High water mark unchanged */
+			}
+		}
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Pushes the current edge of a channel stamped with the cycle counter.
+ *				Matches the notifications of DioEdge, to be registered for the channels
+ *				whose edges are processed by the task.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		None.
+ */
+void Dio_EventQueueNotification(Dio_ChannelType ChannelId)
+{
+	/* Needed Variables */
+	uint32 DIO_Timestamp = HW_CYCLE_COUNT();	/* Stamped first, as close to the edge as possible */
+	
+	(void)Dio_EventQueuePush(ChannelId,
+							 (STD_HIGH == Dio_ReadChannel(ChannelId)) ? DIO_EDGE_RISING : DIO_EDGE_FALLING,
+							 DIO_Timestamp);
+}
+
+/**
+ *	\brief		Pops a batch of events in arrival order, consumer side.
+ *	\param[out] EventsPtr: 	Pointer to the popped events.
+ *	\param[in] 	MaxEvents: 	Maximum number of events to be popped.
+ *	\return		uint8:		Number of popped events.
+ */
+uint8 Dio_EventQueueDrain(Dio_EventType* EventsPtr, uint8 MaxEvents)
+{
+	/* Needed Variables */
+	uint8 DIO_Tail = Dio_EventTail;
+	const Dio_EventType* DIO_EventPtr;
+	uint8 DIO_Available;
+	uint8 DIO_Count = 0;
+	
+	if(NULL_PTR != EventsPtr)
+	{
+		DIO_Available = (uint8)(Dio_EventHead - DIO_Tail);
+	
+		/* The events are read after their publication */
+		HW_MEMORY_BARRIER();
+		while((DIO_Count < MaxEvents) && (DIO_Count < DIO_Available))
+		{
+			DIO_EventPtr = &Dio_EventBuffer[(uint8)(DIO_Tail + DIO_Count) & DIO_EVENT_QUEUE_MASK];
+#if(DioEventQueueCoalesce == STD_ON)
+			/* Edges of the channel from now on are queued again, the slot can't be reused
+			   before the tail is released */
+			Dio_EventPopped[DIO_EVENT_GET_INDEX(DIO_EventPtr->Dio_ChannelId)]++;
+#endif /* DioEventQueueCoalesce check */
+			EventsPtr[DIO_Count] = *DIO_EventPtr;
+			DIO_Count++;
+		}
+	
+		/* The whole batch is released at once, after its events are read */
+		HW_MEMORY_BARRIER();
+		Dio_EventTail = (uint8)(DIO_Tail + DIO_Count);
+	}
+	else
+	{
+		/* Nowhere to store the events */
+	}
+	
+	return DIO_Count;
+}
+
+/**
+ *	\brief		Returns the statistics of the queue.
+ *	\param[out] StatsPtr: 	Pointer to the statistics.
+ *	\return		None.
+ */
+void Dio_EventQueueGetStats(Dio_EventQueueStatsType* StatsPtr)
+{
+	if(NULL_PTR != StatsPtr)
+	{
+		StatsPtr->Dio_Overflows = Dio_EventStats.Dio_Overflows;
+		StatsPtr->Dio_Coalesced = Dio_EventStats.Dio_Coalesced;
+		StatsPtr->Dio_HighWater = Dio_EventStats.Dio_HighWater;
+	}
+	else
+	{
+		/* Nowhere to store the statistics */
+	}
+}
+#endif /* DioEventQueueApi check */
@@ -0,0 +1,89 @@
+/**
+ *  \file	DioEventQueue.h
+ *  \brief 	Queue of timestamped edge events of DIO channels. The GPIO interrupts push
+ *  		the events and a cyclic task drains them in batches, so the application
+ *  		processing runs outside of the interrupts.
+ *  		The queue has a single producer (the interrupts of the GPIO ports, which don't
+ *  		preempt each other) and a single consumer (the task), none of them waits or
+ *  		locks interrupts.
+ *  		Enabled by DioEventQueueApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_EVENT_QUEUE_H_
+#define DIO_EVENT_QUEUE_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioEventQueueApi == STD_ON)
+/* Macros */
+/* Dio_EdgeType Macros */
+#define DIO_EDGE_FALLING	0x00	/*!< Channel went low */
+#define DIO_EDGE_RISING		0x01	/*!< Channel went high */
+
+/* Defined data types */
+typedef uint8 Dio_EdgeType;	/*!< Edge of an event, DIO_EDGE_FALLING or DIO_EDGE_RISING */
+
+typedef struct{
+	uint32			Dio_Timestamp;	/*!< Time of the edge (core clock cycles) */
+	Dio_ChannelType	Dio_ChannelId;	/*!< Channel of the edge */
+	Dio_EdgeType	Dio_Edge;		/*!< Edge of the channel */
+}Dio_EventType;	/*!< Edge event */
+
+typedef struct{
+	uint32	Dio_Overflows;	/*!< Events dropped because the queue was full */
+	uint32	Dio_Coalesced;	/*!< Edges merged into the queued event of their channel */
+	uint8	Dio_HighWater;	/*!< Maximum number of queued events */
+}Dio_EventQueueStatsType;	/*!< Statistics of the queue */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Empties the queue, clears its statistics and enables the cycle counter
+ *				used for the timestamps. To be called before the events are pushed.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_EventQueueInit(void);
+
+/**
+ *	\brief		Pushes an event, producer side.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\param[in] 	Edge: 		Edge of the channel.
+ *	\param[in] 	Timestamp: 	Time of the edge.
+ *	\return		Std_ReturnType:	-	E_OK: The event is queued (or coalesced).
+ *								-	E_NOT_OK: The channel doesn't exist or the queue is full,
+ *											  the event is dropped.
+ */
+Std_ReturnType Dio_EventQueuePush(Dio_ChannelType ChannelId, Dio_EdgeType Edge, uint32 Timestamp);
+
+/**
+ *	\brief		Pushes the current edge of a channel stamped with the cycle counter.
+ *				Matches the notifications of DioEdge, to be registered for the channels
+ *				whose edges are processed by the task.
+ *	\param[in] 	ChannelId: 	ID of DIO channel.
+ *	\return		None.
+ */
+void Dio_EventQueueNotification(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Pops a batch of events in arrival order, consumer side.
+ *	\param[out] EventsPtr: 	Pointer to the popped events.
+ *	\param[in] 	MaxEvents: 	Maximum number of events to be popped.
+ *	\return		uint8:		Number of popped events.
+ */
+uint8 Dio_EventQueueDrain(Dio_EventType* EventsPtr, uint8 MaxEvents);
+
+/**
+ *	\brief		Returns the statistics of the queue.
+ *	\param[out] StatsPtr: 	Pointer to the statistics.
+ *	\return		None.
+ */
+void Dio_EventQueueGetStats(Dio_EventQueueStatsType* StatsPtr);
+#endif /* DioEventQueueApi check */
+
+#endif /* DIO_EVENT_QUEUE_H_ */
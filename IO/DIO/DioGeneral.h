@@ -18,6 +18,34 @@
 #define DioDevErrorDetect		STD_OFF	/*!< Switches the development error detection and notification on or off */
 #define DioFlipChannelApi		STD_ON	/*!< Adds / removes the service Dio_FlipChannel() from the code */
 #define DioMaskedWritePortApi	STD_OFF	/*!< Adds / removes the service Dio_MaskedWritePort() from the code */
+#define DioChannelListApi		STD_ON	/*!< Adds / removes the batched channels services (lists and channel sets) from the code */
+#define DioChannelSetMaxSize	32		/*!< Maximum number of channels in a channel set */
+#define DioReadAllPortsApi		STD_ON	/*!< Adds / removes the service Dio_ReadAllPorts() from the code */
+#define DioSnapshotSkewMeasure	STD_OFF	/*!< Dio_ReadAllPorts() measures the cycles between its first and last port reads
+												 with the DWT cycle counter, recorded as the "Dio_ReadAllPorts skew" sample
+												 of the registers access accounting (TivaAccounting.h) */
+#define DioDebounceApi			STD_ON	/*!< Adds / removes the debounce services (DioDebounce.c) from the code */
+#define DioDebounceCounterBits	3		/*!< Bits of the debounce counters, thresholds range from 1 to 2^bits - 1 ticks */
+#define DioEdgeApi				STD_ON	/*!< Adds / removes the edge notification services and the GPIO ports interrupt
+												 handlers (DioEdge.c) from the code */
+#define DioEventQueueApi		STD_ON	/*!< Adds / removes the timestamped edge events queue (DioEventQueue.c) from the code */
+#define DioEventQueueSize		32		/*!< Number of events the queue holds, a power of two from 2 to 128 */
+#define DioEventQueueCoalesce	STD_OFF	/*!< A channel has at most one queued event, its further edges are counted
+												 as coalesced until the event is drained */
+#define DioPatternApi			STD_ON	/*!< Adds / removes the timer driven port pattern generator (DioPattern.c) from the code */
+#define DioCaptureApi			STD_ON	/*!< Adds / removes the run-length compressed ports capture (DioCapture.c) from the code */
+#define DioCaptureRecords		512		/*!< Number of records of the capture ring, 8 bytes each */
+#define DioStreamApi			STD_ON	/*!< Adds / removes the uDMA port output streaming (DioStream.c) from the code */
+#define DioStreamDmaChannel		18		/*!< uDMA channel of the stream, triggered by the timer mapped to it */
+#define DioStreamDmaEncoding	0		/*!< Encoding of the channel selecting its trigger (channel 18 encoding 0 is Timer 0A) */
+#define DioSoftSpiApi			STD_ON	/*!< Adds / removes the bit-banged SPI master (DioSoftSpi.c) from the code */
+#define DioSoftI2cApi			STD_ON	/*!< Adds / removes the bit-banged I2C master (DioSoftI2c.c) from the code */
+#define DioLanesApi				STD_ON	/*!< Adds / removes the lane-parallel serial output (DioLanes.c) from the code */
 #define DioVersionInfoApi		STD_OFF	/*!< Adds / removes the service Dio_GetVersionInfo() from the code */
+#define DioBitBandAccess		STD_OFF	/*!< Channels are read and written through the bit-band alias of their GPIODATA bit
+												 instead of the GPIODATA address masked to the pin,
+												 needs DioShadowRegisters off (checked at compile time) */
+#define DioShadowRegisters		STD_OFF	/*!< Keeps a RAM shadow of the ports configuration and output data registers,
+												 reads are served from RAM where legal and unchanged writes are skipped */
 
 #endif /* DIO_GENERAL_H_ */
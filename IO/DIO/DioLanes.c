@@ -0,0 +1,222 @@
+/**
+ *  \file	DioLanes.c
+ *  \brief 	Lane-parallel serial output.
+ *  		The 8x8 bits transpose is done on two 32 bits words by three delta swaps
+ *  		(bits, pairs then nibbles), so a byte of the 8 lanes costs a handful of
+ *  		shifts and masks instead of 64 bit extractions. Host builds having SSE2
+ *  		transpose two bytes of the lanes at once with byte sign masks.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioLanes.h"
+#include "DioShadow.h"	/* Shadowed access to the output data registers */
+
+#if(DioLanesApi == STD_ON)
+/* Macros */
+/* Host builds only, the target has no SIMD unit */
+#if(!defined(__arm__) && defined(__SSE2__))
+#include <emmintrin.h>
+#define DIO_LANES_SIMD		STD_ON
+#else
+#define DIO_LANES_SIMD		STD_OFF
+#endif
+
+/* Delta swap of the bits of WORD selected by MASK with the bits SHIFT places above them */
+#define DIO_LANES_DELTA_SWAP(WORD, MASK, SHIFT)	\
+	do{	\
+		DIO_Swap = ((WORD) ^ ((WORD) >> (SHIFT))) & (MASK);	\
+		(WORD) = (WORD) ^ DIO_Swap ^ (DIO_Swap << (SHIFT));	\
+	}while(0)
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static const uint8 Dio_LanesIdle = 0x00;	/*!< Byte read by every lane without stream */
+
+#if(DIO_LANES_SIMD == STD_ON)
+/* Private Functions Proto Types */
+/**
+ *	\brief		Transposes two bytes of every lane into the sixteen port images of their bits.
+ *	\param[in] 	BytesPtr: 	Pointer to 16 bytes, bytes N and 8 + N are sent on lane N.
+ *	\param[out] ImagesPtr: 	Pointer to 16 images, the images of bytes 0 to 7 then of bytes 8 to 15.
+ *	\return		None.
+ */
+static void Dio_LanesTransposePair(const uint8* BytesPtr, Dio_PortLevelType* ImagesPtr);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Transposes two bytes of every lane into the sixteen port images of their bits.
+ *	\param[in] 	BytesPtr: 	Pointer to 16 bytes, bytes N and 8 + N are sent on lane N.
+ *	\param[out] ImagesPtr: 	Pointer to 16 images, the images of bytes 0 to 7 then of bytes 8 to 15.
+ *	\return		None.
+ */
+static void Dio_LanesTransposePair(const uint8* BytesPtr, Dio_PortLevelType* ImagesPtr)
+{
+	/* Needed Variables */
+	__m128i DIO_Bytes = _mm_loadu_si128((const __m128i*)BytesPtr);
+	uint32 DIO_Signs;
+	uint8 DIO_Bit;
+	
+	/* The sign mask gathers the MSB of every byte, doubling the bytes brings the next bit up */
+	for(DIO_Bit = 0; DIO_Bit < 8; DIO_Bit++)
+	{
+		DIO_Signs = (uint32)_mm_movemask_epi8(DIO_Bytes);
+		ImagesPtr[DIO_Bit] = (Dio_PortLevelType)DIO_Signs;
+		ImagesPtr[DIO_Bit + 8] = (Dio_PortLevelType)(DIO_Signs >> 8);
+		DIO_Bytes = _mm_add_epi8(DIO_Bytes, DIO_Bytes);
+	}
+}
+#endif /* DIO_LANES_SIMD check */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Transposes one byte of every lane into the eight port images of its bits.
+ *	\param[in] 	BytesPtr: 	Pointer to 8 bytes, byte N is sent on lane N.
+ *	\param[out] ImagesPtr: 	Pointer to 8 images, image K holds bit 7 - K of every lane.
+ *	\return		None.
+ */
+void Dio_LanesTranspose(const uint8* BytesPtr, Dio_PortLevelType* ImagesPtr)
+{
+	/* Needed Variables */
+	uint32 DIO_High;
+	uint32 DIO_Low;
+	uint32 DIO_Swap;
+	
+	/* Rows of the matrix from lane 7 down to lane 0, so bit N of every image is lane N */
+	DIO_High = ((uint32)BytesPtr[7] << 24) | ((uint32)BytesPtr[6] << 16) | ((uint32)BytesPtr[5] << 8) | BytesPtr[4];
+	DIO_Low = ((uint32)BytesPtr[3] << 24) | ((uint32)BytesPtr[2] << 16) | ((uint32)BytesPtr[1] << 8) | BytesPtr[0];
+	
+	/* Transpose the 2x2 blocks of bits, then the 2x2 blocks of pairs */
+	DIO_LANES_DELTA_SWAP(DIO_High, 0x00AA00AAUL, 7);
+	DIO_LANES_DELTA_SWAP(DIO_Low, 0x00AA00AAUL, 7);
+	DIO_LANES_DELTA_SWAP(DIO_High, 0x0000CCCCUL, 14);
+	DIO_LANES_DELTA_SWAP(DIO_Low, 0x0000CCCCUL, 14);
+	
+	/* Swap the off-diagonal 4x4 blocks of nibbles between the words */
+	DIO_Swap = (DIO_High & 0xF0F0F0F0UL) | ((DIO_Low >> 4) & 0x0F0F0F0FUL);
+	DIO_Low = ((DIO_High << 4) & 0xF0F0F0F0UL) | (DIO_Low & 0x0F0F0F0FUL);
+	DIO_High = DIO_Swap;
+	
+	ImagesPtr[0] = (Dio_PortLevelType)(DIO_High >> 24);
+	ImagesPtr[1] = (Dio_PortLevelType)(DIO_High >> 16);
+	ImagesPtr[2] = (Dio_PortLevelType)(DIO_High >> 8);
+	ImagesPtr[3] = (Dio_PortLevelType)DIO_High;
+	ImagesPtr[4] = (Dio_PortLevelType)(DIO_Low >> 24);
+	ImagesPtr[5] = (Dio_PortLevelType)(DIO_Low >> 16);
+	ImagesPtr[6] = (Dio_PortLevelType)(DIO_Low >> 8);
+	ImagesPtr[7] = (Dio_PortLevelType)DIO_Low;
+}
+
+/**
+ *	\brief		Transposes the byte streams of the lanes into port images.
+ *	\param[in] 	LanesPtr: 	Pointer to 8 lane streams of Length bytes each, a NULL_PTR lane is
+ *							held low.
+ *	\param[out] ImagesPtr: 	Pointer to 8 * Length images, the images of byte I start at 8 * I.
+ *	\param[in] 	Length: 	Number of bytes of every lane.
+ *	\return		Std_ReturnType:	-	E_OK: The images are written.
+ *								-	E_NOT_OK: NULL pointer.
+ */
+Std_ReturnType Dio_LanesEncode(const uint8* const* LanesPtr, Dio_PortLevelType* ImagesPtr, uint16 Length)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	const uint8* DIO_Lanes[DIO_LANES_NO_OF_LANES];
+	uint8 DIO_Steps[DIO_LANES_NO_OF_LANES];
+	uint8 DIO_Bytes[2 * DIO_LANES_NO_OF_LANES];
+	uint16 DIO_Index = 0;
+	uint8 DIO_Lane;
+	
+	if((NULL_PTR == LanesPtr) || (NULL_PTR == ImagesPtr))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* A lane without stream keeps reading the idle byte */
+		for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+		{
+			DIO_Lanes[DIO_Lane] = (NULL_PTR != LanesPtr[DIO_Lane]) ? LanesPtr[DIO_Lane] : &Dio_LanesIdle;
+			DIO_Steps[DIO_Lane] = (NULL_PTR != LanesPtr[DIO_Lane]) ? 1 : 0;
+		}
+	
+#if(DIO_LANES_SIMD == STD_ON)
+		for(; (DIO_Index + 1) < Length; DIO_Index += 2)
+		{
+			for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+			{
+				DIO_Bytes[DIO_Lane] = DIO_Lanes[DIO_Lane][0];
+				DIO_Bytes[DIO_Lane + DIO_LANES_NO_OF_LANES] = DIO_Lanes[DIO_Lane][DIO_Steps[DIO_Lane]];
+				DIO_Lanes[DIO_Lane] += 2 * DIO_Steps[DIO_Lane];
+			}
+			Dio_LanesTransposePair(DIO_Bytes, &ImagesPtr[(uint32)DIO_Index << 3]);
+		}
+#endif /* DIO_LANES_SIMD check */
+	
+		for(; DIO_Index < Length; DIO_Index++)
+		{
+			for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+			{
+				DIO_Bytes[DIO_Lane] = *DIO_Lanes[DIO_Lane];
+				DIO_Lanes[DIO_Lane] += DIO_Steps[DIO_Lane];
+			}
+			Dio_LanesTranspose(DIO_Bytes, &ImagesPtr[(uint32)DIO_Index << 3]);
+		}
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Plays port images on the masked pins of a port, one store per image with a
+ *				fixed delay between the stores. Interrupts taken during the loop stretch the
+ *				bit time they fall in, jitter-free timing is given by the uDMA stream.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Pins driven by the images, the other pins keep their levels.
+ *	\param[in] 	ImagesPtr: 	Pointer to the images.
+ *	\param[in] 	Count: 		Number of images.
+ *	\param[in] 	Delay: 		Delay loops after every store, 0 runs at the store rate.
+ *	\return		Std_ReturnType:	-	E_OK: The images are played.
+ *								-	E_NOT_OK: NULL pointer or the port doesn't exist.
+ */
+Std_ReturnType Dio_LanesWrite(Dio_PortType PortId, Dio_PortLevelType Mask, const Dio_PortLevelType* ImagesPtr,
+							  uint16 Count, uint16 Delay)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	HW_AddressBusSizeType DIO_Address;
+	volatile uint16 DIO_Loops;
+	uint16 DIO_Index;
+	
+	if((NULL_PTR == ImagesPtr) || (PortId >= HW_NO_OF_PORTS))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* The masked address leaves the other pins of the port untouched without a read */
+		DIO_Address = HW_PortsAddresses[PortId] + HW_GPIODATA_OFFSET + ((HW_AddressBusSizeType)Mask << 2);
+		for(DIO_Index = 0; DIO_Index < Count; DIO_Index++)
+		{
+			HW_W_8RIG(DIO_Address, ImagesPtr[DIO_Index]);
+			for(DIO_Loops = Delay; 0 != DIO_Loops; DIO_Loops--)
+			{
+				/* Bit time */
+			}
+		}
+	
+		/* The last image is left on the pins, the shadow learns it (the store is repeated at most) */
+		if(0 != Count)
+		{
+			Dio_ShadowWriteData((uint8)PortId, Mask, ImagesPtr[Count - 1]);
+		}
+		else
+		{
+			/* Nothing played */
+		}
+	}
+	
+	return DIO_RetData;
+}
+#endif /* DioLanesApi check */
@@ -0,0 +1,64 @@
+/**
+ *  \file	DioLanes.h
+ *  \brief 	Lane-parallel serial output: up to eight single-wire serial lanes (LED strips,
+ *  		shift-register chains, ...) are driven together by the pins of one port,
+ *  		lane N on pin N.
+ *  		The byte streams of the lanes are transposed into port images, image K of a
+ *  		byte holds bit 7 - K of every lane (MSB first), so each bit time of all lanes
+ *  		is a single port store. The images can be played by Dio_LanesWrite(), by the
+ *  		pattern generator or by the uDMA port output stream (DioStream.h).
+ *  		Enabled by DioLanesApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_LANES_H_
+#define DIO_LANES_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioLanesApi == STD_ON)
+/* Macros */
+#define DIO_LANES_NO_OF_LANES	8	/*!< Lanes of a port, one per pin */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Transposes one byte of every lane into the eight port images of its bits.
+ *	\param[in] 	BytesPtr: 	Pointer to 8 bytes, byte N is sent on lane N.
+ *	\param[out] ImagesPtr: 	Pointer to 8 images, image K holds bit 7 - K of every lane.
+ *	\return		None.
+ */
+void Dio_LanesTranspose(const uint8* BytesPtr, Dio_PortLevelType* ImagesPtr);
+
+/**
+ *	\brief		Transposes the byte streams of the lanes into port images.
+ *	\param[in] 	LanesPtr: 	Pointer to 8 lane streams of Length bytes each, a NULL_PTR lane is
+ *							held low.
+ *	\param[out] ImagesPtr: 	Pointer to 8 * Length images, the images of byte I start at 8 * I.
+ *	\param[in] 	Length: 	Number of bytes of every lane.
+ *	\return		Std_ReturnType:	-	E_OK: The images are written.
+ *								-	E_NOT_OK: NULL pointer.
+ */
+Std_ReturnType Dio_LanesEncode(const uint8* const* LanesPtr, Dio_PortLevelType* ImagesPtr, uint16 Length);
+
+/**
+ *	\brief		Plays port images on the masked pins of a port, one store per image with a
+ *				fixed delay between the stores. Interrupts taken during the loop stretch the
+ *				bit time they fall in, jitter-free timing is given by the uDMA stream.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Pins driven by the images, the other pins keep their levels.
+ *	\param[in] 	ImagesPtr: 	Pointer to the images.
+ *	\param[in] 	Count: 		Number of images.
+ *	\param[in] 	Delay: 		Delay loops after every store, 0 runs at the store rate.
+ *	\return		Std_ReturnType:	-	E_OK: The images are played.
+ *								-	E_NOT_OK: NULL pointer or the port doesn't exist.
+ */
+Std_ReturnType Dio_LanesWrite(Dio_PortType PortId, Dio_PortLevelType Mask, const Dio_PortLevelType* ImagesPtr,
+							  uint16 Count, uint16 Delay);
+#endif /* DioLanesApi check */
+
+#endif /* DIO_LANES_H_ */
@@ -0,0 +1,190 @@
+/**
+ *  \file	DioPattern.c
+ *  \brief 	Timer driven port pattern generator.
+ *  		The task side (load, stop) and the tick side only share variables having a
+ *  		single writer each, so loading never locks the timer interrupt.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioPattern.h"
+#include "DioShadow.h"	/* Shadowed access to the output data registers */
+
+#if(DioPatternApi == STD_ON)
+/* Private Variables */
+/* Written by the task */
+static const Dio_PatternType* volatile Dio_PatternLoaded = NULL_PTR;	/*!< Last loaded pattern */
+static volatile uint8 Dio_PatternLoadCount = 0;		/*!< Number of loads */
+static volatile uint8 Dio_PatternStopCount = 0;		/*!< Number of stop requests */
+/* Written by the tick */
+static const Dio_PatternType* Dio_PatternActive = NULL_PTR;	/*!< Playing pattern, NULL_PTR if idle */
+static uint16 Dio_PatternStep = 0;							/*!< Next step of the playing pattern */
+static uint16 Dio_PatternWait = 0;							/*!< Ticks until the next step */
+static volatile uint8 Dio_PatternStartCount = 0;			/*!< Number of loads started */
+static uint8 Dio_PatternStoppedCount = 0;					/*!< Number of stop requests served */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Stops the generator and discards any loaded pattern.
+ *				To be called before the timer calling Dio_PatternTick() is started.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_PatternInit(void)
+{
+	Dio_PatternLoaded = NULL_PTR;
+	Dio_PatternActive = NULL_PTR;
+	Dio_PatternStep = 0;
+	Dio_PatternWait = 0;
+	Dio_PatternStartCount = Dio_PatternLoadCount;
+	Dio_PatternStoppedCount = Dio_PatternStopCount;
+}
+
+/**
+ *	\brief		Loads a pattern. It starts at the next tick if the generator is idle, otherwise
+ *				at the end of the current pass. The steps of the current pattern may be changed
+ *				only once Dio_PatternIsLoadPending() returns FALSE.
+ *	\param[in] 	PatternPtr: 	Pointer to the pattern, it has to stay valid while it plays.
+ *	\return		Std_ReturnType:	-	E_OK: The pattern is loaded.
+ *								-	E_NOT_OK: NULL pointer, empty pattern, a step port doesn't exist
+ *											  or a previous load is still pending.
+ */
+Std_ReturnType Dio_PatternLoad(const Dio_PatternType* PatternPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint16 DIO_Index;
+	
+	if((NULL_PTR == PatternPtr) || (NULL_PTR == PatternPtr->Dio_Steps) || (0 == PatternPtr->Dio_NoOfSteps) ||
+	   (TRUE == Dio_PatternIsLoadPending()))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* Validated once here, the tick doesn't check the steps */
+		for(DIO_Index = 0; (DIO_Index < PatternPtr->Dio_NoOfSteps) && (E_OK == DIO_RetData); DIO_Index++)
+		{
+			if(PatternPtr->Dio_Steps[DIO_Index].Dio_Port >= HW_NO_OF_PORTS)
+			{
+				DIO_RetData = E_NOT_OK;
+			}
+			else
+			{
+				/* Step port exists */
+			}
+		}
+	
+		if(E_OK == DIO_RetData)
+		{
+			/* The pattern is written before the load is published */
+			Dio_PatternLoaded = PatternPtr;
+			HW_MEMORY_BARRIER();
+			Dio_PatternLoadCount++;
+		}
+		else
+		{
+			/* Pattern rejected */
+		}
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Stops the playing pattern at the next tick, the pins keep their levels.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_PatternStop(void)
+{
+	Dio_PatternStopCount++;
+}
+
+/**
+ *	\brief		Returns whether the last loaded pattern is still waiting to start.
+ *	\param		None.
+ *	\return		boolean:	-	TRUE: The pattern hasn't started yet.
+ *							-	FALSE: The pattern started, the previous one is released.
+ */
+boolean Dio_PatternIsLoadPending(void)
+{
+	return (Dio_PatternLoadCount != Dio_PatternStartCount) ? TRUE : FALSE;
+}
+
+/**
+ *	\brief		Generator tick, to be called from the periodic timer interrupt.
+ *				Writes the steps which are due, one masked GPIODATA store per step.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_PatternTick(void)
+{
+	/* Needed Variables */
+	const Dio_PatternStepType* DIO_StepPtr;
+	uint16 DIO_Written = 0;
+	
+	if(Dio_PatternStopCount != Dio_PatternStoppedCount)
+	{
+		Dio_PatternStoppedCount = Dio_PatternStopCount;
+		Dio_PatternActive = NULL_PTR;
+	}
+	else
+	{
+		/* No stop request */
+	}
+	
+	if(NULL_PTR != Dio_PatternActive)
+	{
+		Dio_PatternWait = (0 != Dio_PatternWait) ? (uint16)(Dio_PatternWait - 1) : 0;
+	}
+	else
+	{
+		/* Idle, a loaded pattern starts at once */
+		Dio_PatternStep = 0;
+		Dio_PatternWait = 0;
+		if(TRUE == Dio_PatternIsLoadPending())
+		{
+			Dio_PatternActive = Dio_PatternLoaded;
+			Dio_PatternStartCount = Dio_PatternLoadCount;
+		}
+		else
+		{
+			/* Nothing to play */
+		}
+	}
+	
+	/* Write the due steps, at most a whole pass per tick */
+	while((NULL_PTR != Dio_PatternActive) && (0 == Dio_PatternWait) &&
+		  (DIO_Written < Dio_PatternActive->Dio_NoOfSteps))
+	{
+		if(Dio_PatternStep >= Dio_PatternActive->Dio_NoOfSteps)
+		{
+			/* End of the pass, the loaded pattern replaces the current one */
+			Dio_PatternStep = 0;
+			if(TRUE == Dio_PatternIsLoadPending())
+			{
+				Dio_PatternActive = Dio_PatternLoaded;
+				Dio_PatternStartCount = Dio_PatternLoadCount;
+			}
+			else if(FALSE == Dio_PatternActive->Dio_Repeat)
+			{
+				Dio_PatternActive = NULL_PTR;
+			}
+			else
+			{
+				/* Replay the pattern */
+			}
+		}
+		else
+		{
+			DIO_StepPtr = &Dio_PatternActive->Dio_Steps[Dio_PatternStep];
+			Dio_ShadowWriteData((uint8)DIO_StepPtr->Dio_Port, DIO_StepPtr->Dio_Mask, DIO_StepPtr->Dio_Level);
+			Dio_PatternWait = DIO_StepPtr->Dio_Delay;
+			Dio_PatternStep++;
+			DIO_Written++;
+		}
+	}
+}
+#endif /* DioPatternApi check */
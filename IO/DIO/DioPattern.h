@@ -0,0 +1,82 @@
+/**
+ *  \file	DioPattern.h
+ *  \brief 	Timer driven port pattern generator. A pattern is a buffer of steps, each step
+ *  		stores levels to the masked pins of a port then waits a number of timer ticks.
+ *  		The pattern is replayed by Dio_PatternTick() from a periodic timer, so its timing
+ *  		doesn't depend on the application loops.
+ *  		A new pattern can be loaded while the current one plays, it replaces the current
+ *  		one at the end of its pass so a pass is never mixed from two patterns.
+ *  		Enabled by DioPatternApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_PATTERN_H_
+#define DIO_PATTERN_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioPatternApi == STD_ON)
+/* Defined data types */
+typedef struct{
+	Dio_PortType		Dio_Port;	/*!< Port of the step */
+	Dio_PortLevelType	Dio_Mask;	/*!< Pins written by the step */
+	Dio_PortLevelType	Dio_Level;	/*!< Levels of the masked pins */
+	uint16				Dio_Delay;	/*!< Ticks from this step to the next one, 0 writes the next step in the same tick */
+}Dio_PatternStepType;	/*!< Step of a pattern */
+
+typedef struct{
+	const Dio_PatternStepType*	Dio_Steps;		/*!< Steps of the pattern */
+	uint16						Dio_NoOfSteps;	/*!< Number of steps */
+	boolean						Dio_Repeat;		/*!< TRUE to replay the pattern until it is replaced or stopped */
+}Dio_PatternType;	/*!< Pattern */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Stops the generator and discards any loaded pattern.
+ *				To be called before the timer calling Dio_PatternTick() is started.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_PatternInit(void);
+
+/**
+ *	\brief		Loads a pattern. It starts at the next tick if the generator is idle, otherwise
+ *				at the end of the current pass. The steps of the current pattern may be changed
+ *				only once Dio_PatternIsLoadPending() returns FALSE.
+ *	\param[in] 	PatternPtr: 	Pointer to the pattern, it has to stay valid while it plays.
+ *	\return		Std_ReturnType:	-	E_OK: The pattern is loaded.
+ *								-	E_NOT_OK: NULL pointer, empty pattern, a step port doesn't exist
+ *											  or a previous load is still pending.
+ */
+Std_ReturnType Dio_PatternLoad(const Dio_PatternType* PatternPtr);
+
+/**
+ *	\brief		Stops the playing pattern at the next tick, the pins keep their levels.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_PatternStop(void);
+
+/**
+ *	\brief		Returns whether the last loaded pattern is still waiting to start.
+ *	\param		None.
+ *	\return		boolean:	-	TRUE: The pattern hasn't started yet.
+ *							-	FALSE: The pattern started, the previous one is released.
+ */
+boolean Dio_PatternIsLoadPending(void);
+
+/**
+ *	\brief		Generator tick, to be called from the periodic timer interrupt.
+ *				Writes the steps which are due, one masked GPIODATA store per step.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_PatternTick(void);
+#endif /* DioPatternApi check */
+
+#endif /* DIO_PATTERN_H_ */
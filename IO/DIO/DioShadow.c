@@ -0,0 +1,285 @@
+/**
+ *  \file	DioShadow.c
+ *  \brief 	RAM shadow of the GPIO ports configuration and output data registers.
+ *  		It is kept consistent by the PORT and DIO drivers, reads are served
+ *  		from RAM where legal and writes that don't change a register are skipped.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioShadow.h"
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+/* Macros */
+/* A GPIODRxR bit isn't cleared by writing 0, only by setting it in another drive register */
+#define DIO_SHADOW_IS_DRIVE(REG)	((DIO_SHADOW_DR2R <= (REG)) && (DIO_SHADOW_DR8R >= (REG)))
+
+static const uint16 Dio_ShadowOffsets[DIO_SHADOW_NO_OF_REGS] = {
+	HW_GPIODIR_OFFSET,
+	HW_GPIOAFSEL_OFFSET,
+	HW_GPIODR2R_OFFSET,
+	HW_GPIODR4R_OFFSET,
+	HW_GPIODR8R_OFFSET,
+	HW_GPIOODR_OFFSET,
+	HW_GPIOPUR_OFFSET,
+	HW_GPIOPDR_OFFSET,
+	HW_GPIODEN_OFFSET
+};	/*!< Offsets of the shadowed registers, indexed by Dio_ShadowRegType */
+
+#if(DioShadowRegisters == STD_ON)
+/* Shared Variables */
+Dio_ShadowPortType Dio_Shadow[HW_NO_OF_PORTS];	/*!< Shadow of every port, all registers invalid after reset */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Updates the shadow after a register was written.
+ *				Setting a bit of GPIODRxR clears it in the other drive registers and
+ *				setting a bit of GPIOPUR (GPIOPDR) clears it in GPIOPDR (GPIOPUR).
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Written register.
+ *	\param[in] 	Value: 		Written value.
+ *	\return		None.
+ */
+static void Dio_ShadowUpdate(uint8 PortId, Dio_ShadowRegType Reg, uint8 Value);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Updates the shadow after a register was written.
+ *				Setting a bit of GPIODRxR clears it in the other drive registers and
+ *				setting a bit of GPIOPUR (GPIOPDR) clears it in GPIOPDR (GPIOPUR).
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Written register.
+ *	\param[in] 	Value: 		Written value.
+ *	\return		None.
+ */
+static void Dio_ShadowUpdate(uint8 PortId, Dio_ShadowRegType Reg, uint8 Value)
+{
+	/* Needed Variables */
+	Dio_ShadowPortType* DIO_ShadowPtr = &Dio_Shadow[PortId];
+	const uint16 DIO_OutputRegs = (uint16)((1 << DIO_SHADOW_DIR) | (1 << DIO_SHADOW_AFSEL) |
+										   (1 << DIO_SHADOW_ODR));
+	
+	DIO_ShadowPtr->Dio_Regs[Reg] = Value;
+	DIO_ShadowPtr->Dio_ValidRegs |= (uint16)(1 << Reg);
+	
+	/* Hardware side effects */
+	switch(Reg)
+	{
+		case DIO_SHADOW_DR2R:
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DR4R] &= (uint8)~Value;
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DR8R] &= (uint8)~Value;
+		break;
+		case DIO_SHADOW_DR4R:
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DR2R] &= (uint8)~Value;
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DR8R] &= (uint8)~Value;
+		break;
+		case DIO_SHADOW_DR8R:
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DR2R] &= (uint8)~Value;
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DR4R] &= (uint8)~Value;
+		break;
+		case DIO_SHADOW_PUR:
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_PDR] &= (uint8)~Value;
+		break;
+		case DIO_SHADOW_PDR:
+			DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_PUR] &= (uint8)~Value;
+		break;
+		default:;
+            /* MISRA-C rule */
+            /* Rule 15.3 (required): The fnal clause of a switch
+			   statement shall be the default clause. */
+	}
+	
+	/* Levels of push-pull GPIO outputs can be served from RAM */
+	if(DIO_OutputRegs == (DIO_ShadowPtr->Dio_ValidRegs & DIO_OutputRegs))
+	{
+		DIO_ShadowPtr->Dio_OutputMask = (uint8)(DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_DIR] &
+											   ~DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_AFSEL] &
+											   ~DIO_ShadowPtr->Dio_Regs[DIO_SHADOW_ODR]);
+	}
+	else
+	{
+		DIO_ShadowPtr->Dio_OutputMask = 0;
+	}
+}
+#endif /* DioShadowRegisters check */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Modifies a configuration register of a port.
+ *				With the shadow enabled the register is read at most once (the first time)
+ *				and the write is skipped if the register already holds the new value.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Register to be modified.
+ *	\param[in] 	ClearMask: 	Bits to be cleared.
+ *	\param[in] 	SetMask: 	Bits to be set.
+ *	\return		None.
+ */
+void Dio_ShadowModifyReg(uint8 PortId, Dio_ShadowRegType Reg, uint8 ClearMask, uint8 SetMask)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType DIO_Address = HW_PortsAddresses[PortId] + Dio_ShadowOffsets[Reg];
+#if(DioShadowRegisters == STD_ON)
+	uint8 DIO_OldValue;
+	uint8 DIO_NewValue;
+	uint32 DIO_IntState;
+	
+	HW_ENTER_CRITICAL(DIO_IntState);
+	DIO_OldValue = Dio_ShadowReadReg(PortId, Reg);
+	if(DIO_SHADOW_IS_DRIVE(Reg))
+	{
+		/* The register keeps its bits whatever is written */
+		DIO_NewValue = (uint8)(DIO_OldValue | SetMask);
+	}
+	else
+	{
+		DIO_NewValue = (uint8)((DIO_OldValue & ~ClearMask) | SetMask);
+	}
+	if(DIO_NewValue != DIO_OldValue)
+	{
+		HW_W_8RIG(DIO_Address, DIO_NewValue);
+		Dio_ShadowUpdate(PortId, Reg, DIO_NewValue);
+	}
+	else
+	{
+		/* Register already holds the value, skip the bus write */
+	}
+	HW_EXIT_CRITICAL(DIO_IntState);
+#else
+	HW_W_8RIG(DIO_Address, (HW_R_8RIG(DIO_Address) & ~(uint32)ClearMask) | SetMask);
+#endif /* DioShadowRegisters check */
+}
+
+/**
+ *	\brief		Stores a whole value to a configuration register of a port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Register to be written.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+void Dio_ShadowStoreReg(uint8 PortId, Dio_ShadowRegType Reg, uint8 Value)
+{
+#if(DioShadowRegisters == STD_ON)
+	uint32 DIO_IntState;
+	
+	HW_ENTER_CRITICAL(DIO_IntState);
+	HW_W_8RIG(HW_PortsAddresses[PortId] + Dio_ShadowOffsets[Reg], Value);
+	if(!DIO_SHADOW_IS_DRIVE(Reg))
+	{
+		Dio_ShadowUpdate(PortId, Reg, Value);
+	}
+	else if(0 != (Dio_Shadow[PortId].Dio_ValidRegs & (1 << Reg)))
+	{
+		/* The register keeps its bits whatever is written */
+		Dio_ShadowUpdate(PortId, Reg, (uint8)(Dio_Shadow[PortId].Dio_Regs[Reg] | Value));
+	}
+	else
+	{
+		/* The bits kept by the register aren't known, it is read on its next access */
+		Dio_ShadowUpdate(PortId, Reg, Value);
+		Dio_Shadow[PortId].Dio_ValidRegs &= (uint16)~(1 << Reg);
+	}
+	HW_EXIT_CRITICAL(DIO_IntState);
+#else
+	HW_W_8RIG(HW_PortsAddresses[PortId] + Dio_ShadowOffsets[Reg], Value);
+#endif /* DioShadowRegisters check */
+}
+
+/**
+ *	\brief		Reads a configuration register of a port, from RAM if the shadow holds it.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Register to be read.
+ *	\return		uint8: 		Value of the register.
+ */
+uint8 Dio_ShadowReadReg(uint8 PortId, Dio_ShadowRegType Reg)
+{
+	/* Return data definition */
+	uint8 DIO_RetData;
+	
+#if(DioShadowRegisters == STD_ON)
+	if(0 == (Dio_Shadow[PortId].Dio_ValidRegs & (1 << Reg)))
+	{
+		/* First access, load the shadow from the register */
+		Dio_ShadowUpdate(PortId, Reg, (uint8)HW_R_8RIG(HW_PortsAddresses[PortId] + Dio_ShadowOffsets[Reg]));
+	}
+	else
+	{
+		/* Shadow holds the register value */
+	}
+	DIO_RetData = Dio_Shadow[PortId].Dio_Regs[Reg];
+#else
+	DIO_RetData = (uint8)HW_R_8RIG(HW_PortsAddresses[PortId] + Dio_ShadowOffsets[Reg]);
+#endif /* DioShadowRegisters check */
+	
+	return DIO_RetData;
+}
+
+#if(DioShadowRegisters == STD_ON)
+/**
+ *	\brief		Writes levels to the masked bits of GPIODATA.
+ *				The write is skipped if all masked bits are known to hold the
+ *				requested levels already.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Bits to be written.
+ *	\param[in] 	Level: 		Levels of the masked bits.
+ *	\return		None.
+ */
+void Dio_ShadowWriteData(uint8 PortId, uint8 Mask, uint8 Level)
+{
+	/* Needed Variables */
+	Dio_ShadowPortType* DIO_ShadowPtr = &Dio_Shadow[PortId];
+	uint32 DIO_IntState;
+	
+	HW_ENTER_CRITICAL(DIO_IntState);
+	if((Mask == (DIO_ShadowPtr->Dio_DataKnown & Mask)) &&
+	   (0 == ((DIO_ShadowPtr->Dio_Data ^ Level) & Mask)))
+	{
+		/* Pins already hold the levels, skip the bus write */
+	}
+	else
+	{
+		HW_W_8RIG(HW_PortsAddresses[PortId] + HW_GPIODATA_OFFSET + (Mask << 2), Level);
+		DIO_ShadowPtr->Dio_Data = (uint8)((DIO_ShadowPtr->Dio_Data & ~Mask) | (Level & Mask));
+		DIO_ShadowPtr->Dio_DataKnown |= Mask;
+	}
+	HW_EXIT_CRITICAL(DIO_IntState);
+}
+
+/**
+ *	\brief		Drops the known levels of pins driven behind the shadow (uDMA, bit-banged
+ *				engines writing GPIODATA directly), their next write always reaches the port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Pins whose levels aren't known anymore.
+ *	\return		None.
+ */
+void Dio_ShadowForgetData(uint8 PortId, uint8 Mask)
+{
+	/* Needed Variables */
+	uint32 DIO_IntState;
+	
+	HW_ENTER_CRITICAL(DIO_IntState);
+	Dio_Shadow[PortId].Dio_DataKnown &= (uint8)~Mask;
+	HW_EXIT_CRITICAL(DIO_IntState);
+}
+
+/**
+ *	\brief		Drops everything the shadow holds of a port, its registers are read again
+ *				on their next access. Called by Port_Init, the registers may have been
+ *				reset since the shadow was loaded.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		None.
+ */
+void Dio_ShadowInvalidate(uint8 PortId)
+{
+	/* Needed Variables */
+	uint32 DIO_IntState;
+	
+	HW_ENTER_CRITICAL(DIO_IntState);
+	Dio_Shadow[PortId].Dio_ValidRegs = 0;
+	Dio_Shadow[PortId].Dio_DataKnown = 0;
+	Dio_Shadow[PortId].Dio_OutputMask = 0;
+	HW_EXIT_CRITICAL(DIO_IntState);
+}
+#endif /* DioShadowRegisters check */
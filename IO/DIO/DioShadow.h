@@ -0,0 +1,128 @@
+/**
+ *  \file	DioShadow.h
+ *  \brief 	RAM shadow of the GPIO ports configuration and output data registers.
+ *  		It is kept consistent by the PORT and DIO drivers, reads are served
+ *  		from RAM where legal and writes that don't change a register are skipped.
+ *  		Enabled by DioShadowRegisters in DioGeneral.h, when it is disabled every
+ *  		service accesses the registers directly.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_SHADOW_H_
+#define DIO_SHADOW_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+#include "DioGeneral.h"
+
+/* Defined data types */
+typedef enum{
+	DIO_SHADOW_DIR = 0,		/*!< GPIODIR register */
+	DIO_SHADOW_AFSEL,		/*!< GPIOAFSEL register */
+	DIO_SHADOW_DR2R,		/*!< GPIODR2R register */
+	DIO_SHADOW_DR4R,		/*!< GPIODR4R register */
+	DIO_SHADOW_DR8R,		/*!< GPIODR8R register */
+	DIO_SHADOW_ODR,			/*!< GPIOODR register */
+	DIO_SHADOW_PUR,			/*!< GPIOPUR register */
+	DIO_SHADOW_PDR,			/*!< GPIOPDR register */
+	DIO_SHADOW_DEN,			/*!< GPIODEN register */
+	DIO_SHADOW_NO_OF_REGS	/*!< Number of shadowed configuration registers */
+}Dio_ShadowRegType;	/*!< Shadowed configuration register of a port */
+
+#if(DioShadowRegisters == STD_ON)
+typedef struct{
+	uint8	Dio_Regs[DIO_SHADOW_NO_OF_REGS];	/*!< Last known values of the configuration registers */
+	uint16	Dio_ValidRegs;		/*!< Bit per register, set when its shadow holds the register value */
+	uint8	Dio_OutputMask;		/*!< Push-pull GPIO outputs, their levels can be read from RAM */
+	uint8	Dio_Data;			/*!< Last levels written to GPIODATA */
+	uint8	Dio_DataKnown;		/*!< Bits of Dio_Data that hold the written level */
+}Dio_ShadowPortType;	/*!< Shadow of one port */
+
+/* Shared variables */
+extern Dio_ShadowPortType Dio_Shadow[HW_NO_OF_PORTS];	/*!< Shadow of every port */
+
+/* Macros */
+/* Output pins of PORT_ID whose levels are held by the shadow */
+#define DIO_SHADOW_KNOWN_OUTPUTS(PORT_ID)	\
+	(uint8)(Dio_Shadow[PORT_ID].Dio_OutputMask & Dio_Shadow[PORT_ID].Dio_DataKnown)
+#endif /* DioShadowRegisters check */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Modifies a configuration register of a port.
+ *				With the shadow enabled the register is read at most once (the first time)
+ *				and the write is skipped if the register already holds the new value.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Register to be modified.
+ *	\param[in] 	ClearMask: 	Bits to be cleared.
+ *	\param[in] 	SetMask: 	Bits to be set.
+ *	\return		None.
+ */
+void Dio_ShadowModifyReg(uint8 PortId, Dio_ShadowRegType Reg, uint8 ClearMask, uint8 SetMask);
+
+/**
+ *	\brief		Stores a whole value to a configuration register of a port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Register to be written.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+void Dio_ShadowStoreReg(uint8 PortId, Dio_ShadowRegType Reg, uint8 Value);
+
+/**
+ *	\brief		Reads a configuration register of a port, from RAM if the shadow holds it.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Reg: 		Register to be read.
+ *	\return		uint8: 		Value of the register.
+ */
+uint8 Dio_ShadowReadReg(uint8 PortId, Dio_ShadowRegType Reg);
+
+#if(DioShadowRegisters == STD_ON)
+/**
+ *	\brief		Writes levels to the masked bits of GPIODATA.
+ *				The write is skipped if all masked bits are known to hold the
+ *				requested levels already.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Bits to be written.
+ *	\param[in] 	Level: 		Levels of the masked bits.
+ *	\return		None.
+ */
+void Dio_ShadowWriteData(uint8 PortId, uint8 Mask, uint8 Level);
+
+/**
+ *	\brief		Drops the known levels of pins driven behind the shadow (uDMA, bit-banged
+ *				engines writing GPIODATA directly), their next write always reaches the port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Pins whose levels aren't known anymore.
+ *	\return		None.
+ */
+void Dio_ShadowForgetData(uint8 PortId, uint8 Mask);
+
+/**
+ *	\brief		Drops everything the shadow holds of a port, its registers are read again
+ *				on their next access. Called by Port_Init, the registers may have been
+ *				reset since the shadow was loaded.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		None.
+ */
+void Dio_ShadowInvalidate(uint8 PortId);
+#else
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+/* Without the shadow the data write is a single masked GPIODATA store, expanded at the
+   call site so the DIO write services don't pay for a call */
+#define Dio_ShadowWriteData(PORT_ID,MASK,LEVEL)	\
+	HW_W_8RIG(HW_PortsAddresses[PORT_ID] + HW_GPIODATA_OFFSET + ((uint32)(uint8)(MASK) << 2), (uint8)(LEVEL))
+
+/* No shadowed levels to drop */
+#define Dio_ShadowForgetData(PORT_ID,MASK)	((void)(PORT_ID), (void)(MASK))
+
+/* Nothing shadowed to drop */
+#define Dio_ShadowInvalidate(PORT_ID)		((void)(PORT_ID))
+#endif /* DioShadowRegisters check */
+
+#endif /* DIO_SHADOW_H_ */
@@ -0,0 +1,453 @@
+/**
+ *  \file	DioSoftI2c.c
+ *  \brief 	Bit-banged I2C master on DIO channels.
+ *  		A written bit costs three stores (SDA, SCL released, SCL low) and a read bit
+ *  		two stores and a load, plus a load of SCL per bit if clock stretching is polled.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioSoftI2c.h"
+#include "DioShadow.h"	/* The engine writes the pins behind the shadow */
+
+#if(DioSoftI2cApi == STD_ON)
+/* Macros */
+/* Get the port of a channel from its ID */
+#define DIO_SOFT_I2C_GET_PORT(CHANNEL_ID)	(uint8)(((CHANNEL_ID) & 0xF0) >> 4)
+
+/* Get the pin of a channel in its port from its ID */
+#define DIO_SOFT_I2C_GET_PIN(CHANNEL_ID)	(uint8)((CHANNEL_ID) & 0x0F)
+
+/* Check that a channel ID addresses a pin of a port */
+#define DIO_SOFT_I2C_CHANNEL_EXISTS(CHANNEL_ID)	\
+	((DIO_SOFT_I2C_GET_PORT(CHANNEL_ID) < HW_NO_OF_PORTS) && (DIO_SOFT_I2C_GET_PIN(CHANNEL_ID) < 8))
+
+/* GPIODATA address masked to the pin of a channel */
+#define DIO_SOFT_I2C_ADDRESS(CHANNEL_ID)	(HW_PortsAddresses[DIO_SOFT_I2C_GET_PORT(CHANNEL_ID)] + HW_GPIODATA_OFFSET + \
+											 ((HW_AddressBusSizeType)1 << (DIO_SOFT_I2C_GET_PIN(CHANNEL_ID) + 2)))
+
+/* Line levels stored to a masked address */
+#define DIO_SOFT_I2C_LOW		0x00	/*!< Pulls the line low */
+#define DIO_SOFT_I2C_RELEASE	0xFF	/*!< Releases the line, the pull-up drives it high */
+
+/* Clocks sent at most to free SDA held low by a slave */
+#define DIO_SOFT_I2C_RECOVERY_CLOCKS	9
+
+#if(DioShadowRegisters == STD_ON)
+/* Drops the levels of SCL and SDA from the DIO shadow, the engine stores them to GPIODATA
+   directly and a later DIO write of these pins has to reach the port */
+#define DIO_SOFT_I2C_FORGET_PINS(I2C_PTR)	\
+	do{	\
+		Dio_ShadowForgetData(DIO_SOFT_I2C_GET_PORT((I2C_PTR)->Dio_Scl), (uint8)(1 << DIO_SOFT_I2C_GET_PIN((I2C_PTR)->Dio_Scl)));	\
+		Dio_ShadowForgetData(DIO_SOFT_I2C_GET_PORT((I2C_PTR)->Dio_Sda), (uint8)(1 << DIO_SOFT_I2C_GET_PIN((I2C_PTR)->Dio_Sda)));	\
+	}while(0)
+#else
+#define DIO_SOFT_I2C_FORGET_PINS(I2C_PTR)	((void)0)
+#endif /* DioShadowRegisters check */
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static const uint8 Dio_SoftI2cLevels[2] = {
+	DIO_SOFT_I2C_LOW,
+	DIO_SOFT_I2C_RELEASE
+};	/*!< Store of a 0 and of a 1 on SDA */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Waits half a clock period.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		None.
+ */
+static void Dio_SoftI2cDelay(const Dio_SoftI2cType* I2cPtr);
+
+/**
+ *	\brief		Releases SCL and waits while a slave stretches the clock.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		Std_ReturnType:	-	E_OK: SCL is high.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cReleaseScl(const Dio_SoftI2cType* I2cPtr);
+
+/**
+ *	\brief		Clocks a bit out, SCL is low before and after it.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	Bit: 		Bit to be sent, 0 or 1.
+ *	\return		Std_ReturnType:	-	E_OK: The bit is sent.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cWriteBit(const Dio_SoftI2cType* I2cPtr, uint8 Bit);
+
+/**
+ *	\brief		Clocks a bit in, SCL is low before and after it.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[out] BitPtr: 	Pointer to the received bit, 0 or 1.
+ *	\return		Std_ReturnType:	-	E_OK: The bit is received.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cReadBit(const Dio_SoftI2cType* I2cPtr, uint8* BitPtr);
+
+/**
+ *	\brief		Sends a byte, MSB first, and receives its acknowledge.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	Byte: 		Byte to be sent.
+ *	\return		Std_ReturnType:	-	E_OK: The byte is acknowledged.
+ *								-	E_NOT_OK: The byte isn't acknowledged or SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cWriteByte(const Dio_SoftI2cType* I2cPtr, uint8 Byte);
+
+/**
+ *	\brief		Receives a byte, MSB first, and sends its acknowledge.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[out] BytePtr: 	Pointer to the received byte.
+ *	\param[in] 	Ack: 		TRUE to acknowledge the byte, FALSE for the last byte.
+ *	\return		Std_ReturnType:	-	E_OK: The byte is received.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cReadByte(const Dio_SoftI2cType* I2cPtr, uint8* BytePtr, boolean Ack);
+
+/**
+ *	\brief		Sends a START, or a repeated START if SCL is low.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		Std_ReturnType:	-	E_OK: The START is sent.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cStart(const Dio_SoftI2cType* I2cPtr);
+
+/**
+ *	\brief		Sends a STOP, SCL is low before it.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		None.
+ */
+static void Dio_SoftI2cStop(const Dio_SoftI2cType* I2cPtr);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Waits half a clock period.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		None.
+ */
+static void Dio_SoftI2cDelay(const Dio_SoftI2cType* I2cPtr)
+{
+	/* Needed Variables */
+	volatile uint16 DIO_Loops = I2cPtr->Dio_Delay;
+	
+	while(0 != DIO_Loops)
+	{
+		DIO_Loops--;
+	}
+}
+
+/**
+ *	\brief		Releases SCL and waits while a slave stretches the clock.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		Std_ReturnType:	-	E_OK: SCL is high.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cReleaseScl(const Dio_SoftI2cType* I2cPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint16 DIO_Polls = I2cPtr->Dio_StretchLimit;
+	
+	HW_W_8RIG(I2cPtr->Dio_SclAddress, DIO_SOFT_I2C_RELEASE);
+	
+	/* Not read back at all if no slave stretches the clock */
+	if(0 != DIO_Polls)
+	{
+		while((0 == HW_R_8RIG(I2cPtr->Dio_SclAddress)) && (0 != DIO_Polls))
+		{
+			DIO_Polls--;
+		}
+		DIO_RetData = (0 != DIO_Polls) ? E_OK : E_NOT_OK;
+	}
+	else
+	{
+		/* SCL follows the release */
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Clocks a bit out, SCL is low before and after it.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	Bit: 		Bit to be sent, 0 or 1.
+ *	\return		Std_ReturnType:	-	E_OK: The bit is sent.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cWriteBit(const Dio_SoftI2cType* I2cPtr, uint8 Bit)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData;
+	
+	HW_W_8RIG(I2cPtr->Dio_SdaAddress, Dio_SoftI2cLevels[Bit]);
+	Dio_SoftI2cDelay(I2cPtr);
+	DIO_RetData = Dio_SoftI2cReleaseScl(I2cPtr);
+	Dio_SoftI2cDelay(I2cPtr);
+	HW_W_8RIG(I2cPtr->Dio_SclAddress, DIO_SOFT_I2C_LOW);
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Clocks a bit in, SCL is low before and after it.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[out] BitPtr: 	Pointer to the received bit, 0 or 1.
+ *	\return		Std_ReturnType:	-	E_OK: The bit is received.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cReadBit(const Dio_SoftI2cType* I2cPtr, uint8* BitPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData;
+	
+	HW_W_8RIG(I2cPtr->Dio_SdaAddress, DIO_SOFT_I2C_RELEASE);
+	Dio_SoftI2cDelay(I2cPtr);
+	DIO_RetData = Dio_SoftI2cReleaseScl(I2cPtr);
+	Dio_SoftI2cDelay(I2cPtr);
+	*BitPtr = (uint8)((HW_R_8RIG(I2cPtr->Dio_SdaAddress) >> I2cPtr->Dio_SdaPin) & 0x01);
+	HW_W_8RIG(I2cPtr->Dio_SclAddress, DIO_SOFT_I2C_LOW);
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Sends a byte, MSB first, and receives its acknowledge.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	Byte: 		Byte to be sent.
+ *	\return		Std_ReturnType:	-	E_OK: The byte is acknowledged.
+ *								-	E_NOT_OK: The byte isn't acknowledged or SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cWriteByte(const Dio_SoftI2cType* I2cPtr, uint8 Byte)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_Bit;
+	uint8 DIO_Nack = 1;
+	
+	for(DIO_Bit = 0; (DIO_Bit < 8) && (E_OK == DIO_RetData); DIO_Bit++)
+	{
+		DIO_RetData = Dio_SoftI2cWriteBit(I2cPtr, (uint8)(Byte >> 7));
+		Byte = (uint8)(Byte << 1);
+	}
+	
+	if(E_OK == DIO_RetData)
+	{
+		/* The slave pulls SDA low to acknowledge */
+		DIO_RetData = Dio_SoftI2cReadBit(I2cPtr, &DIO_Nack);
+		DIO_RetData = ((E_OK == DIO_RetData) && (0 == DIO_Nack)) ? E_OK : E_NOT_OK;
+	}
+	else
+	{
+		/* Byte not sent */
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Receives a byte, MSB first, and sends its acknowledge.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[out] BytePtr: 	Pointer to the received byte.
+ *	\param[in] 	Ack: 		TRUE to acknowledge the byte, FALSE for the last byte.
+ *	\return		Std_ReturnType:	-	E_OK: The byte is received.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cReadByte(const Dio_SoftI2cType* I2cPtr, uint8* BytePtr, boolean Ack)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_Index;
+	uint8 DIO_Bit = 0;
+	uint8 DIO_Byte = 0;
+	
+	for(DIO_Index = 0; (DIO_Index < 8) && (E_OK == DIO_RetData); DIO_Index++)
+	{
+		DIO_RetData = Dio_SoftI2cReadBit(I2cPtr, &DIO_Bit);
+		DIO_Byte = (uint8)((DIO_Byte << 1) | DIO_Bit);
+	}
+	
+	if(E_OK == DIO_RetData)
+	{
+		DIO_RetData = Dio_SoftI2cWriteBit(I2cPtr, (TRUE == Ack) ? 0 : 1);
+	}
+	else
+	{
+		/* Byte not received */
+	}
+	*BytePtr = DIO_Byte;
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Sends a START, or a repeated START if SCL is low.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		Std_ReturnType:	-	E_OK: The START is sent.
+ *								-	E_NOT_OK: SCL stayed low.
+ */
+static Std_ReturnType Dio_SoftI2cStart(const Dio_SoftI2cType* I2cPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData;
+	
+	/* Both lines high, then SDA falls while SCL is high */
+	HW_W_8RIG(I2cPtr->Dio_SdaAddress, DIO_SOFT_I2C_RELEASE);
+	Dio_SoftI2cDelay(I2cPtr);
+	DIO_RetData = Dio_SoftI2cReleaseScl(I2cPtr);
+	Dio_SoftI2cDelay(I2cPtr);
+	HW_W_8RIG(I2cPtr->Dio_SdaAddress, DIO_SOFT_I2C_LOW);
+	Dio_SoftI2cDelay(I2cPtr);
+	HW_W_8RIG(I2cPtr->Dio_SclAddress, DIO_SOFT_I2C_LOW);
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Sends a STOP, SCL is low before it.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\return		None.
+ */
+static void Dio_SoftI2cStop(const Dio_SoftI2cType* I2cPtr)
+{
+	/* SDA rises while SCL is high */
+	HW_W_8RIG(I2cPtr->Dio_SdaAddress, DIO_SOFT_I2C_LOW);
+	Dio_SoftI2cDelay(I2cPtr);
+	(void)Dio_SoftI2cReleaseScl(I2cPtr);
+	Dio_SoftI2cDelay(I2cPtr);
+	HW_W_8RIG(I2cPtr->Dio_SdaAddress, DIO_SOFT_I2C_RELEASE);
+	Dio_SoftI2cDelay(I2cPtr);
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Decodes the pins of a soft I2C and frees the bus: if a slave holds SDA low,
+ *				SCL is clocked until SDA is released, then a STOP is sent.
+ *	\param[out] I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	ConfigPtr: 	Pointer to the pins and timing.
+ *	\return		Std_ReturnType:	-	E_OK: The bus is free.
+ *								-	E_NOT_OK: NULL pointer, a channel doesn't exist or the bus
+ *											  stays busy.
+ */
+Std_ReturnType Dio_SoftI2cInit(Dio_SoftI2cType* I2cPtr, const Dio_SoftI2cConfigType* ConfigPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_Clocks = 0;
+	
+	if((NULL_PTR == I2cPtr) || (NULL_PTR == ConfigPtr) ||
+	   (!DIO_SOFT_I2C_CHANNEL_EXISTS(ConfigPtr->Dio_Scl)) || (!DIO_SOFT_I2C_CHANNEL_EXISTS(ConfigPtr->Dio_Sda)))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		I2cPtr->Dio_SclAddress = DIO_SOFT_I2C_ADDRESS(ConfigPtr->Dio_Scl);
+		I2cPtr->Dio_SdaAddress = DIO_SOFT_I2C_ADDRESS(ConfigPtr->Dio_Sda);
+		I2cPtr->Dio_SdaPin = DIO_SOFT_I2C_GET_PIN(ConfigPtr->Dio_Sda);
+		I2cPtr->Dio_Delay = ConfigPtr->Dio_Delay;
+		I2cPtr->Dio_StretchLimit = ConfigPtr->Dio_StretchLimit;
+#if(DioShadowRegisters == STD_ON)
+		I2cPtr->Dio_Scl = ConfigPtr->Dio_Scl;
+		I2cPtr->Dio_Sda = ConfigPtr->Dio_Sda;
+#endif /* DioShadowRegisters check */
+	
+		HW_W_8RIG(I2cPtr->Dio_SdaAddress, DIO_SOFT_I2C_RELEASE);
+		DIO_RetData = Dio_SoftI2cReleaseScl(I2cPtr);
+		Dio_SoftI2cDelay(I2cPtr);
+	
+		/* A slave interrupted in the middle of a byte holds SDA until it is clocked out */
+		while((E_OK == DIO_RetData) && (0 == HW_R_8RIG(I2cPtr->Dio_SdaAddress)) &&
+			  (DIO_Clocks < DIO_SOFT_I2C_RECOVERY_CLOCKS))
+		{
+			HW_W_8RIG(I2cPtr->Dio_SclAddress, DIO_SOFT_I2C_LOW);
+			Dio_SoftI2cDelay(I2cPtr);
+			DIO_RetData = Dio_SoftI2cReleaseScl(I2cPtr);
+			Dio_SoftI2cDelay(I2cPtr);
+			DIO_Clocks++;
+		}
+	
+		if((E_OK == DIO_RetData) && (0 != HW_R_8RIG(I2cPtr->Dio_SdaAddress)))
+		{
+			HW_W_8RIG(I2cPtr->Dio_SclAddress, DIO_SOFT_I2C_LOW);
+			Dio_SoftI2cDelay(I2cPtr);
+			Dio_SoftI2cStop(I2cPtr);
+		}
+		else
+		{
+			DIO_RetData = E_NOT_OK;
+		}
+		DIO_SOFT_I2C_FORGET_PINS(I2cPtr);
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Transfers a message to a slave: START, the bytes written, a repeated START and
+ *				the bytes read (all acknowledged but the last one), then STOP.
+ *				A message without bytes only checks that the slave acknowledges its address.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	Address: 	7 bits address of the slave.
+ *	\param[in] 	TxPtr: 		Pointer to the bytes to be written.
+ *	\param[in] 	TxLength: 	Number of bytes to be written, 0 for a read only message.
+ *	\param[out] RxPtr: 		Pointer to the bytes read.
+ *	\param[in] 	RxLength: 	Number of bytes to be read, 0 for a write only message.
+ *	\return		Std_ReturnType:	-	E_OK: The message is transferred.
+ *								-	E_NOT_OK: The slave didn't acknowledge its address or a written
+ *											  byte, or it stretched the clock too long.
+ */
+Std_ReturnType Dio_SoftI2cTransfer(const Dio_SoftI2cType* I2cPtr, uint8 Address, const uint8* TxPtr, uint16 TxLength,
+								   uint8* RxPtr, uint16 RxLength)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData;
+	uint16 DIO_Index;
+	
+	DIO_RetData = Dio_SoftI2cStart(I2cPtr);
+	
+	/* Write phase, also sent alone by an empty message */
+	if((E_OK == DIO_RetData) && ((0 != TxLength) || (0 == RxLength)))
+	{
+		DIO_RetData = Dio_SoftI2cWriteByte(I2cPtr, (uint8)(Address << 1));
+		for(DIO_Index = 0; (DIO_Index < TxLength) && (E_OK == DIO_RetData); DIO_Index++)
+		{
+			DIO_RetData = Dio_SoftI2cWriteByte(I2cPtr, TxPtr[DIO_Index]);
+		}
+	
+		if((E_OK == DIO_RetData) && (0 != RxLength))
+		{
+			DIO_RetData = Dio_SoftI2cStart(I2cPtr);
+		}
+		else
+		{
+			/* No read phase */
+		}
+	}
+	else
+	{
+		/* Read only message */
+	}
+	
+	/* Read phase */
+	if((E_OK == DIO_RetData) && (0 != RxLength))
+	{
+		DIO_RetData = Dio_SoftI2cWriteByte(I2cPtr, (uint8)((Address << 1) | 0x01));
+		for(DIO_Index = 0; (DIO_Index < RxLength) && (E_OK == DIO_RetData); DIO_Index++)
+		{
+			DIO_RetData = Dio_SoftI2cReadByte(I2cPtr, &RxPtr[DIO_Index], (DIO_Index < (RxLength - 1)) ? TRUE : FALSE);
+		}
+	}
+	else
+	{
+		/* No read phase or message aborted */
+	}
+	
+	Dio_SoftI2cStop(I2cPtr);
+	DIO_SOFT_I2C_FORGET_PINS(I2cPtr);
+	
+	return DIO_RetData;
+}
+#endif /* DioSoftI2cApi check */
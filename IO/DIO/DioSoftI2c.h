@@ -0,0 +1,75 @@
+/**
+ *  \file	DioSoftI2c.h
+ *  \brief 	Bit-banged I2C master on DIO channels.
+ *  		The pins are decoded once by Dio_SoftI2cInit() into masked GPIODATA addresses,
+ *  		a clock edge is then a single store and a sampled bit a single load.
+ *  		SCL and SDA are configured by the PORT driver as open-drain outputs with
+ *  		pull-ups: storing a 0 pulls the line low, storing a 1 releases it and the
+ *  		line level is read back from the same address.
+ *  		Clock stretching is supported by polling SCL after it is released.
+ *  		Enabled by DioSoftI2cApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_SOFT_I2C_H_
+#define DIO_SOFT_I2C_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioSoftI2cApi == STD_ON)
+/* Defined data types */
+typedef struct{
+	Dio_ChannelType	Dio_Scl;			/*!< Channel of SCL */
+	Dio_ChannelType	Dio_Sda;			/*!< Channel of SDA */
+	uint16			Dio_Delay;			/*!< Delay loops per half clock period, 0 runs at the store rate */
+	uint16			Dio_StretchLimit;	/*!< Polls of SCL while a slave stretches the clock, 0 if no slave stretches it */
+}Dio_SoftI2cConfigType;	/*!< Pins and timing of a soft I2C */
+
+typedef struct{
+	HW_AddressBusSizeType	Dio_SclAddress;		/*!< GPIODATA address masked to SCL */
+	HW_AddressBusSizeType	Dio_SdaAddress;		/*!< GPIODATA address masked to SDA */
+	uint8					Dio_SdaPin;			/*!< Pin of SDA in its port */
+	uint16					Dio_Delay;			/*!< Delay loops per half clock period */
+	uint16					Dio_StretchLimit;	/*!< Polls of SCL while a slave stretches the clock */
+#if(DioShadowRegisters == STD_ON)
+	Dio_ChannelType			Dio_Scl;			/*!< Channel of SCL, its level is dropped from the DIO shadow after a transfer */
+	Dio_ChannelType			Dio_Sda;			/*!< Channel of SDA, its level is dropped from the DIO shadow after a transfer */
+#endif /* DioShadowRegisters check */
+}Dio_SoftI2cType;	/*!< Decoded soft I2C, filled by Dio_SoftI2cInit() */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Decodes the pins of a soft I2C and frees the bus: if a slave holds SDA low,
+ *				SCL is clocked until SDA is released, then a STOP is sent.
+ *	\param[out] I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	ConfigPtr: 	Pointer to the pins and timing.
+ *	\return		Std_ReturnType:	-	E_OK: The bus is free.
+ *								-	E_NOT_OK: NULL pointer, a channel doesn't exist or the bus
+ *											  stays busy.
+ */
+Std_ReturnType Dio_SoftI2cInit(Dio_SoftI2cType* I2cPtr, const Dio_SoftI2cConfigType* ConfigPtr);
+
+/**
+ *	\brief		Transfers a message to a slave: START, the bytes written, a repeated START and
+ *				the bytes read (all acknowledged but the last one), then STOP.
+ *				A message without bytes only checks that the slave acknowledges its address.
+ *	\param[in] 	I2cPtr: 	Pointer to the decoded soft I2C.
+ *	\param[in] 	Address: 	7 bits address of the slave.
+ *	\param[in] 	TxPtr: 		Pointer to the bytes to be written.
+ *	\param[in] 	TxLength: 	Number of bytes to be written, 0 for a read only message.
+ *	\param[out] RxPtr: 		Pointer to the bytes read.
+ *	\param[in] 	RxLength: 	Number of bytes to be read, 0 for a write only message.
+ *	\return		Std_ReturnType:	-	E_OK: The message is transferred.
+ *								-	E_NOT_OK: The slave didn't acknowledge its address or a written
+ *											  byte, or it stretched the clock too long.
+ */
+Std_ReturnType Dio_SoftI2cTransfer(const Dio_SoftI2cType* I2cPtr, uint8 Address, const uint8* TxPtr, uint16 TxLength,
+								   uint8* RxPtr, uint16 RxLength);
+#endif /* DioSoftI2cApi check */
+
+#endif /* DIO_SOFT_I2C_H_ */
@@ -0,0 +1,352 @@
+/**
+ *  \file	DioSoftSpi.c
+ *  \brief 	Bit-banged SPI master on DIO channels.
+ *  		A bit costs two stores (three for a clock phase of 0 with MOSI and SCK on
+ *  		different ports) and a load if MISO is used.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioSoftSpi.h"
+#include "DioShadow.h"	/* The engine writes the pins behind the shadow */
+
+#if(DioSoftSpiApi == STD_ON)
+/* Macros */
+/* Get the port of a channel from its ID */
+#define DIO_SOFT_SPI_GET_PORT(CHANNEL_ID)	(uint8)(((CHANNEL_ID) & 0xF0) >> 4)
+
+/* Get the bit of a channel in its port from its ID */
+#define DIO_SOFT_SPI_GET_MASK(CHANNEL_ID)	(uint8)(1 << ((CHANNEL_ID) & 0x07))
+
+/* Check that a channel ID addresses a pin of a port */
+#define DIO_SOFT_SPI_CHANNEL_EXISTS(CHANNEL_ID)	\
+	((DIO_SOFT_SPI_GET_PORT(CHANNEL_ID) < HW_NO_OF_PORTS) && (((CHANNEL_ID) & 0x0F) < 8))
+
+/* GPIODATA address of a port masked to some of its pins */
+#define DIO_SOFT_SPI_ADDRESS(PORT_ID, MASK)	\
+	(HW_PortsAddresses[PORT_ID] + HW_GPIODATA_OFFSET + ((HW_AddressBusSizeType)(MASK) << 2))
+
+#if(DioShadowRegisters == STD_ON)
+/* Drops the levels of the driven pins from the DIO shadow */
+#define DIO_SOFT_SPI_FORGET_PINS(SPI_PTR)	Dio_SoftSpiForgetPins(SPI_PTR)
+#else
+#define DIO_SOFT_SPI_FORGET_PINS(SPI_PTR)	((void)0)
+#endif /* DioShadowRegisters check */
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static const uint8 Dio_SoftSpiReversed[16] = {
+	0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+	0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+};	/*!< Bits of every nibble in reverse order */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Reverses the bits order of a byte.
+ *	\param[in] 	Byte: 	Byte to be reversed.
+ *	\return		uint8: 	Reversed byte.
+ */
+static uint8 Dio_SoftSpiReverse(uint8 Byte);
+
+/**
+ *	\brief		Shifts a byte, MSB first, with a clock phase of 0: the data is set up
+ *				while SCK is idle and sampled on the leading edge.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	Byte: 		Byte to be sent.
+ *	\return		uint8: 		Received byte.
+ */
+static uint8 Dio_SoftSpiBytePhase0(const Dio_SoftSpiType* SpiPtr, uint8 Byte);
+
+/**
+ *	\brief		Shifts a byte, MSB first, with a clock phase of 1: the data is set up on
+ *				the leading edge and sampled on the trailing edge.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	Byte: 		Byte to be sent.
+ *	\return		uint8: 		Received byte.
+ */
+static uint8 Dio_SoftSpiBytePhase1(const Dio_SoftSpiType* SpiPtr, uint8 Byte);
+
+#if(DioShadowRegisters == STD_ON)
+/**
+ *	\brief		Drops the levels of SCK, MOSI and CS from the DIO shadow, the engine stores
+ *				them to GPIODATA directly and a later DIO write of these pins has to reach the port.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\return		None.
+ */
+static void Dio_SoftSpiForgetPins(const Dio_SoftSpiType* SpiPtr);
+#endif /* DioShadowRegisters check */
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Reverses the bits order of a byte.
+ *	\param[in] 	Byte: 	Byte to be reversed.
+ *	\return		uint8: 	Reversed byte.
+ */
+static uint8 Dio_SoftSpiReverse(uint8 Byte)
+{
+	return (uint8)((Dio_SoftSpiReversed[Byte & 0x0F] << 4) | Dio_SoftSpiReversed[Byte >> 4]);
+}
+
+/**
+ *	\brief		Shifts a byte, MSB first, with a clock phase of 0: the data is set up
+ *				while SCK is idle and sampled on the leading edge.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	Byte: 		Byte to be sent.
+ *	\return		uint8: 		Received byte.
+ */
+static uint8 Dio_SoftSpiBytePhase0(const Dio_SoftSpiType* SpiPtr, uint8 Byte)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType DIO_SckAddress = SpiPtr->Dio_SckAddress;
+	HW_AddressBusSizeType DIO_DataAddress = SpiPtr->Dio_DataAddress;
+	HW_AddressBusSizeType DIO_MisoAddress = SpiPtr->Dio_MisoAddress;
+	uint8 DIO_MisoPin = SpiPtr->Dio_MisoPin;
+	uint8 DIO_Received = 0;
+	uint8 DIO_Bit;
+	
+	for(DIO_Bit = 0; DIO_Bit < 8; DIO_Bit++)
+	{
+		if(FALSE == SpiPtr->Dio_Joined)
+		{
+			/* Trailing edge of the previous bit, joined to the data store on one port */
+			HW_W_8RIG(DIO_SckAddress, SpiPtr->Dio_SckIdle);
+		}
+		else
+		{
+			/* The data store sets SCK idle */
+		}
+		HW_W_8RIG(DIO_DataAddress, SpiPtr->Dio_DataLevels[Byte >> 7]);
+		HW_W_8RIG(DIO_SckAddress, SpiPtr->Dio_SckActive);
+		if(0 != DIO_MisoAddress)
+		{
+			DIO_Received = (uint8)((DIO_Received << 1) | ((HW_R_8RIG(DIO_MisoAddress) >> DIO_MisoPin) & 0x01));
+		}
+		else
+		{
+			/* Nothing received */
+		}
+		Byte = (uint8)(Byte << 1);
+	}
+	
+	return DIO_Received;
+}
+
+/**
+ *	\brief		Shifts a byte, MSB first, with a clock phase of 1: the data is set up on
+ *				the leading edge and sampled on the trailing edge.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	Byte: 		Byte to be sent.
+ *	\return		uint8: 		Received byte.
+ */
+static uint8 Dio_SoftSpiBytePhase1(const Dio_SoftSpiType* SpiPtr, uint8 Byte)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType DIO_SckAddress = SpiPtr->Dio_SckAddress;
+	HW_AddressBusSizeType DIO_DataAddress = SpiPtr->Dio_DataAddress;
+	HW_AddressBusSizeType DIO_MisoAddress = SpiPtr->Dio_MisoAddress;
+	uint8 DIO_MisoPin = SpiPtr->Dio_MisoPin;
+	uint8 DIO_Received = 0;
+	uint8 DIO_Bit;
+	
+	for(DIO_Bit = 0; DIO_Bit < 8; DIO_Bit++)
+	{
+		HW_W_8RIG(DIO_DataAddress, SpiPtr->Dio_DataLevels[Byte >> 7]);
+		if(FALSE == SpiPtr->Dio_Joined)
+		{
+			HW_W_8RIG(DIO_SckAddress, SpiPtr->Dio_SckActive);
+		}
+		else
+		{
+			/* The data store is the leading edge */
+		}
+		if(0 != DIO_MisoAddress)
+		{
+			DIO_Received = (uint8)((DIO_Received << 1) | ((HW_R_8RIG(DIO_MisoAddress) >> DIO_MisoPin) & 0x01));
+		}
+		else
+		{
+			/* Nothing received */
+		}
+		HW_W_8RIG(DIO_SckAddress, SpiPtr->Dio_SckIdle);
+		Byte = (uint8)(Byte << 1);
+	}
+	
+	return DIO_Received;
+}
+
+#if(DioShadowRegisters == STD_ON)
+/**
+ *	\brief		Drops the levels of SCK, MOSI and CS from the DIO shadow, the engine stores
+ *				them to GPIODATA directly and a later DIO write of these pins has to reach the port.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\return		None.
+ */
+static void Dio_SoftSpiForgetPins(const Dio_SoftSpiType* SpiPtr)
+{
+	Dio_ShadowForgetData(DIO_SOFT_SPI_GET_PORT(SpiPtr->Dio_Sck), DIO_SOFT_SPI_GET_MASK(SpiPtr->Dio_Sck));
+	Dio_ShadowForgetData(DIO_SOFT_SPI_GET_PORT(SpiPtr->Dio_Mosi), DIO_SOFT_SPI_GET_MASK(SpiPtr->Dio_Mosi));
+	if(DIO_SOFT_SPI_NO_PIN != SpiPtr->Dio_Cs)
+	{
+		Dio_ShadowForgetData(DIO_SOFT_SPI_GET_PORT(SpiPtr->Dio_Cs), DIO_SOFT_SPI_GET_MASK(SpiPtr->Dio_Cs));
+	}
+	else
+	{
+		/* No chip select */
+	}
+}
+#endif /* DioShadowRegisters check */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Decodes the pins of a soft SPI and sets SCK to its idle level and CS high.
+ *	\param[out] SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	ConfigPtr: 	Pointer to the pins and format.
+ *	\return		Std_ReturnType:	-	E_OK: The soft SPI is ready.
+ *								-	E_NOT_OK: NULL pointer, a channel doesn't exist or bad mode.
+ */
+Std_ReturnType Dio_SoftSpiInit(Dio_SoftSpiType* SpiPtr, const Dio_SoftSpiConfigType* ConfigPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	uint8 DIO_SckPort;
+	uint8 DIO_SckMask;
+	uint8 DIO_MosiPort;
+	uint8 DIO_MosiMask;
+	uint8 DIO_SetupSck;
+	
+	if((NULL_PTR == SpiPtr) || (NULL_PTR == ConfigPtr) || (ConfigPtr->Dio_Mode > DIO_SOFT_SPI_MODE_3) ||
+	   (!DIO_SOFT_SPI_CHANNEL_EXISTS(ConfigPtr->Dio_Sck)) || (!DIO_SOFT_SPI_CHANNEL_EXISTS(ConfigPtr->Dio_Mosi)) ||
+	   ((DIO_SOFT_SPI_NO_PIN != ConfigPtr->Dio_Miso) && (!DIO_SOFT_SPI_CHANNEL_EXISTS(ConfigPtr->Dio_Miso))) ||
+	   ((DIO_SOFT_SPI_NO_PIN != ConfigPtr->Dio_Cs) && (!DIO_SOFT_SPI_CHANNEL_EXISTS(ConfigPtr->Dio_Cs))))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		DIO_SckPort = DIO_SOFT_SPI_GET_PORT(ConfigPtr->Dio_Sck);
+		DIO_SckMask = DIO_SOFT_SPI_GET_MASK(ConfigPtr->Dio_Sck);
+		DIO_MosiPort = DIO_SOFT_SPI_GET_PORT(ConfigPtr->Dio_Mosi);
+		DIO_MosiMask = DIO_SOFT_SPI_GET_MASK(ConfigPtr->Dio_Mosi);
+	
+		SpiPtr->Dio_Phase = (0 != (ConfigPtr->Dio_Mode & 0x01)) ? TRUE : FALSE;
+		SpiPtr->Dio_SckIdle = (0 != (ConfigPtr->Dio_Mode & 0x02)) ? 0xFF : 0x00;
+		SpiPtr->Dio_SckActive = (uint8)~SpiPtr->Dio_SckIdle;
+		SpiPtr->Dio_SckAddress = DIO_SOFT_SPI_ADDRESS(DIO_SckPort, DIO_SckMask);
+		SpiPtr->Dio_LsbFirst = ConfigPtr->Dio_LsbFirst;
+#if(DioShadowRegisters == STD_ON)
+		SpiPtr->Dio_Sck = ConfigPtr->Dio_Sck;
+		SpiPtr->Dio_Mosi = ConfigPtr->Dio_Mosi;
+		SpiPtr->Dio_Cs = ConfigPtr->Dio_Cs;
+#endif /* DioShadowRegisters check */
+	
+		if(DIO_SckPort == DIO_MosiPort)
+		{
+			/* One store sets the data and the clock level it is set up with */
+			DIO_SetupSck = (uint8)(((FALSE == SpiPtr->Dio_Phase) ? SpiPtr->Dio_SckIdle : SpiPtr->Dio_SckActive) & DIO_SckMask);
+			SpiPtr->Dio_Joined = TRUE;
+			SpiPtr->Dio_DataAddress = DIO_SOFT_SPI_ADDRESS(DIO_SckPort, DIO_SckMask | DIO_MosiMask);
+			SpiPtr->Dio_DataLevels[0] = DIO_SetupSck;
+			SpiPtr->Dio_DataLevels[1] = (uint32)DIO_SetupSck | DIO_MosiMask;
+		}
+		else
+		{
+			SpiPtr->Dio_Joined = FALSE;
+			SpiPtr->Dio_DataAddress = DIO_SOFT_SPI_ADDRESS(DIO_MosiPort, DIO_MosiMask);
+			SpiPtr->Dio_DataLevels[0] = 0x00;
+			SpiPtr->Dio_DataLevels[1] = 0xFF;
+		}
+	
+		if(DIO_SOFT_SPI_NO_PIN != ConfigPtr->Dio_Miso)
+		{
+			SpiPtr->Dio_MisoAddress = DIO_SOFT_SPI_ADDRESS(DIO_SOFT_SPI_GET_PORT(ConfigPtr->Dio_Miso),
+														   DIO_SOFT_SPI_GET_MASK(ConfigPtr->Dio_Miso));
+			SpiPtr->Dio_MisoPin = (uint8)(ConfigPtr->Dio_Miso & 0x07);
+		}
+		else
+		{
+			SpiPtr->Dio_MisoAddress = 0;
+			SpiPtr->Dio_MisoPin = 0;
+		}
+	
+		if(DIO_SOFT_SPI_NO_PIN != ConfigPtr->Dio_Cs)
+		{
+			SpiPtr->Dio_CsAddress = DIO_SOFT_SPI_ADDRESS(DIO_SOFT_SPI_GET_PORT(ConfigPtr->Dio_Cs),
+														 DIO_SOFT_SPI_GET_MASK(ConfigPtr->Dio_Cs));
+			HW_W_8RIG(SpiPtr->Dio_CsAddress, 0xFF);
+		}
+		else
+		{
+			SpiPtr->Dio_CsAddress = 0;
+		}
+		HW_W_8RIG(SpiPtr->Dio_SckAddress, SpiPtr->Dio_SckIdle);
+		DIO_SOFT_SPI_FORGET_PINS(SpiPtr);
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Transfers a frame: CS is driven low, the bytes are shifted out and in, then CS
+ *				is driven high.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	TxPtr: 		Pointer to the bytes to be sent, NULL_PTR sends 0xFF.
+ *	\param[out] RxPtr: 		Pointer to the received bytes, NULL_PTR drops them.
+ *	\param[in] 	Length: 	Number of bytes.
+ *	\return		None.
+ */
+void Dio_SoftSpiTransfer(const Dio_SoftSpiType* SpiPtr, const uint8* TxPtr, uint8* RxPtr, uint16 Length)
+{
+	/* Needed Variables */
+	uint16 DIO_Index;
+	uint8 DIO_Byte;
+	
+	if(0 != SpiPtr->Dio_CsAddress)
+	{
+		HW_W_8RIG(SpiPtr->Dio_CsAddress, 0x00);
+	}
+	else
+	{
+		/* No chip select */
+	}
+	
+	for(DIO_Index = 0; DIO_Index < Length; DIO_Index++)
+	{
+		DIO_Byte = (NULL_PTR != TxPtr) ? TxPtr[DIO_Index] : 0xFF;
+		if(TRUE == SpiPtr->Dio_LsbFirst)
+		{
+			DIO_Byte = Dio_SoftSpiReverse(DIO_Byte);
+		}
+		else
+		{
+			/* MSB first */
+		}
+	
+		DIO_Byte = (FALSE == SpiPtr->Dio_Phase) ? Dio_SoftSpiBytePhase0(SpiPtr, DIO_Byte) :
+												  Dio_SoftSpiBytePhase1(SpiPtr, DIO_Byte);
+	
+		if(NULL_PTR != RxPtr)
+		{
+			RxPtr[DIO_Index] = (TRUE == SpiPtr->Dio_LsbFirst) ? Dio_SoftSpiReverse(DIO_Byte) : DIO_Byte;
+		}
+		else
+		{
+			/* Received byte dropped */
+		}
+	}
+	
+	/* Trailing edge of the last bit with a clock phase of 0 */
+	HW_W_8RIG(SpiPtr->Dio_SckAddress, SpiPtr->Dio_SckIdle);
+	
+	if(0 != SpiPtr->Dio_CsAddress)
+	{
+		HW_W_8RIG(SpiPtr->Dio_CsAddress, 0xFF);
+	}
+	else
+	{
+		/* No chip select */
+	}
+	DIO_SOFT_SPI_FORGET_PINS(SpiPtr);
+}
+#endif /* DioSoftSpiApi check */
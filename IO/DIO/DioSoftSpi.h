@@ -0,0 +1,87 @@
+/**
+ *  \file	DioSoftSpi.h
+ *  \brief 	Bit-banged SPI master on DIO channels, modes 0 to 3, MSB or LSB first.
+ *  		The pins are decoded once by Dio_SoftSpiInit() into masked GPIODATA addresses
+ *  		and the values to be stored to them, so a transfer costs one store per clock
+ *  		edge and one load per received bit. When MOSI and SCK are on the same port
+ *  		the data setup and its clock edge are a single store.
+ *  		The pins are configured by the PORT driver (SCK, MOSI and CS outputs, MISO input).
+ *  		SCK runs at the store rate of the port bus, there is no delay between the edges.
+ *  		Enabled by DioSoftSpiApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_SOFT_SPI_H_
+#define DIO_SOFT_SPI_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioSoftSpiApi == STD_ON)
+/* Macros */
+#define DIO_SOFT_SPI_NO_PIN		0xFF	/*!< MISO or CS not used */
+
+/* Dio_SoftSpiModeType Macros */
+#define DIO_SOFT_SPI_MODE_0		0x00	/*!< SCK idle low, data sampled on the rising edge */
+#define DIO_SOFT_SPI_MODE_1		0x01	/*!< SCK idle low, data sampled on the falling edge */
+#define DIO_SOFT_SPI_MODE_2		0x02	/*!< SCK idle high, data sampled on the falling edge */
+#define DIO_SOFT_SPI_MODE_3		0x03	/*!< SCK idle high, data sampled on the rising edge */
+
+/* Defined data types */
+typedef uint8 Dio_SoftSpiModeType;	/*!< SPI mode, bit 1 is the clock polarity and bit 0 the clock phase */
+
+typedef struct{
+	uint8				Dio_Sck;		/*!< Channel of SCK */
+	uint8				Dio_Mosi;		/*!< Channel of MOSI */
+	uint8				Dio_Miso;		/*!< Channel of MISO, DIO_SOFT_SPI_NO_PIN if nothing is received */
+	uint8				Dio_Cs;			/*!< Channel of the active low chip select, DIO_SOFT_SPI_NO_PIN if none */
+	Dio_SoftSpiModeType	Dio_Mode;		/*!< SPI mode */
+	boolean				Dio_LsbFirst;	/*!< TRUE to shift the LSB of every byte first */
+}Dio_SoftSpiConfigType;	/*!< Pins and format of a soft SPI */
+
+typedef struct{
+	HW_AddressBusSizeType	Dio_SckAddress;		/*!< GPIODATA address masked to SCK */
+	HW_AddressBusSizeType	Dio_DataAddress;	/*!< GPIODATA address masked to MOSI, or to MOSI and SCK on the same port */
+	HW_AddressBusSizeType	Dio_MisoAddress;	/*!< GPIODATA address masked to MISO, 0 if not used */
+	HW_AddressBusSizeType	Dio_CsAddress;		/*!< GPIODATA address masked to CS, 0 if not used */
+	uint32					Dio_DataLevels[2];	/*!< Stored to Dio_DataAddress to shift a 0 or a 1 out */
+	uint8					Dio_SckIdle;		/*!< Stored to Dio_SckAddress for the idle clock level */
+	uint8					Dio_SckActive;		/*!< Stored to Dio_SckAddress for the active clock level */
+	uint8					Dio_MisoPin;		/*!< Pin of MISO in its port */
+	boolean					Dio_Phase;			/*!< Clock phase, TRUE if the data is sampled on the trailing edge */
+	boolean					Dio_Joined;			/*!< MOSI and SCK are on the same port, Dio_DataLevels hold the SCK level too */
+	boolean					Dio_LsbFirst;		/*!< The LSB of every byte is shifted first */
+#if(DioShadowRegisters == STD_ON)
+	uint8					Dio_Sck;			/*!< Channel of SCK, its level is dropped from the DIO shadow after a transfer */
+	uint8					Dio_Mosi;			/*!< Channel of MOSI, its level is dropped from the DIO shadow after a transfer */
+	uint8					Dio_Cs;				/*!< Channel of CS, its level is dropped from the DIO shadow after a transfer */
+#endif /* DioShadowRegisters check */
+}Dio_SoftSpiType;	/*!< Decoded soft SPI, filled by Dio_SoftSpiInit() */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Decodes the pins of a soft SPI and sets SCK to its idle level and CS high.
+ *	\param[out] SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	ConfigPtr: 	Pointer to the pins and format.
+ *	\return		Std_ReturnType:	-	E_OK: The soft SPI is ready.
+ *								-	E_NOT_OK: NULL pointer, a channel doesn't exist or bad mode.
+ */
+Std_ReturnType Dio_SoftSpiInit(Dio_SoftSpiType* SpiPtr, const Dio_SoftSpiConfigType* ConfigPtr);
+
+/**
+ *	\brief		Transfers a frame: CS is driven low, the bytes are shifted out and in, then CS
+ *				is driven high.
+ *	\param[in] 	SpiPtr: 	Pointer to the decoded soft SPI.
+ *	\param[in] 	TxPtr: 		Pointer to the bytes to be sent, NULL_PTR sends 0xFF.
+ *	\param[out] RxPtr: 		Pointer to the received bytes, NULL_PTR drops them.
+ *	\param[in] 	Length: 	Number of bytes.
+ *	\return		None.
+ */
+void Dio_SoftSpiTransfer(const Dio_SoftSpiType* SpiPtr, const uint8* TxPtr, uint8* RxPtr, uint16 Length);
+#endif /* DioSoftSpiApi check */
+
+#endif /* DIO_SOFT_SPI_H_ */
@@ -0,0 +1,316 @@
+/**
+ *  \file	DioStream.c
+ *  \brief 	Port output streaming through the uDMA.
+ *  		The buffers are played by a ping-pong channel writing one byte per request to
+ *  		the masked GPIODATA address, the CPU only arms a control structure per buffer
+ *  		and handles one completion per buffer.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DioStream.h"
+#include "DioShadow.h"	/* The uDMA writes the pins behind the shadow */
+
+#if(DioStreamApi == STD_ON)
+/* Macros */
+/* Polls of PRDMA before giving up on the controller clock */
+#define DIO_STREAM_CLOCK_READY_POLLS	100
+
+/* Bit of the stream channel in the channel registers */
+#define DIO_STREAM_CHANNEL_BIT			((uint32)1 << DioStreamDmaChannel)
+
+/* Control word of a buffer without its size and mode: byte images, source incremented,
+   destination fixed, one image per request */
+#define DIO_STREAM_CHCTL	(HW_UDMA_DSTINC_NONE | HW_UDMA_DSTSIZE_8 | HW_UDMA_SRCINC_8 | \
+							 HW_UDMA_SRCSIZE_8 | HW_UDMA_ARBSIZE_1)
+
+/* Control structure of a buffer, 0 is the primary structure and 1 the alternate one */
+#define DIO_STREAM_STRUCTURE(BUFFER)	\
+	(&Dio_StreamTable[((BUFFER) * HW_UDMA_ALT_WORDS) + (DioStreamDmaChannel << 2)])
+
+#if((DioStreamDmaChannel < 0) || (DioStreamDmaChannel >= HW_UDMA_NO_OF_CHANNELS))
+#error "DioStreamDmaChannel shall be a uDMA channel from 0 to 31"
+#endif
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static volatile uint32 Dio_StreamTable[HW_UDMA_TABLE_WORDS] HW_ALIGNED(1024);	/*!< uDMA channel control table */
+static HW_AddressBusSizeType Dio_StreamDestination;			/*!< Masked GPIODATA address of the stream */
+static uint8 Dio_StreamPort;								/*!< Port of the stream */
+static uint8 Dio_StreamMask;								/*!< Pins of the stream */
+static Dio_StreamNotificationType Dio_StreamNotification;	/*!< Notification of the played buffers */
+static const Dio_PortLevelType* Dio_StreamImages[2];		/*!< Buffer armed in every control structure */
+static volatile boolean Dio_StreamStarted = FALSE;			/*!< The stream is started */
+static volatile uint8 Dio_StreamArmed = 0;					/*!< Bit per control structure, set while its buffer is queued */
+static uint8 Dio_StreamNextFree = 0;						/*!< Control structure of the next queued buffer */
+static uint8 Dio_StreamNextDone = 0;						/*!< Control structure of the next played buffer */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Enables the channel if it stopped while the next buffer to be played is queued.
+ *				To be called with the interrupts locked or from the completion handler.
+ *	\param		None.
+ *	\return		None.
+ */
+static void Dio_StreamResume(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Enables the channel if it stopped while the next buffer to be played is queued.
+ *				To be called with the interrupts locked or from the completion handler.
+ *	\param		None.
+ *	\return		None.
+ */
+static void Dio_StreamResume(void)
+{
+	/* A channel that reached a structure in stop mode disabled itself */
+	if((0 != (Dio_StreamArmed & (1 << Dio_StreamNextDone))) &&
+	   (0 == (HW_R_8RIG(HW_UDMA_BA + HW_DMAENASET_OFFSET) & DIO_STREAM_CHANNEL_BIT)))
+	{
+		if(0 == Dio_StreamNextDone)
+		{
+			HW_W_8RIG((HW_UDMA_BA + HW_DMAALTCLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		}
+		else
+		{
+			HW_W_8RIG((HW_UDMA_BA + HW_DMAALTSET_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		}
+		HW_W_8RIG((HW_UDMA_BA + HW_DMAENASET_OFFSET), DIO_STREAM_CHANNEL_BIT);
+	}
+	else
+	{
+		/* Channel running or nothing to play */
+	}
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Enables the uDMA controller and sets up the stream channel.
+ *				DioStream owns the uDMA channel control table.
+ *	\param		None.
+ *	\return		Std_ReturnType:	-	E_OK: The controller is ready.
+ *								-	E_NOT_OK: The controller clock isn't ready.
+ */
+Std_ReturnType Dio_StreamInit(void)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	HW_AddressBusSizeType DIO_MapAddress = HW_UDMA_BA + HW_DMACHMAP0_OFFSET + ((DioStreamDmaChannel >> 3) << 2);
+	uint8 DIO_MapShift = (uint8)((DioStreamDmaChannel & 0x07) << 2);
+	uint8 DIO_Polls = 0;
+	
+	HW_W_8RIG((HW_SYSTEM_CONTROL_BA + HW_RCGCDMA_OFFSET), 0x01);
+	
+	/* Wait for the clock, the registers of the controller can't be accessed before it is ready */
+	while((0 == (HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_PRDMA_OFFSET) & 0x01)) &&
+		  (DIO_Polls < DIO_STREAM_CLOCK_READY_POLLS))
+	{
+		DIO_Polls++;
+	}
+	
+	if(0 == (HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_PRDMA_OFFSET) & 0x01))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		HW_W_8RIG((HW_UDMA_BA + HW_DMACFG_OFFSET), 0x01);
+		HW_W_8RIG((HW_UDMA_BA + HW_DMACTLBASE_OFFSET), (uint32)Dio_StreamTable);
+	
+		/* Trigger of the channel */
+		HW_W_8RIG(DIO_MapAddress, (HW_R_8RIG(DIO_MapAddress) & ~((uint32)0x0F << DIO_MapShift)) |
+								  ((uint32)DioStreamDmaEncoding << DIO_MapShift));
+	
+		/* Single requests only, unmasked, default priority, primary structure first */
+		HW_W_8RIG((HW_UDMA_BA + HW_DMAENACLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		HW_W_8RIG((HW_UDMA_BA + HW_DMAUSEBURSTCLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		HW_W_8RIG((HW_UDMA_BA + HW_DMAREQMASKCLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		HW_W_8RIG((HW_UDMA_BA + HW_DMAPRIOCLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		HW_W_8RIG((HW_UDMA_BA + HW_DMAALTCLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+		Dio_StreamStarted = FALSE;
+		Dio_StreamArmed = 0;
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Starts a stream, the images are played once buffers are queued.
+ *				A running stream is stopped first.
+ *	\param[in] 	ConfigPtr: 	Pointer to the stream configuration.
+ *	\return		Std_ReturnType:	-	E_OK: The stream is started.
+ *								-	E_NOT_OK: NULL pointer, no pin or the port doesn't exist.
+ */
+Std_ReturnType Dio_StreamStart(const Dio_StreamConfigType* ConfigPtr)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	
+	if((NULL_PTR == ConfigPtr) || (ConfigPtr->Dio_Port >= HW_NO_OF_PORTS) || (0 == ConfigPtr->Dio_Mask))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		Dio_StreamStop();
+		Dio_StreamPort = ConfigPtr->Dio_Port;
+		Dio_StreamMask = ConfigPtr->Dio_Mask;
+		Dio_StreamDestination = HW_PortsAddresses[ConfigPtr->Dio_Port] + HW_GPIODATA_OFFSET +
+								((HW_AddressBusSizeType)ConfigPtr->Dio_Mask << 2);
+		Dio_StreamNotification = ConfigPtr->Dio_Notification;
+		Dio_StreamStarted = TRUE;
+	
+		/* The played images don't go through the shadow */
+		Dio_ShadowForgetData(Dio_StreamPort, Dio_StreamMask);
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Queues a buffer of port images, played after the buffers queued before it.
+ *				At most two buffers are queued, a played buffer is given back by the
+ *				notification and can be refilled and queued again from it.
+ *				To be called from the task or from the notification.
+ *	\param[in] 	ImagesPtr: 	Pointer to the images, they have to stay valid until the buffer is played.
+ *	\param[in] 	Length: 	Number of images, 1 to HW_UDMA_XFERSIZE_MAX.
+ *	\return		Std_ReturnType:	-	E_OK: The buffer is queued.
+ *								-	E_NOT_OK: NULL pointer, bad length, the stream isn't started
+ *											  or two buffers are already queued.
+ */
+Std_ReturnType Dio_StreamQueue(const Dio_PortLevelType* ImagesPtr, uint16 Length)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData = E_OK;
+	volatile uint32* DIO_StructurePtr;
+	uint32 DIO_IntState;
+	
+	if((NULL_PTR == ImagesPtr) || (0 == Length) || (Length > HW_UDMA_XFERSIZE_MAX))
+	{
+		DIO_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* The structures are shared with the completion handler */
+		HW_ENTER_CRITICAL(DIO_IntState);
+		if((FALSE == Dio_StreamStarted) || (0 != (Dio_StreamArmed & (1 << Dio_StreamNextFree))))
+		{
+			DIO_RetData = E_NOT_OK;
+		}
+		else
+		{
+			/* The structure is in stop mode, the controller doesn't use it */
+			DIO_StructurePtr = DIO_STREAM_STRUCTURE(Dio_StreamNextFree);
+			DIO_StructurePtr[HW_UDMA_SRCENDP] = (uint32)&ImagesPtr[Length - 1];
+			DIO_StructurePtr[HW_UDMA_DSTENDP] = Dio_StreamDestination;
+	
+			/* The pointers are written before the structure is armed */
+			HW_MEMORY_BARRIER();
+			DIO_StructurePtr[HW_UDMA_CHCTL] = DIO_STREAM_CHCTL | ((uint32)(Length - 1) << HW_UDMA_XFERSIZE_SHIFT) |
+											  HW_UDMA_XFERMODE_PINGPONG;
+			HW_MEMORY_BARRIER();
+			Dio_StreamImages[Dio_StreamNextFree] = ImagesPtr;
+			Dio_StreamArmed |= (uint8)(1 << Dio_StreamNextFree);
+			Dio_StreamNextFree ^= 1;
+	
+			/* The channel may have reached the structure before it was armed */
+			Dio_StreamResume();
+		}
+		HW_EXIT_CRITICAL(DIO_IntState);
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Stops the stream at once and drops the queued buffers, the pins keep their levels.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_StreamStop(void)
+{
+	/* Needed Variables */
+	uint32 DIO_IntState;
+	
+	HW_ENTER_CRITICAL(DIO_IntState);
+	HW_W_8RIG((HW_UDMA_BA + HW_DMAENACLR_OFFSET), DIO_STREAM_CHANNEL_BIT);
+	HW_W_8RIG((HW_UDMA_BA + HW_DMACHIS_OFFSET), DIO_STREAM_CHANNEL_BIT);
+	DIO_STREAM_STRUCTURE(0)[HW_UDMA_CHCTL] = HW_UDMA_XFERMODE_STOP;
+	DIO_STREAM_STRUCTURE(1)[HW_UDMA_CHCTL] = HW_UDMA_XFERMODE_STOP;
+	Dio_StreamStarted = FALSE;
+	Dio_StreamArmed = 0;
+	Dio_StreamNextFree = 0;
+	Dio_StreamNextDone = 0;
+	
+	/* A DIO write between the start and the stop may have marked the levels known again */
+	Dio_ShadowForgetData(Dio_StreamPort, Dio_StreamMask);
+	HW_EXIT_CRITICAL(DIO_IntState);
+}
+
+/**
+ *	\brief		Returns the state of the stream.
+ *	\param		None.
+ *	\return		Dio_StreamStateType:	DIO_STREAM_IDLE, DIO_STREAM_READY or DIO_STREAM_RUNNING.
+ */
+Dio_StreamStateType Dio_StreamGetState(void)
+{
+	/* Needed Variables */
+	Dio_StreamStateType DIO_State = DIO_STREAM_IDLE;
+	
+	if(TRUE == Dio_StreamStarted)
+	{
+		DIO_State = (0 != Dio_StreamArmed) ? DIO_STREAM_RUNNING : DIO_STREAM_READY;
+	}
+	else
+	{
+		/* Not started */
+	}
+	
+	return DIO_State;
+}
+
+/**
+ *	\brief		Completion handler, to be called from the interrupt handler of the timer
+ *				triggering the channel. Calls the notification of every played buffer and
+ *				restarts the channel if it ran out of buffers before one was queued.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_StreamIsr(void)
+{
+	/* Needed Variables */
+	const Dio_PortLevelType* DIO_ImagesPtr;
+	
+	if(0 != (HW_R_8RIG(HW_UDMA_BA + HW_DMACHIS_OFFSET) & DIO_STREAM_CHANNEL_BIT))
+	{
+		HW_W_8RIG((HW_UDMA_BA + HW_DMACHIS_OFFSET), DIO_STREAM_CHANNEL_BIT);
+	
+		/* The played images left the pins at levels the shadow doesn't know */
+		Dio_ShadowForgetData(Dio_StreamPort, Dio_StreamMask);
+	
+		/* The controller sets a played structure back to stop mode, buffers complete in order */
+		while((0 != (Dio_StreamArmed & (1 << Dio_StreamNextDone))) &&
+			  (HW_UDMA_XFERMODE_STOP == (DIO_STREAM_STRUCTURE(Dio_StreamNextDone)[HW_UDMA_CHCTL] & HW_UDMA_XFERMODE_MASK)))
+		{
+			DIO_ImagesPtr = Dio_StreamImages[Dio_StreamNextDone];
+			Dio_StreamArmed &= (uint8)~(1 << Dio_StreamNextDone);
+			Dio_StreamNextDone ^= 1;
+			if(NULL_PTR != Dio_StreamNotification)
+			{
+				Dio_StreamNotification(DIO_ImagesPtr);
+			}
+			else
+			{
+				/* Nobody to notify */
+			}
+		}
+		Dio_StreamResume();
+	}
+	else
+	{
+		/* Interrupt of the timer itself */
+	}
+}
+#endif /* DioStreamApi check */
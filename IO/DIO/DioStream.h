@@ -0,0 +1,98 @@
+/**
+ *  \file	DioStream.h
+ *  \brief 	Port output streaming through the uDMA. A buffer of port images is moved by a
+ *  		uDMA channel to the masked GPIODATA address of a port, one image per request of
+ *  		the timer mapped to the channel, so the CPU is only involved once per buffer.
+ *  		Two buffers are played in ping-pong: while one is played the other one can be
+ *  		refilled and queued, the notification of a buffer is called once it is played.
+ *  		The timer is configured and started by the integrator with its uDMA request
+ *  		enabled, its interrupt handler calls Dio_StreamIsr().
+ *  		Enabled by DioStreamApi in DioGeneral.h.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DIO_STREAM_H_
+#define DIO_STREAM_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DIO.h"
+
+#if(DioStreamApi == STD_ON)
+/* Macros */
+/* Dio_StreamStateType Macros */
+#define DIO_STREAM_IDLE		0x00	/*!< Not started or stopped */
+#define DIO_STREAM_READY	0x01	/*!< Started, no buffer is queued, the pins keep their levels */
+#define DIO_STREAM_RUNNING	0x02	/*!< Buffers are queued */
+
+/* Defined data types */
+typedef uint8 Dio_StreamStateType;	/*!< State of the stream */
+
+typedef void (*Dio_StreamNotificationType)(const Dio_PortLevelType* ImagesPtr);	/*!< Notification of a played buffer */
+
+typedef struct{
+	Dio_PortType				Dio_Port;			/*!< Port of the stream */
+	Dio_PortLevelType			Dio_Mask;			/*!< Pins written by the stream, the other pins of the port are kept */
+	Dio_StreamNotificationType	Dio_Notification;	/*!< Called from Dio_StreamIsr() with every played buffer, may be NULL_PTR */
+}Dio_StreamConfigType;	/*!< Stream configuration */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Enables the uDMA controller and sets up the stream channel.
+ *				DioStream owns the uDMA channel control table.
+ *	\param		None.
+ *	\return		Std_ReturnType:	-	E_OK: The controller is ready.
+ *								-	E_NOT_OK: The controller clock isn't ready.
+ */
+Std_ReturnType Dio_StreamInit(void);
+
+/**
+ *	\brief		Starts a stream, the images are played once buffers are queued.
+ *				A running stream is stopped first.
+ *	\param[in] 	ConfigPtr: 	Pointer to the stream configuration.
+ *	\return		Std_ReturnType:	-	E_OK: The stream is started.
+ *								-	E_NOT_OK: NULL pointer, no pin or the port doesn't exist.
+ */
+Std_ReturnType Dio_StreamStart(const Dio_StreamConfigType* ConfigPtr);
+
+/**
+ *	\brief		Queues a buffer of port images, played after the buffers queued before it.
+ *				At most two buffers are queued, a played buffer is given back by the
+ *				notification and can be refilled and queued again from it.
+ *				To be called from the task or from the notification.
+ *	\param[in] 	ImagesPtr: 	Pointer to the images, they have to stay valid until the buffer is played.
+ *	\param[in] 	Length: 	Number of images, 1 to HW_UDMA_XFERSIZE_MAX.
+ *	\return		Std_ReturnType:	-	E_OK: The buffer is queued.
+ *								-	E_NOT_OK: NULL pointer, bad length, the stream isn't started
+ *											  or two buffers are already queued.
+ */
+Std_ReturnType Dio_StreamQueue(const Dio_PortLevelType* ImagesPtr, uint16 Length);
+
+/**
+ *	\brief		Stops the stream at once and drops the queued buffers, the pins keep their levels.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_StreamStop(void);
+
+/**
+ *	\brief		Returns the state of the stream.
+ *	\param		None.
+ *	\return		Dio_StreamStateType:	DIO_STREAM_IDLE, DIO_STREAM_READY or DIO_STREAM_RUNNING.
+ */
+Dio_StreamStateType Dio_StreamGetState(void);
+
+/**
+ *	\brief		Completion handler, to be called from the interrupt handler of the timer
+ *				triggering the channel. Calls the notification of every played buffer and
+ *				restarts the channel if it ran out of buffers before one was queued.
+ *	\param		None.
+ *	\return		None.
+ */
+void Dio_StreamIsr(void);
+#endif /* DioStreamApi check */
+
+#endif /* DIO_STREAM_H_ */
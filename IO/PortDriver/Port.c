@@ -13,7 +13,10 @@
 
 /* Inclusion */
 #include "Port.h"
-#include <assert.h>
+#include "DioShadow.h"	/* Shadowed access to the configuration and data registers */
+#if(PortDevErrorDetect == STD_ON)
+#include "Det.h"			/* Development errors reporting */
+#endif /* PortDevErrorDetect check */
 
 /* Macroos */
 /* Pin ID is defined as 2 bytes ID
@@ -25,20 +28,163 @@
 /* Get Pin number from Pin ID */
 #define PORT_GET_PIN(PORT_PIN_TYPE)		(uint8)(PORT_PIN_TYPE & (0x0F))
 
+/* Get the index of a pin in Port_PctlTable from Pin ID */
+#define PORT_GET_PIN_INDEX(PORT_PIN_TYPE)	(uint8)((PORT_GET_PORT(PORT_PIN_TYPE) << 3) + PORT_GET_PIN(PORT_PIN_TYPE))
+
+/* Port_PctlTable entry of a mode which isn't available on a pin */
+#define PORT_PCTL_NA	0xFF
+
+/* Bits of a Port_InterruptSenseTable entry */
+#define PORT_SENSE_IS	0x01	/* GPIOIS bit, level sensitive */
+#define PORT_SENSE_IBE	0x02	/* GPIOIBE bit, both edges */
+#define PORT_SENSE_IEV	0x04	/* GPIOIEV bit, rising edge or high level */
+
+/* Pins mask of a port whose 8 pins are in the configuration set */
+#define PORT_ALL_PINS	0xFF
+
 /* Private variabes */
 extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
 
+/* Private data types */
+typedef enum{
+	PORT_REG_DIR = 0,	/*!< GPIODIR register */
+	PORT_REG_DR2R,		/*!< GPIODR2R register */
+	PORT_REG_DR4R,		/*!< GPIODR4R register */
+	PORT_REG_DR8R,		/*!< GPIODR8R register */
+	PORT_REG_PUR,		/*!< GPIOPUR register */
+	PORT_REG_PDR,		/*!< GPIOPDR register */
+	PORT_REG_ODR,		/*!< GPIOODR register */
+	PORT_REG_DEN,		/*!< GPIODEN register */
+	PORT_REG_AFSEL,		/*!< GPIOAFSEL register */
+	PORT_NO_OF_REGS		/*!< Number of folded registers */
+}Port_RegIndexType;	/*!< Index of a register folded by Port_Init */
+
+typedef struct{
+	uint8 Port_SetMask;		/*!< Bits to be set in the register */
+	uint8 Port_ClearMask;	/*!< Bits to be cleared in the register */
+}Port_RegMaskType;	/*!< Set and clear masks of one port register */
+
+typedef struct{
+	Port_RegMaskType	Port_RegMasks[PORT_NO_OF_REGS];	/*!< Masks of all folded registers */
+	uint8				Port_PinsMask;		/*!< Pins of the port found in the configuration set */
+	uint8				Port_LevelMask;		/*!< Output pins of the port */
+	uint8				Port_Level;			/*!< Initial levels of the output pins */
+	uint8				Port_DirRefreshMask;	/*!< Pins of the port whose direction is unchangeable */
+	uint32				Port_PctlMask;		/*!< GPIOPCTL nibbles of the pins found in the configuration set */
+	uint32				Port_Pctl;			/*!< GPIOPCTL encodings of the pins found in the configuration set */
+	uint8				Port_IntPins;		/*!< Pins of the port whose interrupt sense is configured */
+	uint8				Port_Is;			/*!< GPIOIS bits of Port_IntPins */
+	uint8				Port_Ibe;			/*!< GPIOIBE bits of Port_IntPins */
+	uint8				Port_Iev;			/*!< GPIOIEV bits of Port_IntPins */
+}Port_PortMasksType;	/*!< Folded configuration of one port */
+
+/* Private constants */
+static const Dio_ShadowRegType Port_ShadowRegs[PORT_NO_OF_REGS] = {
+	DIO_SHADOW_DIR,
+	DIO_SHADOW_DR2R,
+	DIO_SHADOW_DR4R,
+	DIO_SHADOW_DR8R,
+	DIO_SHADOW_PUR,
+	DIO_SHADOW_PDR,
+	DIO_SHADOW_ODR,
+	DIO_SHADOW_DEN,
+	DIO_SHADOW_AFSEL
+};	/*!< Shadowed registers of the folded registers, indexed by Port_RegIndexType */
+
+static const uint8 Port_InterruptSenseTable[PORT_INTERRUPT_HIGH + 1] = {
+	0,									/* PORT_INTERRUPT_NONE */
+	PORT_SENSE_IEV,						/* PORT_INTERRUPT_RISING */
+	0,									/* PORT_INTERRUPT_FALLING */
+	PORT_SENSE_IBE,						/* PORT_INTERRUPT_BOTH */
+	PORT_SENSE_IS,						/* PORT_INTERRUPT_LOW */
+	(PORT_SENSE_IS | PORT_SENSE_IEV)	/* PORT_INTERRUPT_HIGH */
+};	/*!< GPIOIS, GPIOIBE and GPIOIEV bits of each interrupt sense, indexed by Port_PinInterruptType */
+
+static const uint8 Port_PctlTable[HW_NO_OF_PORTS << 3][PORT_NO_OF_PIN_MODES] = {
+	/*        DIO,          ADC,         UART,          SSI,          I2C,          CAN,          USB,           AC,          PWM,          QEI */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA,          0x8, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PA0 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA,          0x8, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PA1 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PA2 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PA3 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PA4 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PA5 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x3, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x5, PORT_PCTL_NA},	/* PA6 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x3, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x5, PORT_PCTL_NA},	/* PA7 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PB0 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PB1 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x3, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PB2 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x3, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PB3 */
+	{         0x0,          0x0, PORT_PCTL_NA,          0x2, PORT_PCTL_NA,          0x8, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PB4 */
+	{         0x0,          0x0, PORT_PCTL_NA,          0x2, PORT_PCTL_NA,          0x8, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PB5 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PB6 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PB7 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PC0 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PC1 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PC2 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PC3 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x0,          0x4,          0x6},	/* PC4 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x0,          0x4,          0x6},	/* PC5 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x8,          0x0, PORT_PCTL_NA,          0x6},	/* PC6 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x8,          0x0, PORT_PCTL_NA, PORT_PCTL_NA},	/* PC7 */
+	{         0x0,          0x0, PORT_PCTL_NA,          0x1,          0x3, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PD0 */
+	{         0x0,          0x0, PORT_PCTL_NA,          0x1,          0x3, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PD1 */
+	{         0x0,          0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA,          0x8, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PD2 */
+	{         0x0,          0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA,          0x8, PORT_PCTL_NA, PORT_PCTL_NA,          0x6},	/* PD3 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PD4 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PD5 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x4,          0x6},	/* PD6 */
+	{         0x0, PORT_PCTL_NA,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x6},	/* PD7 */
+	{         0x0,          0x0,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PE0 */
+	{         0x0,          0x0,          0x1, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PE1 */
+	{         0x0,          0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PE2 */
+	{         0x0,          0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PE3 */
+	{         0x0,          0x0,          0x1, PORT_PCTL_NA,          0x3,          0x8, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PE4 */
+	{         0x0,          0x0,          0x1, PORT_PCTL_NA,          0x3,          0x8, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PE5 */
+	{PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PE6 */
+	{PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PE7 */
+	{         0x0, PORT_PCTL_NA,          0x1,          0x2, PORT_PCTL_NA,          0x3, PORT_PCTL_NA,          0x9,          0x5,          0x6},	/* PF0 */
+	{         0x0, PORT_PCTL_NA,          0x1,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x9,          0x5,          0x6},	/* PF1 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x4, PORT_PCTL_NA},	/* PF2 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA,          0x2, PORT_PCTL_NA,          0x3, PORT_PCTL_NA, PORT_PCTL_NA,          0x5, PORT_PCTL_NA},	/* PF3 */
+	{         0x0, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA,          0x8, PORT_PCTL_NA,          0x5,          0x6},	/* PF4 */
+	{PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PF5 */
+	{PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA},	/* PF6 */
+	{PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA, PORT_PCTL_NA}	/* PF7 */
+};	/*!< GPIOPCTL encoding of every mode on every pin (TM4C123GH6PM alternate functions),
+		 PORT_PCTL_NA if the mode isn't available on the pin, indexed by PORT_GET_PIN_INDEX and mode */
+
+/* Direction refresh data, recorded by Port_Init */
+static uint8 Port_ExpectedDirection[HW_NO_OF_PORTS];	/*!< Configured GPIODIR value of every port */
+static uint8 Port_DirRefreshMask[HW_NO_OF_PORTS];		/*!< Pins whose direction is refreshed in every port */
+static Port_PortType Port_RefreshPorts[HW_NO_OF_PORTS];	/*!< Ports having pins to be refreshed */
+static uint8 Port_NoOfRefreshPorts = 0;					/*!< Number of ports in Port_RefreshPorts */
+#if(PortRefreshAmortized == STD_ON)
+static uint8 Port_NextRefreshPort = 0;					/*!< Index in Port_RefreshPorts of the next port to be refreshed */
+#endif /* PortRefreshAmortized check */
+
+/* Commit sessions */
+static uint8 Port_SessionDepth[HW_NO_OF_PORTS];		/*!< Number of open commit sessions of every port */
+static uint8 Port_SessionCommit[HW_NO_OF_PORTS];		/*!< GPIOCR value before the session was opened */
+static uint8 Port_SessionPins[HW_NO_OF_PORTS];			/*!< GPIOCR value during the session */
 
 /* Local functions proto type */
+#if(PortDevErrorDetect == STD_ON)
 /**
  *	\brief		Checks the Port_ConfigType parameter.
  *	\param[in] 	ConfigPtr: 	Pointer to configuration set.
- *	\return		StatusType: -	E_OK: if the size of the data
- *								in passed struct is equal to the size of Port_ConfigType.
+ *	\return		StatusType: -	E_OK: if the set and all of its pins configurations are valid.
  *							-	E_NOT_OK: otherwise.
  */
 static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr);
 
+/**
+ *	\brief		Checks the configuration of a single pin.
+ *	\param[in] 	PinConfigPtr: 	Pointer to pin configuration.
+ *	\return		StatusType: -	E_OK: if all members of the pin configuration are valid.
+ *							-	E_NOT_OK: otherwise.
+ */
+static StatusType Port_PinConfigCheck(const Port_PinConfigType* PinConfigPtr);
+
 /**
  *	\brief		Checks the Port_PortPin parameter.
  *	\param[in] 	Port_PortPin: 	Pin which needs to be initial.
@@ -46,56 +192,169 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr);
  *							-	E_NOT_OK: otherwise.
  */
 static StatusType Port_PortPinCheck(Port_PinType Port_PortPin);
+#endif /* PortDevErrorDetect check */
 
 /**
- *	\brief		Checks the Port_PinModeType parameter.
+ *	\brief		Checks the Port_PinModeType parameter against the pin, also without
+ *				PortDevErrorDetect: Port_SetPinMode() and the folding of Port_Init() must not
+ *				index the PCTL table out of its bounds nor write the PORT_PCTL_NA marker.
+ *	\param[in] 	Port_PortPin: 		Pin which needs to be initial, not checked by Port_PortPinCheck
+ *									without PortDevErrorDetect, so its row is range checked here.
  *	\param[in] 	Port_PortPinMode: 	Pin Mode which needs to be initial.
- *	\return		StatusType: -	E_OK: if the Mode supported the board.
+ *	\return		StatusType: -	E_OK: if the pin exists and the Mode is available on it.
  *							-	E_NOT_OK: otherwise.
  */
-static StatusType Port_PortPinModeCheck(Port_PinModeType Port_PortPinMode);
+static StatusType Port_PortPinModeCheck(Port_PinType Port_PortPin, Port_PinModeType Port_PortPinMode);
 
-/* Local functions delcaration */
+/**
+ *	\brief		Adds (or removes) a pin to the set (or clear) mask of a register.
+ *	\param[out] RegMaskPtr: Pointer to the register masks.
+ *	\param[in] 	PinMask: 	Bit mask of the pin.
+ *	\param[in] 	SetBit: 	TRUE to set the pin bit, FALSE to clear it.
+ *	\return		None.
+ */
+static void Port_FoldBit(Port_RegMaskType* RegMaskPtr, uint8 PinMask, boolean SetBit);
+
+/**
+ *	\brief		Folds the configuration of a single pin into the masks of its port.
+ *	\param[in] 	PinConfigPtr: 	Pointer to pin configuration.
+ *	\param[out] PortMasksPtr: 	Pointer to the folded masks of the pin's port.
+ *	\return		None.
+ */
+static void Port_FoldPinConfig(const Port_PinConfigType* PinConfigPtr, Port_PortMasksType* PortMasksPtr);
+
+/**
+ *	\brief		Writes the folded masks of a port to its registers.
+ *				A port whose 8 pins are all in the configuration set is owned by it, its registers
+ *				are stored without being read: at most 16 bus transactions (unlock and commit 3,
+ *				GPIODATA 1, GPIOPCTL 1, 9 registers, relock 2), less a store per drive strength
+ *				no pin uses. The registers of any other port are read-modify-written to keep the
+ *				pins outside of the configuration set, up to 26 transactions: Port_Init() drops
+ *				the DIO shadow, so the read is the only source of their bits. Interrupt sense
+ *				changes add to both.
+ *	\param[in] 	PortId: 		ID of the port.
+ *	\param[in] 	PortMasksPtr: 	Pointer to the folded masks of the port.
+ *	\return		None.
+ */
+static void Port_ApplyPortMasks(Port_PortType PortId, const Port_PortMasksType* PortMasksPtr);
+
+/**
+ *	\brief		Stores the precomputed registers image of a port.
+ *	\param[in] 	PortId: 		ID of the port.
+ *	\param[in] 	PortImagePtr: 	Pointer to the registers image of the port.
+ *	\return		None.
+ */
+static void Port_ApplyPortImage(Port_PortType PortId, const Port_PortImageType* PortImagePtr);
+
+/**
+ *	\brief		Configures the interrupt sense of pins of a port, their interrupts are left masked
+ *				and any interrupt latched while the sense was changing is cleared.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	IntPins: 	Pins whose interrupt sense is configured.
+ *	\param[in] 	Is: 		GPIOIS bits of IntPins.
+ *	\param[in] 	Ibe: 		GPIOIBE bits of IntPins.
+ *	\param[in] 	Iev: 		GPIOIEV bits of IntPins.
+ *	\return		None.
+ */
+static void Port_ApplyInterruptSense(Port_PortType PortId, uint8 IntPins, uint8 Is, uint8 Ibe, uint8 Iev);
+
+/**
+ *	\brief		Enables the clocks of the used ports with one write and waits until they are ready,
+ *				then selects the AHB aperture for the ports of HW_GPIO_AHB_PORTS.
+ *				A port still not ready after PortClockReadyTimeout polls is reported to DET.
+ *	\param[in] 	PortsMask: 	Ports used by the configuration set (RCGCGPIO bits).
+ *	\return		uint8: 		Ports of PortsMask whose clock is ready, the others mustn't be accessed.
+ */
+static uint8 Port_EnableClocks(uint8 PortsMask);
+
+/**
+ *	\brief		Records the configured direction of a port to be restored by the refresh.
+ *	\param[in] 	PortId: 		ID of the port.
+ *	\param[in] 	Direction: 		Configured GPIODIR value of the port.
+ *	\param[in] 	RefreshMask: 	Pins whose direction is unchangeable.
+ *	\return		None.
+ */
+static void Port_RecordDirection(Port_PortType PortId, uint8 Direction, uint8 RefreshMask);
+
+/**
+ *	\brief		Restores the configured direction of the unchangeable pins of a port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		None.
+ */
+static void Port_RefreshPort(Port_PortType PortId);
+
+/**
+ *	\brief		Initializes the ports by folding the configuration set at runtime.
+ *	\param[in] 	ConfigPtr: 	Pointer to configuration set.
+ *	\return		None.
+ */
+static void Port_InitFolded(const Port_ConfigType* ConfigPtr);
+
+/**
+ *	\brief		Initializes the ports from precomputed registers images.
+ *	\param[in] 	ImageSetPtr: 	Pointer to the registers images of all ports.
+ *	\return		None.
+ */
+static void Port_InitImages(const Port_ImageSetType* ImageSetPtr);
 
+/* Local functions delcaration */
+#if(PortDevErrorDetect == STD_ON)
 /**
  *	\brief		Checks the Port_ConfigType parameter.
  *	\param[in] 	ConfigPtr: 	Pointer to configuration set.
- *	\return		StatusType: -	E_OK: if the size of the data
- *								in passed struct is equal to the size of Port_ConfigType.
+ *	\return		StatusType: -	E_OK: if the set and all of its pins configurations are valid.
  *							-	E_NOT_OK: otherwise.
  */
 static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 {
 	/* Needed variables */
-	Port_PortType Port_PortId; /* Holds port ID */
-	uint8 Port_PinNumber;	/* Holds Pin number */
+	uint8 Port_PinIndex;	/* Index of the pin in the set */
 	StatusType Port_RetData = E_OK; /* Holds return value */
 	
 	/* Null pointer check */
-	if(NULL_PTR == ConfigPtr)
+	if((NULL_PTR == ConfigPtr) || (NULL_PTR == ConfigPtr->Port_PinsConfig))
 	{
 		Port_RetData = E_NOT_OK;
 	}
 	else
 	{
-		/* MISRA-C Rule */
-		/* Rule 14.10 (required): All if  else if constructs shall 
-		   be terminated with an else clause */
+		/* Containing data check */
+		for(Port_PinIndex = 0; Port_PinIndex < ConfigPtr->Port_NumberOfPins; Port_PinIndex++)
+		{
+			if(E_NOT_OK == Port_PinConfigCheck(&ConfigPtr->Port_PinsConfig[Port_PinIndex]))
+			{
+				Port_RetData = E_NOT_OK;
+			}
+			else
+			{
+				/* MISRA-C Rule */
+				/* Rule 14.10 (required): All if  else if constructs shall 
+				   be terminated with an else clause */
+			}
+		}
 	}
 	
-	/* size of the pointer check */
-	if(sizeof(* ConfigPtr) != sizeof(Port_ConfigType)){
-		Port_RetData = E_NOT_OK;
-	}
-	else
-	{
-		/* MISRA-C Rule */
-		/* Rule 14.10 (required): All if  else if constructs shall 
-		   be terminated with an else clause */
-	}
+	/* Return the result */
+	return Port_RetData;
+}
+
+/**
+ *	\brief		Checks the configuration of a single pin.
+ *	\param[in] 	PinConfigPtr: 	Pointer to pin configuration.
+ *	\return		StatusType: -	E_OK: if all members of the pin configuration are valid.
+ *							-	E_NOT_OK: otherwise.
+ */
+static StatusType Port_PinConfigCheck(const Port_PinConfigType* PinConfigPtr)
+{
+	/* Needed variables */
+	StatusType Port_RetData = E_OK; /* Holds return value */
 	
 	/* Containing data check */
-	if(E_NOT_OK == Port_PortPinCheck(ConfigPtr->Port_Pin))
+	if(E_NOT_OK == Port_PortPinCheck(PinConfigPtr->Port_Pin))
+	{
+		Port_RetData = E_NOT_OK;
+	}	
+	else if(E_NOT_OK == Port_PortPinModeCheck(PinConfigPtr->Port_Pin, PinConfigPtr->Port_PinMode))
 	{
 		Port_RetData = E_NOT_OK;
 	}	
@@ -106,10 +365,7 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 		   be terminated with an else clause */
 	}
 	
-	
-	Port_PortPinModeCheck(ConfigPtr->Port_PinMode);
-	
-	switch(ConfigPtr->Port_Current)
+	switch(PinConfigPtr->Port_Current)
 	{
 		case PORT_CURRENT_DEFAULT:
 		case PORT_CURRENT_2mA:
@@ -121,7 +377,7 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 			Port_RetData = E_NOT_OK;
 	}
 	
-	switch(ConfigPtr->Port_PinMode)
+	switch(PinConfigPtr->Port_PinDirection)
 	{
 		case PORT_PIN_IN:
 		case PORT_PIN_OUT:
@@ -131,7 +387,7 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 			Port_RetData = E_NOT_OK;
 	}
 	
-	switch(ConfigPtr->Port_PinLevelInit)
+	switch(PinConfigPtr->Port_PinLevelInit)
 	{
 		case STD_HIGH:
 		case STD_LOW:
@@ -141,7 +397,7 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 			Port_RetData = E_NOT_OK;
 	}
 	
-	switch(ConfigPtr->Port_PinPullUpRes)
+	switch(PinConfigPtr->Port_PinPullUpRes)
 	{
 		case PORT_PULL_UP_DISABLE:
 		case PORT_PULL_UP_ENABLE:
@@ -151,7 +407,7 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 			Port_RetData = E_NOT_OK;
 	}
 	
-	switch(ConfigPtr->Port_PinPullDownRes)
+	switch(PinConfigPtr->Port_PinPullDownRes)
 	{
 		case PORT_PULL_DOWN_DISABLE:
 		case PORT_PULL_DOWN_ENABLE:
@@ -161,7 +417,7 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 			Port_RetData = E_NOT_OK;
 	}
 	
-	switch(ConfigPtr->Port_PinOpenDrain)
+	switch(PinConfigPtr->Port_PinOpenDrain)
 	{
 		case PORT_OPEN_DRAIN_DISABLE:	
 		case PORT_OPEN_DRAIN_ENABLE	:
@@ -171,6 +427,15 @@ static StatusType Port_ConfigTypeCheck(const Port_ConfigType* ConfigPtr)
 			Port_RetData = E_NOT_OK;
 	}	
 	
+	if(PORT_INTERRUPT_HIGH < PinConfigPtr->Port_PinInterrupt)
+	{
+		Port_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* Correct interrupt sense */
+	}
+	
 	/* Return the result */
 	return Port_RetData;
 }
@@ -224,159 +489,559 @@ static StatusType Port_PortPinCheck(Port_PinType Port_PortPin)
     /* return the result */
     return Port_RetData;
 }
+#endif /* PortDevErrorDetect check */
 
 /**
- *	\brief		Checks the Port_PinModeType parameter.
+ *	\brief		Checks the Port_PinModeType parameter against the pin, also without
+ *				PortDevErrorDetect: Port_SetPinMode() and the folding of Port_Init() must not
+ *				index the PCTL table out of its bounds nor write the PORT_PCTL_NA marker.
+ *	\param[in] 	Port_PortPin: 		Pin which needs to be initial, not checked by Port_PortPinCheck
+ *									without PortDevErrorDetect, so its row is range checked here.
  *	\param[in] 	Port_PortPinMode: 	Pin Mode which needs to be initial.
- *	\return		StatusType: -	E_OK: if the Mode supported the board.
+ *	\return		StatusType: -	E_OK: if the pin exists and the Mode is available on it.
  *							-	E_NOT_OK: otherwise.
  */
-static StatusType Port_PortPinModeCheck(Port_PinModeType Port_PortPinMode)
+static StatusType Port_PortPinModeCheck(Port_PinType Port_PortPin, Port_PinModeType Port_PortPinMode)
 {
     /* Needed variables */
     StatusType Port_RetData = E_OK;
     
     /* Function logic */
-    switch(Port_PortPinMode)
-	{
-		case PORT_PIN_DIO:
-		case PORT_PIN_ADC:
-		case PORT_PIN_UART:
-		case PORT_PIN_SSI:
-		case PORT_PIN_I2C:
-		case PORT_PIN_CAN:
-		case PORT_PIN_USB:
-		case PORT_PIN_AC:
-		case PORT_PIN_PWM:
-	    case PORT_PIN_QEI:
-			/* No action "correct mode" */
-		break;
-		default:
-			Port_RetData = E_NOT_OK;
+    /* Pins 8 to 15 would index the row of a pin of the next port, the missing pins have no encoding.
+       Then one table load, the table holds no encoding for the modes that aren't available on the pin */
+    if((Port_PortPinMode >= PORT_NO_OF_PIN_MODES) ||
+       (PORT_GET_PIN(Port_PortPin) > 7) ||
+       (PORT_GET_PIN_INDEX(Port_PortPin) >= (sizeof(Port_PctlTable) / sizeof(Port_PctlTable[0]))) ||
+       (PORT_PCTL_NA == Port_PctlTable[PORT_GET_PIN_INDEX(Port_PortPin)][Port_PortPinMode]))
+	{
+		Port_RetData = E_NOT_OK;
+	}
+	else
+	{
+		/* Mode is available on the pin */
 	}
     
     /* Return the result */
     return Port_RetData;
 }
 
-/* Global functions definitions */
 /**
- *	\brief		Initializes the Port Driver module.
+ *	\brief		Adds (or removes) a pin to the set (or clear) mask of a register.
+ *	\param[out] RegMaskPtr: Pointer to the register masks.
+ *	\param[in] 	PinMask: 	Bit mask of the pin.
+ *	\param[in] 	SetBit: 	TRUE to set the pin bit, FALSE to clear it.
+ *	\return		None.
+ */
+static void Port_FoldBit(Port_RegMaskType* RegMaskPtr, uint8 PinMask, boolean SetBit)
+{
+	/* The last configuration of a pin wins */
+	if(SetBit)
+	{
+		RegMaskPtr->Port_SetMask |= PinMask;
+		RegMaskPtr->Port_ClearMask &= (uint8)~PinMask;
+	}
+	else
+	{
+		RegMaskPtr->Port_ClearMask |= PinMask;
+		RegMaskPtr->Port_SetMask &= (uint8)~PinMask;
+	}
+}
+
+/**
+ *	\brief		Folds the configuration of a single pin into the masks of its port.
+ *	\param[in] 	PinConfigPtr: 	Pointer to pin configuration.
+ *	\param[out] PortMasksPtr: 	Pointer to the folded masks of the pin's port.
+ *	\return		None.
+ */
+static void Port_FoldPinConfig(const Port_PinConfigType* PinConfigPtr, Port_PortMasksType* PortMasksPtr)
+{
+	/* Needed variables */
+	uint8 Port_PinMask = (uint8)(1 << PORT_GET_PIN(PinConfigPtr->Port_Pin));
+	uint8 Port_PctlShift;
+	uint8 Port_Sense;
+	
+	PortMasksPtr->Port_PinsMask |= Port_PinMask;
+	
+	/* Direction refresh */
+	if(PORT_PIN_DIRECTION_CHANGEABLE == PinConfigPtr->Port_PinDirectionChangeable)
+	{
+		PortMasksPtr->Port_DirRefreshMask &= (uint8)~Port_PinMask;
+	}
+	else
+	{
+		PortMasksPtr->Port_DirRefreshMask |= Port_PinMask;
+	}
+	
+	/* Direction and initial level of output pins */
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_DIR], Port_PinMask,
+				(boolean)(PORT_PIN_OUT == PinConfigPtr->Port_PinDirection));
+	if(PORT_PIN_OUT == PinConfigPtr->Port_PinDirection)
+	{
+		PortMasksPtr->Port_LevelMask |= Port_PinMask;
+	}
+	else
+	{
+		PortMasksPtr->Port_LevelMask &= (uint8)~Port_PinMask;
+	}
+	if(STD_HIGH == PinConfigPtr->Port_PinLevelInit)
+	{
+		PortMasksPtr->Port_Level |= Port_PinMask;
+	}
+	else
+	{
+		PortMasksPtr->Port_Level &= (uint8)~Port_PinMask;
+	}
+	
+	/* Drive strength */
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_DR2R], Port_PinMask,
+				(boolean)(PORT_CURRENT_2mA == PinConfigPtr->Port_Current));
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_DR4R], Port_PinMask,
+				(boolean)(PORT_CURRENT_4mA == PinConfigPtr->Port_Current));
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_DR8R], Port_PinMask,
+				(boolean)(PORT_CURRENT_8mA == PinConfigPtr->Port_Current));
+	
+	/* Pull-up, pull-down and open drain */
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_PUR], Port_PinMask,
+				(boolean)(PORT_PULL_UP_ENABLE == PinConfigPtr->Port_PinPullUpRes));
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_PDR], Port_PinMask,
+				(boolean)(PORT_PULL_DOWN_ENABLE == PinConfigPtr->Port_PinPullDownRes));
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_ODR], Port_PinMask,
+				(boolean)(PORT_OPEN_DRAIN_ENABLE == PinConfigPtr->Port_PinOpenDrain));
+	
+	/* Digital enable for all modes except for ADC,
+	   alternate function for all modes except for DIO and ADC */
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_DEN], Port_PinMask,
+				(boolean)(PORT_PIN_ADC != PinConfigPtr->Port_PinMode));
+	Port_FoldBit(&PortMasksPtr->Port_RegMasks[PORT_REG_AFSEL], Port_PinMask,
+				(boolean)((PORT_PIN_ADC != PinConfigPtr->Port_PinMode) &&
+						  (PORT_PIN_DIO != PinConfigPtr->Port_PinMode)));
+	
+	/* Signal routed to the pin */
+	Port_PctlShift = (uint8)(PORT_GET_PIN(PinConfigPtr->Port_Pin) << 2);
+	PortMasksPtr->Port_PctlMask |= ((uint32)0x0F << Port_PctlShift);
+	PortMasksPtr->Port_Pctl = (PortMasksPtr->Port_Pctl & ~((uint32)0x0F << Port_PctlShift)) |
+							  ((uint32)(Port_PctlTable[PORT_GET_PIN_INDEX(PinConfigPtr->Port_Pin)][PinConfigPtr->Port_PinMode] & 0x0F)
+							   << Port_PctlShift);
+	
+	/* Interrupt sense */
+	if((PORT_INTERRUPT_NONE != PinConfigPtr->Port_PinInterrupt) &&
+	   (PORT_INTERRUPT_HIGH >= PinConfigPtr->Port_PinInterrupt))
+	{
+		Port_Sense = Port_InterruptSenseTable[PinConfigPtr->Port_PinInterrupt];
+		PortMasksPtr->Port_IntPins |= Port_PinMask;
+		PortMasksPtr->Port_Is = (uint8)((PortMasksPtr->Port_Is & ~Port_PinMask) |
+										((0 != (Port_Sense & PORT_SENSE_IS)) ? Port_PinMask : 0));
+		PortMasksPtr->Port_Ibe = (uint8)((PortMasksPtr->Port_Ibe & ~Port_PinMask) |
+										 ((0 != (Port_Sense & PORT_SENSE_IBE)) ? Port_PinMask : 0));
+		PortMasksPtr->Port_Iev = (uint8)((PortMasksPtr->Port_Iev & ~Port_PinMask) |
+										 ((0 != (Port_Sense & PORT_SENSE_IEV)) ? Port_PinMask : 0));
+	}
+	else
+	{
+		/* Pin keeps its reset sense and its interrupt masked */
+		PortMasksPtr->Port_IntPins &= (uint8)~Port_PinMask;
+	}
+}
+
+/**
+ *	\brief		Writes the folded masks of a port to its registers.
+ *				A port whose 8 pins are all in the configuration set is owned by it, its registers
+ *				are stored without being read: at most 16 bus transactions (unlock and commit 3,
+ *				GPIODATA 1, GPIOPCTL 1, 9 registers, relock 2), less a store per drive strength
+ *				no pin uses. The registers of any other port are read-modify-written to keep the
+ *				pins outside of the configuration set, up to 26 transactions: Port_Init() drops
+ *				the DIO shadow, so the read is the only source of their bits. Interrupt sense
+ *				changes add to both.
+ *	\param[in] 	PortId: 		ID of the port.
+ *	\param[in] 	PortMasksPtr: 	Pointer to the folded masks of the port.
+ *	\return		None.
+ */
+static void Port_ApplyPortMasks(Port_PortType PortId, const Port_PortMasksType* PortMasksPtr)
+{
+	/* Needed variables */
+	const Port_RegMaskType* Port_RegMaskPtr;
+	uint8 Port_RegIndex;
+	
+	/* Unlock the port once and enable changing of all configured pins */
+	Port_CommitSessionOpen(PortId, PortMasksPtr->Port_PinsMask);
+	
+	/* Latch the initial levels before the outputs are enabled */
+	if(0 != PortMasksPtr->Port_LevelMask)
+	{
+		Dio_ShadowWriteData((uint8)PortId, PortMasksPtr->Port_LevelMask, PortMasksPtr->Port_Level);
+	}
+	
+	if(PORT_ALL_PINS == PortMasksPtr->Port_PinsMask)
+	{
+		/* Port owned by the configuration set, every bit is known so nothing is read */
+		HW_W_8RIG((HW_PortsAddresses[PortId] + HW_GPIOPCTL_OFFSET), PortMasksPtr->Port_Pctl);
+		for(Port_RegIndex = 0; Port_RegIndex < (uint8)PORT_NO_OF_REGS; Port_RegIndex++)
+		{
+			Port_RegMaskPtr = &PortMasksPtr->Port_RegMasks[Port_RegIndex];
+			
+			/* A 0 stored to a drive strength register changes nothing */
+			if((0 != Port_RegMaskPtr->Port_SetMask) ||
+			   (((uint8)PORT_REG_DR2R > Port_RegIndex) || ((uint8)PORT_REG_DR8R < Port_RegIndex)))
+			{
+				Dio_ShadowStoreReg((uint8)PortId, Port_ShadowRegs[Port_RegIndex], Port_RegMaskPtr->Port_SetMask);
+			}
+			else
+			{
+				/* No pin with this drive strength */
+			}
+		}
+	}
+	else
+	{
+		/* Route the signals before the alternate functions are selected */
+		HW_W_8RIG((HW_PortsAddresses[PortId] + HW_GPIOPCTL_OFFSET),
+				  (HW_R_8RIG(HW_PortsAddresses[PortId] + HW_GPIOPCTL_OFFSET) & ~PortMasksPtr->Port_PctlMask) |
+				  PortMasksPtr->Port_Pctl);
+		
+		/* One read-modify-write per register, registers without changes are skipped */
+		for(Port_RegIndex = 0; Port_RegIndex < (uint8)PORT_NO_OF_REGS; Port_RegIndex++)
+		{
+			Port_RegMaskPtr = &PortMasksPtr->Port_RegMasks[Port_RegIndex];
+			if(0 != (Port_RegMaskPtr->Port_SetMask | Port_RegMaskPtr->Port_ClearMask))
+			{
+				Dio_ShadowModifyReg((uint8)PortId, Port_ShadowRegs[Port_RegIndex],
+									Port_RegMaskPtr->Port_ClearMask, Port_RegMaskPtr->Port_SetMask);
+			}
+		}
+	}
+	
+	Port_CommitSessionClose(PortId);
+	
+	Port_ApplyInterruptSense(PortId, PortMasksPtr->Port_IntPins, PortMasksPtr->Port_Is,
+							 PortMasksPtr->Port_Ibe, PortMasksPtr->Port_Iev);
+}
+
+/**
+ *	\brief		Stores the precomputed registers image of a port.
+ *	\param[in] 	PortId: 		ID of the port.
+ *	\param[in] 	PortImagePtr: 	Pointer to the registers image of the port.
+ *	\return		None.
+ */
+static void Port_ApplyPortImage(Port_PortType PortId, const Port_PortImageType* PortImagePtr)
+{
+	/* Needed variables */
+	HW_AddressBusSizeType Port_BaseAddress = HW_PortsAddresses[PortId];
+	
+	/* The image was validated by the generator, so it is a straight sequence of stores */
+	Port_CommitSessionOpen(PortId, PortImagePtr->Port_Commit);
+	Dio_ShadowWriteData((uint8)PortId, 0xFF, PortImagePtr->Port_Data);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_DIR, PortImagePtr->Port_Dir);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_DR2R, PortImagePtr->Port_Dr2r);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_DR4R, PortImagePtr->Port_Dr4r);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_DR8R, PortImagePtr->Port_Dr8r);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_PUR, PortImagePtr->Port_Pur);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_PDR, PortImagePtr->Port_Pdr);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_ODR, PortImagePtr->Port_Odr);
+	HW_W_8RIG((Port_BaseAddress + HW_GPIOPCTL_OFFSET), PortImagePtr->Port_Pctl);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_AFSEL, PortImagePtr->Port_Afsel);
+	Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_DEN, PortImagePtr->Port_Den);
+	Port_CommitSessionClose(PortId);
+	Port_ApplyInterruptSense(PortId, PortImagePtr->Port_IntPins, PortImagePtr->Port_Is,
+							 PortImagePtr->Port_Ibe, PortImagePtr->Port_Iev);
+}
+
+/**
+ *	\brief		Configures the interrupt sense of pins of a port, their interrupts are left masked
+ *				and any interrupt latched while the sense was changing is cleared.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	IntPins: 	Pins whose interrupt sense is configured.
+ *	\param[in] 	Is: 		GPIOIS bits of IntPins.
+ *	\param[in] 	Ibe: 		GPIOIBE bits of IntPins.
+ *	\param[in] 	Iev: 		GPIOIEV bits of IntPins.
+ *	\return		None.
+ */
+static void Port_ApplyInterruptSense(Port_PortType PortId, uint8 IntPins, uint8 Is, uint8 Ibe, uint8 Iev)
+{
+	/* Needed variables */
+	HW_AddressBusSizeType Port_BaseAddress = HW_PortsAddresses[PortId];
+	
+	if(0 != IntPins)
+	{
+		/* Mask the pins first, changing the sense may latch a false interrupt */
+		HW_W_8RIG((Port_BaseAddress + HW_GPIOIM_OFFSET),
+				  HW_R_8RIG(Port_BaseAddress + HW_GPIOIM_OFFSET) & ~(uint32)IntPins);
+		HW_W_8RIG((Port_BaseAddress + HW_GPIOIS_OFFSET),
+				  (HW_R_8RIG(Port_BaseAddress + HW_GPIOIS_OFFSET) & ~(uint32)IntPins) | Is);
+		HW_W_8RIG((Port_BaseAddress + HW_GPIOIBE_OFFSET),
+				  (HW_R_8RIG(Port_BaseAddress + HW_GPIOIBE_OFFSET) & ~(uint32)IntPins) | Ibe);
+		HW_W_8RIG((Port_BaseAddress + HW_GPIOIEV_OFFSET),
+				  (HW_R_8RIG(Port_BaseAddress + HW_GPIOIEV_OFFSET) & ~(uint32)IntPins) | Iev);
+		HW_W_8RIG((Port_BaseAddress + HW_GPIOICR_OFFSET), IntPins);
+	}
+	else
+	{
+		/* No interrupt pins in this port */
+	}
+}
+
+/**
+ *	\brief		Enables the clocks of the used ports with one write and waits until they are ready,
+ *				then selects the AHB aperture for the ports of HW_GPIO_AHB_PORTS.
+ *				A port still not ready after PortClockReadyTimeout polls is reported to DET.
+ *	\param[in] 	PortsMask: 	Ports used by the configuration set (RCGCGPIO bits).
+ *	\return		uint8: 		Ports of PortsMask whose clock is ready, the others mustn't be accessed.
+ */
+static uint8 Port_EnableClocks(uint8 PortsMask)
+{
+	/* Needed variables */
+	uint32 Port_Polls = 0;
+	uint8 Port_ReadyMask;
+	
+	/* RCGCGPIO supersedes the legacy RCGC2, one write gates all ports */
+#if(PortGateUnusedClocks == STD_ON)
+	HW_W_8RIG((HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET), PortsMask);
+#else
+	HW_W_8RIG((HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET),
+			  HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET) | PortsMask);
+#endif /* PortGateUnusedClocks check */
+	
+	/* Wait for the clock, the registers of a port can't be accessed before it is ready */
+	Port_ReadyMask = (uint8)(HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_PRGPIO_OFFSET) & PortsMask);
+	while((PortsMask != Port_ReadyMask) && (Port_Polls < (uint32)PortClockReadyTimeout))
+	{
+		Port_ReadyMask = (uint8)(HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_PRGPIO_OFFSET) & PortsMask);
+		Port_Polls++;
+	}
+	
+	if(PortsMask != Port_ReadyMask)
+	{
+		/* The ports which aren't ready are left unconfigured */
+#if(PortDevErrorDetect == STD_ON)
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_CLOCK_TIMEOUT);
+#endif /* PortDevErrorDetect check */
+	}
+	else
+	{
+		/* All used ports are ready */
+	}
+	
+#if(HW_GPIO_AHB_PORTS != 0)
+	/* Move the selected ports to the AHB aperture, the drivers use their AHB base addresses */
+	HW_W_8RIG((HW_SYSTEM_CONTROL_BA + HW_GPIOHBCTL_OFFSET),
+			  HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_GPIOHBCTL_OFFSET) | HW_GPIO_AHB_PORTS);
+#endif /* HW_GPIO_AHB_PORTS check */
+	
+	return Port_ReadyMask;
+}
+
+/**
+ *	\brief		Records the configured direction of a port to be restored by the refresh.
+ *	\param[in] 	PortId: 		ID of the port.
+ *	\param[in] 	Direction: 		Configured GPIODIR value of the port.
+ *	\param[in] 	RefreshMask: 	Pins whose direction is unchangeable.
+ *	\return		None.
+ */
+static void Port_RecordDirection(Port_PortType PortId, uint8 Direction, uint8 RefreshMask)
+{
+	Port_ExpectedDirection[PortId] = (uint8)(Direction & RefreshMask);
+	Port_DirRefreshMask[PortId] = RefreshMask;
+	
+	/* Only ports with unchangeable pins are visited by the refresh */
+	if(0 != RefreshMask)
+	{
+		Port_RefreshPorts[Port_NoOfRefreshPorts] = PortId;
+		Port_NoOfRefreshPorts++;
+	}
+	else
+	{
+		/* Nothing to be refreshed in this port */
+	}
+}
+
+/**
+ *	\brief		Restores the configured direction of the unchangeable pins of a port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		None.
+ */
+static void Port_RefreshPort(Port_PortType PortId)
+{
+	/* Needed variables */
+	uint8 Port_Direction;
+	
+	/* The register itself is read, not its shadow, to detect corruption */
+	Port_Direction = (uint8)HW_R_8RIG(HW_PortsAddresses[PortId] + HW_GPIODIR_OFFSET);
+	if(Port_ExpectedDirection[PortId] != (Port_Direction & Port_DirRefreshMask[PortId]))
+	{
+		Dio_ShadowStoreReg((uint8)PortId, DIO_SHADOW_DIR,
+						   (uint8)((Port_Direction & ~Port_DirRefreshMask[PortId]) |
+								   Port_ExpectedDirection[PortId]));
+	}
+	else
+	{
+		/* Direction is intact, no write */
+	}
+}
+
+/**
+ *	\brief		Initializes the ports by folding the configuration set at runtime.
  *	\param[in] 	ConfigPtr: 	Pointer to configuration set.
  *	\return		None.
  */
-void Port_Init(const Port_ConfigType* ConfigPtr)
+static void Port_InitFolded(const Port_ConfigType* ConfigPtr)
 {
 	/* Data initialization */
+	Port_PortMasksType Port_PortsMasks[HW_NO_OF_PORTS];	/* Folded configuration of every port */
+	const Port_PinConfigType* Port_PinConfigPtr;
 	Port_PortType Port_PortId;
-	uint8 Port_PinNumber;
-    uint32 data;
+	uint8 Port_PinIndex;
+	uint8 Port_RegIndex;
+	uint8 Port_PortsMask = 0;
 
-	/* Parameters check */
-	assert(Port_ConfigTypeCheck(ConfigPtr) == E_OK);
-	
-	/* Initialization Steps */
-	/* get port ID */
-	Port_PortId = PORT_GET_PORT(ConfigPtr->Port_Pin);	
-	/* Enable the clock to the port */
-    data = HW_SYSTEM_CONTROL_BA + HW_RCGC2_OFFSET;
-    HW_S_BIT((HW_SYSTEM_CONTROL_BA + HW_RCGC2_OFFSET), Port_PortId);
-    
-    /* Wait for the clock and get pin data */
-	Port_PortId = PORT_GET_PORT(ConfigPtr->Port_Pin);	
-    Port_PinNumber = PORT_GET_PIN(ConfigPtr->Port_Pin);
-    
-    HW_S_BIT((HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET), Port_PortId);
-	
-	/* Set the direction of the GPIO port pin */
-	Port_SetPinDirection(ConfigPtr->Port_Pin, 
-						ConfigPtr->Port_PinDirection);
+	/* Clear the folded masks */
+	for(Port_PortId = PORT_DIO_PORTA; Port_PortId <= PORT_DIO_PORTF; Port_PortId++)
+	{
+		for(Port_RegIndex = 0; Port_RegIndex < (uint8)PORT_NO_OF_REGS; Port_RegIndex++)
+		{
+			Port_PortsMasks[Port_PortId].Port_RegMasks[Port_RegIndex].Port_SetMask = 0;
+			Port_PortsMasks[Port_PortId].Port_RegMasks[Port_RegIndex].Port_ClearMask = 0;
+		}
+		Port_PortsMasks[Port_PortId].Port_PinsMask = 0;
+		Port_PortsMasks[Port_PortId].Port_LevelMask = 0;
+		Port_PortsMasks[Port_PortId].Port_Level = 0;
+		Port_PortsMasks[Port_PortId].Port_DirRefreshMask = 0;
+		Port_PortsMasks[Port_PortId].Port_PctlMask = 0;
+		Port_PortsMasks[Port_PortId].Port_Pctl = 0;
+		Port_PortsMasks[Port_PortId].Port_IntPins = 0;
+		Port_PortsMasks[Port_PortId].Port_Is = 0;
+		Port_PortsMasks[Port_PortId].Port_Ibe = 0;
+		Port_PortsMasks[Port_PortId].Port_Iev = 0;
+	}
 	
-	/* Set the drive strength for each of the pins */
-	switch(ConfigPtr->Port_Current)
+	/* Fold the whole configuration set into per port masks */
+	for(Port_PinIndex = 0; Port_PinIndex < ConfigPtr->Port_NumberOfPins; Port_PinIndex++)
 	{
-		case PORT_CURRENT_DEFAULT:
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR2R_OFFSET), Port_PinNumber);
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR4R_OFFSET), Port_PinNumber);
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR8R_OFFSET), Port_PinNumber);
-		break;
-		case PORT_CURRENT_2mA:
-            HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR2R_OFFSET), Port_PinNumber);
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR4R_OFFSET), Port_PinNumber);
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR8R_OFFSET), Port_PinNumber);
-		break;
-		case PORT_CURRENT_4mA:
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR2R_OFFSET), Port_PinNumber);
-            HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR4R_OFFSET), Port_PinNumber);
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR8R_OFFSET), Port_PinNumber);
-		break;
-		case PORT_CURRENT_8mA:
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR2R_OFFSET), Port_PinNumber);
-            HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR4R_OFFSET), Port_PinNumber);
-            HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODR8R_OFFSET), Port_PinNumber);
-		break;
+		Port_PinConfigPtr = &ConfigPtr->Port_PinsConfig[Port_PinIndex];
 		
-		default:;
-            /* MISRA-C rule */
-            /* Rule 15.3 (required): The fnal clause of a switch 
-			   statement shall be the default clause. */
-	}
-	
-	/* Pull-up, pull-down, or open drain setting */
-    /* Pull-up */
-    /* Unlock the port to change CR */
-    HW_W_8RIG((HW_PortsAddresses[Port_PortId] + HW_GPIOLOCK_OFFSET), HW_GPIO_UNLOCK_PATTERN);
-    /* enable bit changing */
-	HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOCR_OFFSET), Port_PinNumber);    
-    switch(ConfigPtr->Port_PinPullUpRes)
-    {
-        case PORT_PULL_UP_DISABLE:
-			HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOPUR_OFFSET), Port_PinNumber);             	
-        break;
-        case PORT_PULL_UP_ENABLE:
-			HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOPUR_OFFSET), Port_PinNumber);            
-        break;
-        default:;
-            /* MISRA-C rule */
-            /* Rule 15.3 (required): The fnal clause of a switch 
-			   statement shall be the default clause. */
-    }
-    /* Pull-down */
-    /* Unlock the port to change CR */
-    HW_W_8RIG((HW_PortsAddresses[Port_PortId] + HW_GPIOLOCK_OFFSET), HW_GPIO_UNLOCK_PATTERN);
-    /* enable bit changing */
-	HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOCR_OFFSET), Port_PinNumber);    
-    switch(ConfigPtr->Port_PinPullDownRes)
-    {
-        case PORT_PULL_DOWN_DISABLE:
-			HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOPDR_OFFSET), Port_PinNumber);             	
-        break;
-        case PORT_PULL_DOWN_ENABLE:
-			HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOPDR_OFFSET), Port_PinNumber);            
-        break;
-        default:;
-            /* MISRA-C rule */
-            /* Rule 15.3 (required): The fnal clause of a switch 
-			   statement shall be the default clause. */
-    }
-    /* open drain */
-    switch(ConfigPtr->Port_PinOpenDrain)
-    {
-        case PORT_OPEN_DRAIN_DISABLE:
-			HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOODR_OFFSET), Port_PinNumber);             
-        break;
-        case PORT_OPEN_DRAIN_ENABLE:
-			HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOODR_OFFSET), Port_PinNumber);             	
-        break;
-        default:;
-            /* MISRA-C rule */
-            /* Rule 15.3 (required): The fnal clause of a switch 
-			   statement shall be the default clause. */
-    }
-	
-    /* Set pin mode needed registers */
-    Port_SetPinMode(ConfigPtr->Port_Pin, ConfigPtr->Port_PinMode);
+		/* Checked also without PortDevErrorDetect, as in Port_SetPinMode(): the port of the
+		   pin indexes Port_PortsMasks and the pin and its mode index Port_PctlTable */
+		if((PORT_GET_PORT(Port_PinConfigPtr->Port_Pin) < HW_NO_OF_PORTS) &&
+		   (E_OK == Port_PortPinModeCheck(Port_PinConfigPtr->Port_Pin, Port_PinConfigPtr->Port_PinMode)))
+		{
+			Port_FoldPinConfig(Port_PinConfigPtr, 
+							   &Port_PortsMasks[PORT_GET_PORT(Port_PinConfigPtr->Port_Pin)]);
+		}
+		else
+		{
+			/* Pin doesn't exist or its mode isn't available on it, it is skipped */
+		}
+	}
+	
+	/* Enable the clock to all used ports at once */
+	for(Port_PortId = PORT_DIO_PORTA; Port_PortId <= PORT_DIO_PORTF; Port_PortId++)
+	{
+		if(0 != Port_PortsMasks[Port_PortId].Port_PinsMask)
+		{
+			Port_PortsMask |= (uint8)(1 << Port_PortId);
+		}
+		else
+		{
+			/* No pins of this port in the configuration set */
+		}
+	}
+	Port_PortsMask = Port_EnableClocks(Port_PortsMask);
+	
+	/* Configure each used port whose clock is ready */
+	for(Port_PortId = PORT_DIO_PORTA; Port_PortId <= PORT_DIO_PORTF; Port_PortId++)
+	{
+		if(0 != (Port_PortsMask & (1 << Port_PortId)))
+		{
+			Port_ApplyPortMasks(Port_PortId, &Port_PortsMasks[Port_PortId]);
+			Port_RecordDirection(Port_PortId, Port_PortsMasks[Port_PortId].Port_RegMasks[PORT_REG_DIR].Port_SetMask,
+								 Port_PortsMasks[Port_PortId].Port_DirRefreshMask);
+		}
+		else
+		{
+			/* No pins of this port in the configuration set */
+		}
+	}
+}
+
+/**
+ *	\brief		Initializes the ports from precomputed registers images.
+ *	\param[in] 	ImageSetPtr: 	Pointer to the registers images of all ports.
+ *	\return		None.
+ */
+static void Port_InitImages(const Port_ImageSetType* ImageSetPtr)
+{
+	/* Needed variables */
+	Port_PortType Port_PortId;
+	uint8 Port_ReadyMask;
+	
+	/* Enable the clock to all used ports at once */
+	Port_ReadyMask = Port_EnableClocks(ImageSetPtr->Port_ClockGateMask);
 	
+	/* Store the image of each used port whose clock is ready */
+	for(Port_PortId = PORT_DIO_PORTA; Port_PortId <= PORT_DIO_PORTF; Port_PortId++)
+	{
+		if(0 != (Port_ReadyMask & (1 << Port_PortId)))
+		{
+			Port_ApplyPortImage(Port_PortId, &ImageSetPtr->Port_PortImages[Port_PortId]);
+			Port_RecordDirection(Port_PortId, ImageSetPtr->Port_PortImages[Port_PortId].Port_Dir,
+								 ImageSetPtr->Port_PortImages[Port_PortId].Port_DirRefresh);
+		}
+		else
+		{
+			/* Port isn't used by the configuration */
+		}
+	}
+}
+
+/* Global functions definitions */
+/**
+ *	\brief		Initializes the Port Driver module.
+ *				If the set has precomputed registers images they are stored as they are,
+ *				otherwise all pins of the set are folded into one set/clear mask
+ *				per register per port, so each register is written at most once: stored
+ *				on a port whose 8 pins are in the set, read-modify-written on the others.
+ *	\param[in] 	ConfigPtr: 	Pointer to configuration set.
+ *	\return		None.
+ */
+void Port_Init(const Port_ConfigType* ConfigPtr)
+{
+	/* Needed variables */
+	Port_PortType Port_PortId;
+	
+	/* Parameters check */
+#if(PortDevErrorDetect == STD_ON)
+	if(NULL_PTR == ConfigPtr)
+	{
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+	}
+	else if((NULL_PTR == ConfigPtr->Port_Images) &&			/* Images are validated by the generator */
+			(E_OK != Port_ConfigTypeCheck(ConfigPtr)))
+	{
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+	}
+	else
+#endif /* PortDevErrorDetect check */
+	{
+		/* The registers may have been reset since the shadow was loaded */
+		for(Port_PortId = PORT_DIO_PORTA; Port_PortId <= PORT_DIO_PORTF; Port_PortId++)
+		{
+			Dio_ShadowInvalidate((uint8)Port_PortId);
+		}
+		
+		/* Directions to be refreshed are recorded again by the configuration set */
+		Port_NoOfRefreshPorts = 0;
+#if(PortRefreshAmortized == STD_ON)
+		Port_NextRefreshPort = 0;
+#endif /* PortRefreshAmortized check */
+		
+		if(NULL_PTR != ConfigPtr->Port_Images)
+		{
+			/* Fast path: the set was validated and compiled by the configuration generator */
+			Port_InitImages(ConfigPtr->Port_Images);
+		}
+		else
+		{
+			Port_InitFolded(ConfigPtr);
+		}
+	}
 }
 
 /**
@@ -392,40 +1057,86 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 	uint8 Port_PinNumber;
 	
 	/* Parameters check */
-	assert(E_OK == Port_PortPinCheck(Pin));
-	assert(PORT_PIN_IN == Direction ||
-		   PORT_PIN_OUT == Direction);
-		
-	/* Function logic */
-	/* Get port and pin information */
-	Port_PortId = PORT_GET_PORT(Pin);
-	Port_PinNumber = PORT_GET_PIN(Pin);
-	/* Apply changes on needed registers */
-	switch(Direction)
+#if(PortDevErrorDetect == STD_ON)
+	if(E_OK != Port_PortPinCheck(Pin))
 	{
-		case PORT_PIN_IN:
-			HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODIR_OFFSET), Port_PinNumber);
-		break;
-		
-		case PORT_PIN_OUT:
-			HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODIR_OFFSET), Port_PinNumber);
-		break;
-		
-		default:;
-            /* MISRA-C rule */
-            /* Rule 15.3 (required): The fnal clause of a switch 
-			   statement shall be the default clause. */
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+	}
+	else if(0 != (Port_DirRefreshMask[PORT_GET_PORT(Pin)] & (1 << PORT_GET_PIN(Pin))))
+	{
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+	}
+	else
+#else
+	if((PORT_GET_PORT(Pin) > PORT_DIO_PORTF) ||
+	   (0 != (Port_DirRefreshMask[PORT_GET_PORT(Pin)] & (1 << PORT_GET_PIN(Pin)))))
+	{
+		/* Direction unchangeable, nothing is written: the refresh would revert it */
+	}
+	else
+#endif /* PortDevErrorDetect check */
+	{
+		/* Function logic */
+		/* Get port and pin information */
+		Port_PortId = PORT_GET_PORT(Pin);
+		Port_PinNumber = PORT_GET_PIN(Pin);
+		/* Apply changes on needed registers, any other direction is ignored */
+		switch(Direction)
+		{
+			case PORT_PIN_IN:
+				Dio_ShadowModifyReg((uint8)Port_PortId, DIO_SHADOW_DIR, (uint8)(1 << Port_PinNumber), 0);
+			break;
+			
+			case PORT_PIN_OUT:
+				Dio_ShadowModifyReg((uint8)Port_PortId, DIO_SHADOW_DIR, 0, (uint8)(1 << Port_PinNumber));
+			break;
+			
+			default:;
+	            /* MISRA-C rule */
+	            /* Rule 15.3 (required): The fnal clause of a switch 
+				   statement shall be the default clause. */
+		}
 	}
 }
 
 /**
  *	\brief		Refreshes port direction.
+ *				Restores the configured direction of all pins whose direction is unchangeable,
+ *				with one read of GPIODIR per port and a write only if it was corrupted.
+ *				If PortRefreshAmortized is enabled one port is refreshed per call.
  *	\param		None.
  *	\return		None.
  */
 void Port_RefreshPortDirection(void)
 {
-    
+#if(PortRefreshAmortized == STD_ON)
+	/* One port per call, the cost doesn't depend on the number of configured ports */
+	if(0 != Port_NoOfRefreshPorts)
+	{
+		Port_RefreshPort(Port_RefreshPorts[Port_NextRefreshPort]);
+		Port_NextRefreshPort++;
+		if(Port_NextRefreshPort >= Port_NoOfRefreshPorts)
+		{
+			Port_NextRefreshPort = 0;
+		}
+		else
+		{
+			/* Continue with the next port on the next call */
+		}
+	}
+	else
+	{
+		/* No unchangeable pins in the configuration set */
+	}
+#else
+	/* Needed variables */
+	uint8 Port_Index;
+	
+	for(Port_Index = 0; Port_Index < Port_NoOfRefreshPorts; Port_Index++)
+	{
+		Port_RefreshPort(Port_RefreshPorts[Port_Index]);
+	}
+#endif /* PortRefreshAmortized check */
 }
 
 /**
@@ -435,7 +1146,8 @@ void Port_RefreshPortDirection(void)
  */
 void Port_GetVersionInfo(Std_VersionInfoType* VersionInfo)
 {
-    
+	/* Not implemented yet */
+	(void)VersionInfo;
 }
 
 /**
@@ -449,42 +1161,177 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
     /* Needed variables */
     Port_PortType Port_PortId;
     uint8 Port_PinNumber;
+    uint8 Port_PctlShift;
     
     /* Parameters check */
-    assert(E_OK == Port_PortPinCheck(Pin));
-    assert(E_OK == Port_PortPinModeCheck(Mode));
-    
-    /* Get pin information */
-    Port_PortId = PORT_GET_PORT(Pin);
-    Port_PinNumber = PORT_GET_PIN(Pin);
-    
-    /* Enable GPIO pins as digital I/Os for all modes except for ADC */
-	/* Unlock the port to change CR */
-    HW_W_8RIG((HW_PortsAddresses[Port_PortId] + HW_GPIOLOCK_OFFSET), HW_GPIO_UNLOCK_PATTERN);
-    /* enable bit changing */
-	HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOCR_OFFSET), Port_PinNumber);    
-    switch(Mode)
-	{
-		case PORT_PIN_ADC:
-			HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODEN_OFFSET), Port_PinNumber);
-		break;
-		default:
-			HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIODEN_OFFSET), Port_PinNumber);
+#if(PortDevErrorDetect == STD_ON)
+	if(E_OK != Port_PortPinCheck(Pin))
+	{
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+	}
+	else if(E_OK != Port_PortPinModeCheck(Pin, Mode))
+	{
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+	}
+	else
+#else
+	if(E_OK != Port_PortPinModeCheck(Pin, Mode))
+	{
+		/* Mode not available on the pin, nothing is written */
 	}
+	else
+#endif /* PortDevErrorDetect check */
+	{
+		/* Get pin information */
+		Port_PortId = PORT_GET_PORT(Pin);
+		Port_PinNumber = PORT_GET_PIN(Pin);
+		
+		/* Unlock the port once to change GPIODEN, GPIOPCTL and GPIOAFSEL */
+		Port_CommitSessionOpen(Port_PortId, (uint8)(1 << Port_PinNumber));
+		
+		/* Enable GPIO pins as digital I/Os for all modes except for ADC */
+		switch(Mode)
+		{
+			case PORT_PIN_ADC:
+				Dio_ShadowModifyReg((uint8)Port_PortId, DIO_SHADOW_DEN, (uint8)(1 << Port_PinNumber), 0);
+			break;
+			default:
+				Dio_ShadowModifyReg((uint8)Port_PortId, DIO_SHADOW_DEN, 0, (uint8)(1 << Port_PinNumber));
+		}
+		
+		/* Route the signal of the mode to the pin, one table load and one masked write */
+		Port_PctlShift = (uint8)(Port_PinNumber << 2);
+		HW_W_8RIG((HW_PortsAddresses[Port_PortId] + HW_GPIOPCTL_OFFSET),
+				  (HW_R_8RIG(HW_PortsAddresses[Port_PortId] + HW_GPIOPCTL_OFFSET) & ~((uint32)0x0F << Port_PctlShift)) |
+				  ((uint32)(Port_PctlTable[PORT_GET_PIN_INDEX(Pin)][Mode] & 0x0F) << Port_PctlShift));
+		
+		/* Configure the GPIOAFSEL register to program each bit as a GPIO or alternate pin */
+		/* GPIOAFSEL cleared for DIO and ADC modes, and setted otherwise */
+		switch(Mode)
+		{
+			case PORT_PIN_ADC:
+			case PORT_PIN_DIO:
+				Dio_ShadowModifyReg((uint8)Port_PortId, DIO_SHADOW_AFSEL, (uint8)(1 << Port_PinNumber), 0);
+			break;
+			default:
+				Dio_ShadowModifyReg((uint8)Port_PortId, DIO_SHADOW_AFSEL, 0, (uint8)(1 << Port_PinNumber));
+		}
+		
+		Port_CommitSessionClose(Port_PortId);
+	}
+}
+
+/**
+ *	\brief		Opens a commit session on a port.
+ *				The port is unlocked once and the pins are enabled in GPIOCR, so any batch
+ *				of GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN changes can follow without
+ *				unlocking again. Sessions nest: opening an open session only adds the pins
+ *				to it, so Port_SetPinMode() and Port_Init() may be called inside one.
+ *				A PortId out of range is ignored.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	PinsMask: 	Pins whose protected registers will be changed.
+ *	\return		None.
+ */
+void Port_CommitSessionOpen(Port_PortType PortId, uint8 PinsMask)
+{
+	/* Needed variables */
+	HW_AddressBusSizeType Port_BaseAddress;
 	
-	/* Configure the GPIOAFSEL register to program each bit as a GPIO or alternate pin */
-	/* GPIOAFSEL cleared for DIO and ADC modes, and setted otherwise */
-	/* Unlock the port to change CR */
-    HW_W_8RIG((HW_PortsAddresses[Port_PortId] + HW_GPIOLOCK_OFFSET), HW_GPIO_UNLOCK_PATTERN);
-    /* enable bit changing */
-	HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOCR_OFFSET), Port_PinNumber);    
-    switch(Mode)
+	/* Parameters check */
+#if(PortDevErrorDetect == STD_ON)
+	if(HW_NO_OF_PORTS <= (uint8)PortId)
 	{
-		case PORT_PIN_ADC:
-		case PORT_PIN_DIO:
-			HW_C_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOAFSEL_OFFSET), Port_PinNumber);
-		break;
-		default:
-			HW_S_BIT((HW_PortsAddresses[Port_PortId] + HW_GPIOAFSEL_OFFSET), Port_PinNumber);
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_COMMIT_SESSION_OPEN_SID, PORT_E_PARAM_PORT);
+	}
+	else
+#else
+	if(HW_NO_OF_PORTS <= (uint8)PortId)
+	{
+		/* Port doesn't exist, nothing is written */
+	}
+	else
+#endif /* PortDevErrorDetect check */
+	{
+		Port_BaseAddress = HW_PortsAddresses[PortId];
+		
+		/* Unlock the port only by the outermost session */
+		if(0 == Port_SessionDepth[PortId])
+		{
+			HW_W_8RIG((Port_BaseAddress + HW_GPIOLOCK_OFFSET), HW_GPIO_UNLOCK_PATTERN);
+			Port_SessionCommit[PortId] = (uint8)HW_R_8RIG(Port_BaseAddress + HW_GPIOCR_OFFSET);
+			Port_SessionPins[PortId] = Port_SessionCommit[PortId];
+		}
+		else
+		{
+			/* Session nested in an open one */
+		}
+		Port_SessionDepth[PortId]++;
+		
+		/* Enable bit changing of the pins not committed yet */
+		if(PinsMask != (Port_SessionPins[PortId] & PinsMask))
+		{
+			Port_SessionPins[PortId] |= PinsMask;
+			HW_W_8RIG((Port_BaseAddress + HW_GPIOCR_OFFSET), Port_SessionPins[PortId]);
+		}
+		else
+		{
+			/* All pins are committed */
+		}
+	}
+}
+
+/**
+ *	\brief		Closes the commit session of a port.
+ *				GPIOCR is restored to its value before the session and the port is locked
+ *				when the outermost session is closed, closing a nested one has no effect.
+ *				A PortId out of range is ignored.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		None.
+ */
+void Port_CommitSessionClose(Port_PortType PortId)
+{
+	/* Needed variables */
+	HW_AddressBusSizeType Port_BaseAddress;
+	
+	/* Parameters check */
+#if(PortDevErrorDetect == STD_ON)
+	if(HW_NO_OF_PORTS <= (uint8)PortId)
+	{
+		(void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_COMMIT_SESSION_CLOSE_SID, PORT_E_PARAM_PORT);
+	}
+	else
+#else
+	if(HW_NO_OF_PORTS <= (uint8)PortId)
+	{
+		/* Port doesn't exist, nothing is written */
+	}
+	else
+#endif /* PortDevErrorDetect check */
+	if(0 != Port_SessionDepth[PortId])
+	{
+		Port_BaseAddress = HW_PortsAddresses[PortId];
+		Port_SessionDepth[PortId]--;
+		
+		/* Only the outermost session relocks the port */
+		if(0 == Port_SessionDepth[PortId])
+		{
+			if(Port_SessionCommit[PortId] != Port_SessionPins[PortId])
+			{
+				HW_W_8RIG((Port_BaseAddress + HW_GPIOCR_OFFSET), Port_SessionCommit[PortId]);
+			}
+			else
+			{
+				/* GPIOCR wasn't changed by the session */
+			}
+			HW_W_8RIG((Port_BaseAddress + HW_GPIOLOCK_OFFSET), HW_GPIO_LOCK_PATTERN);
+		}
+		else
+		{
+			/* A nested session is closed, the port stays unlocked */
+		}
+	}
+	else
+	{
+		/* No open session on this port */
 	}
 }
\ No newline at end of file
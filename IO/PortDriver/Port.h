@@ -19,8 +19,34 @@
 #include "Std_Types.h"		/*!< Contains useful data types */
 #include "PlatformTypes.h"	/*!< Contains standard data types */
 #include "TivaHW.h"	/*!< Contains addresses and HW data for Tiva C */
+#include "PortGeneral.h"	/*!< Contains general PORT module configuration parameters */
 
 /* Macros Definition */
+/* Module identification */
+#define PORT_MODULE_ID		124		/*!< AUTOSAR module ID of PORT */
+#define PORT_INSTANCE_ID	0		/*!< Index of the only PORT instance */
+
+/* Service IDs */
+#define PORT_INIT_SID					0x00	/*!< Port_Init() service ID */
+#define PORT_SET_PIN_DIRECTION_SID		0x01	/*!< Port_SetPinDirection() service ID */
+#define PORT_REFRESH_PORT_DIRECTION_SID	0x02	/*!< Port_RefreshPortDirection() service ID */
+#define PORT_GET_VERSION_INFO_SID		0x03	/*!< Port_GetVersionInfo() service ID */
+#define PORT_SET_PIN_MODE_SID			0x04	/*!< Port_SetPinMode() service ID */
+#define PORT_COMMIT_SESSION_OPEN_SID	0x05	/*!< Port_CommitSessionOpen() service ID */
+#define PORT_COMMIT_SESSION_CLOSE_SID	0x06	/*!< Port_CommitSessionClose() service ID */
+
+/* Development Errors */
+#define PORT_E_PARAM_PIN				0x0A	/*!< Invalid Port Pin ID requested */
+#define PORT_E_DIRECTION_UNCHANGEABLE	0x0B	/*!< Port Pin not configured as changeable */
+#define PORT_E_PARAM_CONFIG				0x0C	/*!< Port_Init service called with wrong parameter */
+#define PORT_E_PARAM_INVALID_MODE		0x0D	/*!< Port Pin Mode passed not valid */
+#define PORT_E_MODE_UNCHANGEABLE		0x0E	/*!< Port_SetPinMode service called when mode is unchangeable */
+#define PORT_E_UNINIT					0x0F	/*!< API service called without module initialization */
+#define PORT_E_PARAM_POINTER			0x10	/*!< APIs called with a Null Pointer */
+#define PORT_E_CLOCK_TIMEOUT			0x11	/*!< Port_Init found a used port not ready after PortClockReadyTimeout polls,
+													 the port is left unconfigured */
+#define PORT_E_PARAM_PORT				0x12	/*!< Invalid Port ID requested */
+
 /* Port_PinModeType Macros */
 #define PORT_PIN_DIO   0x00	/*!< The pin operates as a Digital pin */
 #define PORT_PIN_ADC   0x01	/*!< The pin operates as an ADC pin */
@@ -33,6 +59,7 @@
 #define PORT_PIN_AC    0x07	/*!< The pin operates as an Analog Comaprator pin */
 #define PORT_PIN_PWM   0x08	/*!< The pin operates as a PWM pin */
 #define PORT_PIN_QEI   0x09	/*!< The pin operates as a QEI pin */
+#define PORT_NO_OF_PIN_MODES	0x0A	/*!< Number of pin modes */
 
 /* Port_PinDirectionType Macros */
 #define PORT_PIN_IN  	0x00		/*!< Sets port pin as input */
@@ -56,6 +83,18 @@
 #define PORT_CURRENT_4mA  		0x02		/*!< The corresponding GPIO pin has 4-mA drive */
 #define PORT_CURRENT_8mA  		0x03		/*!< The corresponding GPIO pin has 8-mA drive */
 
+/* Port_PinDirectionChangeableType Macros */
+#define PORT_PIN_DIRECTION_CHANGEABLE	0x00	/*!< Direction may be changed at runtime, it isn't refreshed */
+#define PORT_PIN_DIRECTION_UNCHANGEABLE	0x01	/*!< Direction is restored by Port_RefreshPortDirection() */
+
+/* Port_PinInterruptType Macros */
+#define PORT_INTERRUPT_NONE		0x00	/*!< Pin doesn't request interrupts */
+#define PORT_INTERRUPT_RISING	0x01	/*!< Interrupt on the rising edge */
+#define PORT_INTERRUPT_FALLING	0x02	/*!< Interrupt on the falling edge */
+#define PORT_INTERRUPT_BOTH		0x03	/*!< Interrupt on both edges */
+#define PORT_INTERRUPT_LOW		0x04	/*!< Interrupt while the level is low */
+#define PORT_INTERRUPT_HIGH		0x05	/*!< Interrupt while the level is high */
+
 
 /* default pin configurations */
 /* DIO default pins configurations */
@@ -388,6 +427,10 @@ typedef uint8 Port_PinCurrentType;	/*!< Set the drive strength for each of the p
 
 typedef uint8 Port_PinDirectionType; /*!< Possible directions of a port pin */
 
+typedef uint8 Port_PinDirectionChangeableType; /*!< Whether the direction of a port pin may change at runtime */
+
+typedef uint8 Port_PinInterruptType; /*!< Interrupt sense of a port pin */
+
 typedef uint8 Port_PinPullUpResType;	/*!< For internal pull up status */
 
 typedef uint8 Port_PinLevelType;	/*!< These are the possible levels a Pin can have
@@ -792,7 +835,7 @@ typedef enum{
 }Port_PinType; /*!< Data type for the symbolic name of a port pin. */
 
 
-/* Configurations structure */
+/* Configurations structures */
 typedef struct{
 	/* Can't use bitfields for This  member
 	   ====== MISRA-C Rule ====== */
@@ -807,13 +850,58 @@ typedef struct{
     Port_PinPullUpResType   Port_PinPullUpRes :1;   /*!< Identifies the state of pull up resistor */                       
     Port_PinPullDownResType Port_PinPullDownRes :1; /*!< Identifies the state of pull down resistor */                           
     Port_PinOpenDrainType   Port_PinOpenDrain :1;   /*!< Identifies the state of open drain resistor */
+	Port_PinDirectionChangeableType Port_PinDirectionChangeable :1;	/*!< Identifies if the direction may change
+																		 at runtime, the direction of an unchangeable
+																		 pin is refreshed. Given explicitly by every
+																		 initializer, after the PORT_PIN_*_DEFAULT settings */
+	Port_PinInterruptType	Port_PinInterrupt :3;	/*!< Identifies the interrupt sense of the pin, it stays
+														 masked until DIO enables the notification.
+														 Given explicitly by every initializer, after
+														 Port_PinDirectionChangeable */
+
+}Port_PinConfigType; /*!< Contains the initialization data for a single port pin. */
+
+typedef struct{
+	uint32	Port_Pctl;		/*!< Final GPIOPCTL value */
+	uint8	Port_Commit;	/*!< Final GPIOCR value (pins used by the configuration) */
+	uint8	Port_Data;		/*!< Initial GPIODATA value */
+	uint8	Port_Dir;		/*!< Final GPIODIR value */
+	uint8	Port_Afsel;		/*!< Final GPIOAFSEL value */
+	uint8	Port_Pur;		/*!< Final GPIOPUR value */
+	uint8	Port_Pdr;		/*!< Final GPIOPDR value */
+	uint8	Port_Odr;		/*!< Final GPIOODR value */
+	uint8	Port_Den;		/*!< Final GPIODEN value */
+	uint8	Port_Dr2r;		/*!< Final GPIODR2R value */
+	uint8	Port_Dr4r;		/*!< Final GPIODR4R value */
+	uint8	Port_Dr8r;		/*!< Final GPIODR8R value */
+	uint8	Port_DirRefresh;	/*!< Pins whose direction is refreshed (direction unchangeable) */
+	uint8	Port_IntPins;	/*!< Pins whose interrupt sense is configured */
+	uint8	Port_Is;		/*!< GPIOIS bits of Port_IntPins */
+	uint8	Port_Ibe;		/*!< GPIOIBE bits of Port_IntPins */
+	uint8	Port_Iev;		/*!< GPIOIEV bits of Port_IntPins */
+}Port_PortImageType; /*!< Precomputed registers image of one port. */
+
+typedef struct{
+	uint8				Port_ClockGateMask;					/*!< Ports whose clock is enabled (RCGCGPIO bits) */
+	Port_PortImageType	Port_PortImages[HW_NO_OF_PORTS];	/*!< Registers image of every port */
+}Port_ImageSetType; /*!< Precomputed registers images of all ports, emitted by the
+						 configuration generator (Tools/PortCfgGen). */
 
+typedef struct{
+	const Port_PinConfigType*	Port_PinsConfig;	/*!< Points to the configurations of all pins in the set */
+	uint8						Port_NumberOfPins;	/*!< Number of pins in the configuration set */
+	const Port_ImageSetType*	Port_Images;		/*!< Precomputed registers images of the set,
+														 NULL_PTR if the set has to be folded at runtime */
 }Port_ConfigType; /*!< Contains the initialization data for this module. */
 
 
 /* Functions proto types */
 /**
  *	\brief		Initializes the Port Driver module.
+ *				If the set has precomputed registers images they are stored as they are,
+ *				otherwise all pins of the set are folded into one set/clear mask
+ *				per register per port, so each register is written at most once: stored
+ *				on a port whose 8 pins are in the set, read-modify-written on the others.
  *	\param[in] 	ConfigPtr: 	Pointer to configuration set.
  *	\return		None.
  */
@@ -829,6 +917,9 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 
 /**
  *	\brief		Refreshes port direction.
+ *				Restores the configured direction of all pins whose direction is unchangeable,
+ *				with one read of GPIODIR per port and a write only if it was corrupted.
+ *				If PortRefreshAmortized is enabled one port is refreshed per call.
  *	\param		None.
  *	\return		None.
  */
@@ -849,5 +940,28 @@ void Port_GetVersionInfo(Std_VersionInfoType* VersionInfo);
  */
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 
+/**
+ *	\brief		Opens a commit session on a port.
+ *				The port is unlocked once and the pins are enabled in GPIOCR, so any batch
+ *				of GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN changes can follow without
+ *				unlocking again. Sessions nest: opening an open session only adds the pins
+ *				to it, so Port_SetPinMode() and Port_Init() may be called inside one.
+ *				A PortId out of range is ignored.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	PinsMask: 	Pins whose protected registers will be changed.
+ *	\return		None.
+ */
+void Port_CommitSessionOpen(Port_PortType PortId, uint8 PinsMask);
+
+/**
+ *	\brief		Closes the commit session of a port.
+ *				GPIOCR is restored to its value before the session and the port is locked
+ *				when the outermost session is closed, closing a nested one has no effect.
+ *				A PortId out of range is ignored.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		None.
+ */
+void Port_CommitSessionClose(Port_PortType PortId);
+
 
 #endif /* PORT_H_ */
@@ -0,0 +1,26 @@
+/**
+ *  \file	PortGeneral.h
+ *  \brief 	Contains general PORT module configuration parameters.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef PORT_GENERAL_H_
+#define PORT_GENERAL_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+
+/* Macros */
+/* General configuration parameters */
+#define PortDevErrorDetect		STD_OFF	/*!< Switches the development error detection and notification on or off */
+#define PortRefreshAmortized	STD_OFF	/*!< Port_RefreshPortDirection() refreshes one port per call (round robin)
+												 instead of all ports, so its cost is constant per call */
+#define PortGateUnusedClocks	STD_ON	/*!< Port_Init gates off the clock of the ports unused by the configuration set,
+												 disable it if other modules access ports which aren't configured by PORT */
+#define PortClockReadyTimeout	100		/*!< Maximum number of GPIO peripheral ready polls after enabling the clocks,
+												 a port still not ready is left unconfigured (PORT_E_CLOCK_TIMEOUT) */
+
+#endif /* PORT_GENERAL_H_ */
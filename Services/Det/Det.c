@@ -0,0 +1,54 @@
+/**
+ *  \file	Det.c
+ *  \brief 	Default Error Tracer, collects the development errors reported by the
+ *  		other modules into a fixed size ring buffer which can be inspected
+ *  		with the debugger.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "Det.h"
+#include "TivaHW.h"		/* Contains the critical section macros */
+
+/* Shared Variables */
+Det_ErrorType Det_ErrorBuffer[DetErrorBufferSize];	/*!< Last reported errors */
+uint32 Det_ErrorCount = 0;	/*!< Number of errors reported since Det_Init */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Initializes the Default Error Tracer, the reported errors are discarded.
+ *	\param		None.
+ *	\return		None.
+ */
+void Det_Init(void)
+{
+	Det_ErrorCount = 0;
+}
+
+/**
+ *	\brief		Service to report development errors.
+ *	\param[in] 	ModuleId: 	Module ID of the calling module.
+ *	\param[in] 	InstanceId: Index based instance of the calling module.
+ *	\param[in] 	ApiId: 		ID of the API service in which the error is detected.
+ *	\param[in] 	ErrorId: 	ID of the detected development error.
+ *	\return		Std_ReturnType:	Always E_OK.
+ */
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+	/* Needed Variables */
+	Det_ErrorType* Det_EntryPtr;
+	uint32 Det_IntState;
+	
+	/* Errors can be reported from interrupts too */
+	HW_ENTER_CRITICAL(Det_IntState);
+	Det_EntryPtr = &Det_ErrorBuffer[Det_ErrorCount % DetErrorBufferSize];
+	Det_EntryPtr->Det_ModuleId = ModuleId;
+	Det_EntryPtr->Det_InstanceId = InstanceId;
+	Det_EntryPtr->Det_ApiId = ApiId;
+	Det_EntryPtr->Det_ErrorId = ErrorId;
+	Det_ErrorCount++;
+	HW_EXIT_CRITICAL(Det_IntState);
+	
+	return E_OK;
+}
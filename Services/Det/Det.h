@@ -0,0 +1,50 @@
+/**
+ *  \file	Det.h
+ *  \brief 	Default Error Tracer, collects the development errors reported by the
+ *  		other modules into a fixed size ring buffer which can be inspected
+ *  		with the debugger.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DET_H_
+#define DET_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "DetGeneral.h"
+
+/* Defined data types */
+typedef struct{
+	uint16	Det_ModuleId;		/*!< Module ID of the calling module */
+	uint8	Det_InstanceId;		/*!< Index based instance of the calling module */
+	uint8	Det_ApiId;			/*!< ID of the API service in which the error is detected */
+	uint8	Det_ErrorId;		/*!< ID of the detected development error */
+}Det_ErrorType;	/*!< One reported development error */
+
+/* Shared variables */
+extern Det_ErrorType Det_ErrorBuffer[DetErrorBufferSize];	/*!< Last reported errors */
+extern uint32 Det_ErrorCount;	/*!< Number of errors reported since Det_Init, the newest is at
+									 Det_ErrorBuffer[(Det_ErrorCount - 1) % DetErrorBufferSize] */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Initializes the Default Error Tracer, the reported errors are discarded.
+ *	\param		None.
+ *	\return		None.
+ */
+void Det_Init(void);
+
+/**
+ *	\brief		Service to report development errors.
+ *	\param[in] 	ModuleId: 	Module ID of the calling module.
+ *	\param[in] 	InstanceId: Index based instance of the calling module.
+ *	\param[in] 	ApiId: 		ID of the API service in which the error is detected.
+ *	\param[in] 	ErrorId: 	ID of the detected development error.
+ *	\return		Std_ReturnType:	Always E_OK.
+ */
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+#endif /* DET_H_ */
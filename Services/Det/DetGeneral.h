@@ -0,0 +1,20 @@
+/**
+ *  \file	DetGeneral.h
+ *  \brief 	Contains general DET module configuration parameters.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef DET_GENERAL_H_
+#define DET_GENERAL_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+
+/* Macros */
+/* General configuration parameters */
+#define DetErrorBufferSize		16	/*!< Number of reported errors kept in the ring buffer, the oldest are overwritten */
+
+#endif /* DET_GENERAL_H_ */
@@ -0,0 +1,90 @@
+/**
+ *  \file	BitBandTest.c
+ *  \brief 	Host test of HW_BITBAND_ALIAS (TivaHW.h) against the bit-band mapping of the
+ *  		datasheet (TM4C123GH6PM, 2.4.5 Bit-Banding):
+ *  		alias = 0x42000000 + (address - 0x40000000) * 32 + bit * 4
+ *  		Every register / bit pair is checked against the formula and against the alias
+ *  		worked out by hand, then the alias of a GPIO register is written and read back
+ *  		on the host register model.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools Tools/BitBandTest/BitBandTest.c "common files/"Tiva*.c -o BitBandTest
+ *  		./BitBandTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+/* Macros */
+/* Datasheet bit-band mapping of the peripherals region, kept apart from TivaHW.h on purpose */
+#define BITBAND_TEST_FORMULA(ADDRESS,BIT)	\
+	((uint32)0x42000000 + (((uint32)(ADDRESS) - (uint32)0x40000000) * 32) + ((uint32)(BIT) * 4))
+
+/* Defined data types */
+typedef struct{
+	const char*				BitBandTest_Name;		/*!< Register and bit */
+	HW_AddressBusSizeType	BitBandTest_Register;	/*!< Address of the register */
+	uint8					BitBandTest_Bit;		/*!< Bit in the register */
+	uint32					BitBandTest_Alias;		/*!< Alias worked out by hand */
+}BitBandTest_PairType;	/*!< Register / bit pair and its alias */
+
+/* Private Variables */
+static const BitBandTest_PairType BitBandTest_Pairs[] = {
+	{"first word, bit 0",				HW_PERIPH_BA,												0,	0x42000000},
+	{"first word, bit 31",				HW_PERIPH_BA,												31,	0x4200007C},
+	{"last word, bit 31",				0x400FFFFC,													31,	0x43FFFFFC},
+	{"PORTF.GPIODATA (all pins), PF1",	HW_GPIOPORTF_APB_BASE + HW_GPIODATA_OFFSET + 0x3FC,			1,	0x424A7F84},
+	{"PORTF.GPIODIR, PF3",				HW_GPIOPORTF_APB_BASE + HW_GPIODIR_OFFSET,					3,	0x424A800C},
+	{"PORTA(AHB).GPIOICR, PA7",			HW_GPIOPORTA_AHB_BASE + HW_GPIOICR_OFFSET,					7,	0x42B0839C},
+	{"SYSCTL.RCGCGPIO, port F",			HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET,					5,	0x43FCC114},
+	{"DMA.DMAENASET, channel 2",		HW_UDMA_BA + HW_DMAENASET_OFFSET,							2,	0x43FE0508}
+};	/*!< Pairs checked, from both ends of the region and from the registers the drivers alias */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType BitBandTest_Dir = HW_GPIOPORTF_APB_BASE + HW_GPIODIR_OFFSET;
+	uint32 BitBandTest_Alias;
+	uint8 BitBandTest_Index;
+	
+	for(BitBandTest_Index = 0; BitBandTest_Index < (sizeof(BitBandTest_Pairs) / sizeof(BitBandTest_Pairs[0])); BitBandTest_Index++)
+	{
+		BitBandTest_Alias = (uint32)HW_BITBAND_ALIAS(BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Register,
+													 BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Bit);
+		Test_Check((BitBandTest_Alias == BITBAND_TEST_FORMULA(BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Register,
+															  BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Bit)) ? TRUE : FALSE,
+				   BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Name);
+		Test_Check((BitBandTest_Alias == BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Alias) ? TRUE : FALSE,
+				   BitBandTest_Pairs[BitBandTest_Index].BitBandTest_Name);
+	}
+	
+	/* Consecutive bits are consecutive words, consecutive registers are 32 words apart */
+	Test_Check((4 == (HW_BITBAND_ALIAS(BitBandTest_Dir, 1) - HW_BITBAND_ALIAS(BitBandTest_Dir, 0))) ? TRUE : FALSE,
+			   "bit stride");
+	Test_Check((128 == (HW_BITBAND_ALIAS(BitBandTest_Dir + 4, 0) - HW_BITBAND_ALIAS(BitBandTest_Dir, 0))) ? TRUE : FALSE,
+			   "register stride");
+	
+	/* A word written to the alias sets or clears the aliased bit alone */
+	HW_RegsModelReset();
+	HW_RegsModelWrite(HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET, 0x20);
+	HW_RegsModelWrite(BitBandTest_Dir, 0x81);
+	HW_RegsModelWrite(HW_BITBAND_ALIAS(BitBandTest_Dir, 3), 1);
+	Test_Check((0x89 == HW_RegsModelRead(BitBandTest_Dir)) ? TRUE : FALSE, "alias write sets PF3 alone");
+	Test_Check((1 == HW_RegsModelRead(HW_BITBAND_ALIAS(BitBandTest_Dir, 3))) ? TRUE : FALSE, "alias read of PF3");
+	HW_RegsModelWrite(HW_BITBAND_ALIAS(BitBandTest_Dir, 7), 0);
+	Test_Check((0x09 == HW_RegsModelRead(BitBandTest_Dir)) ? TRUE : FALSE, "alias write clears PF7 alone");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "no model faults");
+	
+	return Test_Summary();
+}
@@ -0,0 +1,1663 @@
+/**
+ *  \file	DioBench.c
+ *  \brief 	Host microbenchmarks of the DIO and PORT services, run on the host register
+ *  		model (TivaRegsModel.h). Every benchmark reports:
+ *  		-	ns/op: best of DIO_BENCH_RUNS timed runs, the time of the register model is
+ *  			included so the figures compare builds of the drivers, not the target.
+ *  		-	instructions/op: user-space instructions from the perf counters, "na" when the
+ *  			kernel or the machine doesn't give them.
+ *  		-	transactions/op: bus transactions of the registers accesses counted by the
+ *  			registers access accounting (TivaAccounting.h), a read-modify-write is 2 of
+ *  			them, suspended while timing.
+ *  		Every benchmark starts from a reset register model initialized by Port_Init() with
+ *  		the benchmarks configuration set, then runs its setup if it has one.
+ *  		Usage: DioBench [-q] [-o results.csv] [-b baseline.csv]
+ *  		-q divides the iterations by 10, -o writes the results as CSV and -b compares
+ *  		them with a CSV written by an earlier run. To measure the DIO shadow, save a run
+ *  		with DioShadowRegisters (DioGeneral.h) off, then compare a run built with it on.
+ *  		DioBitBandAccess is compared the same way (with DioShadowRegisters off), the
+ *  		"GPIODATA F1" benchmarks store F1 through both addresses in any build.
+ *  		The ports apertures are compared by building with -DHW_GPIO_AHB_PORTS=0x3F
+ *  		against the default APB build, "GPIODATA F1 APB/AHB" store F1 through both.
+ *  		"Dio_Stream 256 images" plays a buffer through the uDMA model (TivaUdmaModel.h),
+ *  		its transactions/op count the moved images. "Dio_StreamIsr + queue" plays 1 image
+ *  		buffers, so it gives the CPU cost of a buffer whatever its length.
+ *  		The soft SPI and I2C benchmarks run at the store rate (no delay, no clock stretching
+ *  		polls), without slave: MISO reads its pin and SDA is held low by the model so every
+ *  		acknowledge reads 0. A second table gives their ns/bit, instructions/bit and clock
+ *  		edges/s (2 per bit clocked, the I2C acknowledges included).
+ *  		Build (from the repository root):
+ *  		gcc -O2 -DHW_ACCESS_ACCOUNTING=1 -I"common files" -IIO/DIO -IIO/PortDriver -IServices/Det
+ *  			Tools/DioBench/DioBench.c IO/DIO/DIO.c IO/DIO/Dio*.c IO/PortDriver/Port.c
+ *  			"common files/"Tiva*.c Services/Det/Det.c -o DioBench
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif /* Linux check */
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioDebounce.h"
+#include "DioEdge.h"
+#include "DioPattern.h"
+#include "DioCapture.h"
+#include "DioLanes.h"
+#include "DioStream.h"
+#include "DioSoftSpi.h"
+#include "DioSoftI2c.h"
+#include "TivaRegsModel.h"
+#include "TivaUdmaModel.h"
+#include "TivaAccounting.h"
+
+#if(HW_ACCESS_ACCOUNTING != 1)
+#error "DioBench has to be built with -DHW_ACCESS_ACCOUNTING=1"
+#endif
+
+/* Macros */
+#define DIO_BENCH_RUNS			5		/*!< Timed runs of every benchmark, the best one is kept */
+#define DIO_BENCH_ACCESS_OPS	100		/*!< Operations counted by the accounting */
+#define DIO_BENCH_NAME_SIZE		32		/*!< Characters of a benchmark name */
+#define DIO_BENCH_NA			(-1.0)	/*!< Instructions not available */
+#define DIO_BENCH_DEBOUNCED		40		/*!< Debounced channels, every pin of ports A .. D and 4 of E and F */
+#define DIO_BENCH_LANE_BYTES	4096	/*!< Bytes of every lane of the lanes benchmarks */
+#define DIO_BENCH_STREAM_IMAGES	256		/*!< Images of a buffer of the stream benchmark */
+#define DIO_BENCH_SERIAL_BYTES	16		/*!< Data bytes of a soft SPI or I2C transfer */
+
+/* Defined data types */
+typedef void (*DioBench_BodyType)(uint32 Iterations);	/*!< Runs Iterations operations */
+
+typedef void (*DioBench_SetupType)(void);	/*!< Prepares the state the operations need */
+
+typedef struct{
+	const char*			DIO_Name;		/*!< Name of the benchmark, the service name */
+	DioBench_SetupType	DIO_Setup;		/*!< Setup of the benchmark, NULL_PTR if none */
+	DioBench_BodyType	DIO_Body;		/*!< Operations of the benchmark */
+	uint32				DIO_Iterations;	/*!< Operations of a timed run */
+}DioBench_CaseType;	/*!< Benchmark */
+
+typedef struct{
+	char	DIO_Name[DIO_BENCH_NAME_SIZE];	/*!< Name of the benchmark */
+	double	DIO_Ns;							/*!< ns/op */
+	double	DIO_Instructions;				/*!< instructions/op, DIO_BENCH_NA if not available */
+	double	DIO_Transactions;				/*!< Bus transactions/op */
+}DioBench_ResultType;	/*!< Results of a benchmark */
+
+typedef struct{
+	const char*	DIO_Name;	/*!< Name of the benchmark */
+	uint32		DIO_Bits;	/*!< Bits clocked per operation */
+}DioBench_LinkType;	/*!< Serial link benchmark */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Benchmarks bodies, each one calls its service Iterations times.
+ *	\param[in] 	Iterations: 	Number of calls.
+ *	\return		None.
+ */
+static void DioBench_ReadChannel(uint32 Iterations);
+static void DioBench_WriteChannel(uint32 Iterations);
+static void DioBench_ReadChannelWide(uint32 Iterations);
+static void DioBench_WriteChannelWide(uint32 Iterations);
+static void DioBench_ReadPort(uint32 Iterations);
+static void DioBench_WritePort(uint32 Iterations);
+static void DioBench_ReadChannelGroup(uint32 Iterations);
+static void DioBench_WriteChannelGroup(uint32 Iterations);
+static void DioBench_StoreMasked(uint32 Iterations);
+static void DioBench_StoreBitBand(uint32 Iterations);
+static void DioBench_StoreApb(uint32 Iterations);
+static void DioBench_StoreAhb(uint32 Iterations);
+#if(DioFlipChannelApi == STD_ON)
+static void DioBench_FlipChannel(uint32 Iterations);
+static void DioBench_FlipChannels(uint32 Iterations);
+#endif /* DioFlipChannelApi check */
+static void DioBench_PortInit(uint32 Iterations);
+static void DioBench_PortInitAef(uint32 Iterations);
+static void DioBench_PortInitImages(uint32 Iterations);
+static void DioBench_SetPinDirection(uint32 Iterations);
+static void DioBench_SetPinMode(uint32 Iterations);
+static void DioBench_WriteChannelBatch(uint32 Iterations);
+static void DioBench_ReadChannelBatch(uint32 Iterations);
+#if(DioChannelListApi == STD_ON)
+static void DioBench_WriteChannelList(uint32 Iterations);
+static void DioBench_ReadChannelList(uint32 Iterations);
+static void DioBench_WriteChannelSet(uint32 Iterations);
+static void DioBench_ReadChannelSet(uint32 Iterations);
+#endif /* DioChannelListApi check */
+static void DioBench_SetPinModeAef(uint32 Iterations);
+#if(DioFlipChannelApi == STD_ON)
+static void DioBench_ShadowWorkload(uint32 Iterations);
+#endif /* DioFlipChannelApi check */
+#if(DioDebounceApi == STD_ON)
+static void DioBench_DebounceMainFunction(uint32 Iterations);
+#endif /* DioDebounceApi check */
+#if(DioEdgeApi == STD_ON)
+static void DioBench_EdgeIsr1(uint32 Iterations);
+static void DioBench_EdgeIsr3(uint32 Iterations);
+static void DioBench_EdgeIsr4(uint32 Iterations);
+
+/**
+ *	\brief		Latches edges on pins of port B and dispatches them, Iterations times.
+ *	\param[in] 	Iterations: 	Number of dispatches.
+ *	\param[in] 	Pending: 	Pins whose edges are pending at every dispatch.
+ *	\return		None.
+ */
+static void DioBench_EdgeIsr(uint32 Iterations, uint8 Pending);
+
+/**
+ *	\brief		Notification of the edges, counts them.
+ *	\param[in] 	ChannelId: 	Channel of the edge.
+ *	\return		None.
+ */
+static void DioBench_EdgeNotification(Dio_ChannelType ChannelId);
+#endif /* DioEdgeApi check */
+#if(DioPatternApi == STD_ON)
+static void DioBench_PatternTick(uint32 Iterations);
+#endif /* DioPatternApi check */
+#if(DioCaptureApi == STD_ON)
+static void DioBench_CaptureSample(uint32 Iterations);
+#endif /* DioCaptureApi check */
+#if(DioLanesApi == STD_ON)
+static void DioBench_LanesEncode(uint32 Iterations);
+static void DioBench_LanesWrite(uint32 Iterations);
+#endif /* DioLanesApi check */
+#if(DioStreamApi == STD_ON)
+static void DioBench_StreamBuffer(uint32 Iterations);
+
+/**
+ *	\brief		Notification of the played buffers, queues the buffer again.
+ *	\param[in] 	ImagesPtr: 	Played buffer.
+ *	\return		None.
+ */
+static void DioBench_StreamNotification(const Dio_PortLevelType* ImagesPtr);
+#endif /* DioStreamApi check */
+#if(DioSoftSpiApi == STD_ON)
+static void DioBench_SoftSpi(uint32 Iterations);
+#endif /* DioSoftSpiApi check */
+#if(DioSoftI2cApi == STD_ON)
+static void DioBench_SoftI2cWrite(uint32 Iterations);
+static void DioBench_SoftI2cRead(uint32 Iterations);
+#endif /* DioSoftI2cApi check */
+
+/**
+ *	\brief		Benchmarks setups.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupAef(void);
+static void DioBench_SetupApb(void);
+static void DioBench_SetupAhb(void);
+static void DioBench_SetupWide(void);
+#if(DioChannelListApi == STD_ON)
+static void DioBench_SetupWideSet(void);
+#endif /* DioChannelListApi check */
+#if(DioDebounceApi == STD_ON)
+static void DioBench_SetupDebounce(void);
+#endif /* DioDebounceApi check */
+#if(DioEdgeApi == STD_ON)
+static void DioBench_SetupEdge(void);
+#endif /* DioEdgeApi check */
+#if(DioPatternApi == STD_ON)
+static void DioBench_SetupPattern(void);
+#endif /* DioPatternApi check */
+#if(DioCaptureApi == STD_ON)
+static void DioBench_SetupCapture1(void);
+static void DioBench_SetupCapture2(void);
+static void DioBench_SetupCapture3(void);
+static void DioBench_SetupCapture4(void);
+
+/**
+ *	\brief		Initializes the 20 outputs set and starts a capture of ports which never triggers.
+ *	\param[in] 	PortsMask: 	Sampled ports, a bit per port ID.
+ *	\return		None.
+ */
+static void DioBench_SetupCapture(uint8 PortsMask);
+#endif /* DioCaptureApi check */
+#if(DioLanesApi == STD_ON)
+static void DioBench_SetupLanes(void);
+#endif /* DioLanesApi check */
+#if(DioStreamApi == STD_ON)
+static void DioBench_SetupStream1(void);
+static void DioBench_SetupStream256(void);
+
+/**
+ *	\brief		Initializes the 20 outputs set and starts a stream of port B with both
+ *				buffers queued.
+ *	\param[in] 	Length: 	Images of a buffer.
+ *	\return		None.
+ */
+static void DioBench_SetupStream(uint16 Length);
+#endif /* DioStreamApi check */
+#if(DioSoftSpiApi == STD_ON)
+static void DioBench_SetupSpiJoined(void);
+static void DioBench_SetupSpiSplit(void);
+static void DioBench_SetupSpiMode3(void);
+
+/**
+ *	\brief		Initializes the 20 outputs set and a soft SPI on them.
+ *	\param[in] 	ConfigPtr: 	Pins and mode of the soft SPI.
+ *	\return		None.
+ */
+static void DioBench_SetupSpi(const Dio_SoftSpiConfigType* ConfigPtr);
+#endif /* DioSoftSpiApi check */
+#if(DioSoftI2cApi == STD_ON)
+static void DioBench_SetupI2c(void);
+#endif /* DioSoftI2cApi check */
+
+/**
+ *	\brief		Opens the user-space instructions counter of the process.
+ *	\param		None.
+ *	\return		int: 	File descriptor of the counter, -1 if not available.
+ */
+static int DioBench_OpenCounter(void);
+
+/**
+ *	\brief		Runs and measures a benchmark.
+ *	\param[in] 	CasePtr: 	Pointer to the benchmark.
+ *	\param[in] 	Divisor: 	Divisor of the iterations of the benchmark.
+ *	\param[in] 	Counter: 	File descriptor of the instructions counter, -1 if not available.
+ *	\param[out] ResultPtr: 	Pointer to the results.
+ *	\return		None.
+ */
+static void DioBench_Run(const DioBench_CaseType* CasePtr, uint32 Divisor, int Counter,
+						 DioBench_ResultType* ResultPtr);
+
+/**
+ *	\brief		Reads the results of an earlier run.
+ *	\param[in] 	FileName: 	Name of the CSV file.
+ *	\param[out] ResultsPtr: Pointer to the results, one per benchmark.
+ *	\param[in] 	MaxResults: Size of the results array.
+ *	\return		sint32: 	Number of results read, -1 if the file can't be opened.
+ */
+static sint32 DioBench_ReadBaseline(const char* FileName, DioBench_ResultType* ResultsPtr, uint8 MaxResults);
+
+/* Private Variables */
+static const Port_PinConfigType DioBench_Pins[] = {
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_D7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Pins of the benchmarks: LEDs and switches of the launchpad, D7 (locked) and A2 */
+
+static const Port_ConfigType DioBench_Config = {
+	DioBench_Pins, sizeof(DioBench_Pins) / sizeof(DioBench_Pins[0]), NULL_PTR
+};	/*!< Configuration set of the benchmarks, folded at runtime */
+
+static const Port_PinConfigType DioBench_AefPins[] = {
+	{PORT_PIN_A2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E1, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E4, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< 8 pins on ports A, E and F */
+
+static const Port_ConfigType DioBench_AefConfig = {
+	DioBench_AefPins, sizeof(DioBench_AefPins) / sizeof(DioBench_AefPins[0]), NULL_PTR
+};	/*!< 8 pins set, folded at runtime */
+
+static const Port_ImageSetType DioBench_AefImages = {
+	0x31,
+	{
+		{0x00000000, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00},
+		{0},
+		{0},
+		{0},
+		{0x00000000, 0x13, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00},
+		{0x00000000, 0x16, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00}
+	}
+};	/*!< Registers images of the 8 pins set, emitted by Tools/PortCfgGen for the same pins */
+
+static const Port_ConfigType DioBench_AefImageConfig = {
+	DioBench_AefPins, sizeof(DioBench_AefPins) / sizeof(DioBench_AefPins[0]), &DioBench_AefImages
+};	/*!< 8 pins set, stored from its images */
+
+static const Port_PinConfigType DioBench_WidePins[] = {
+	{PORT_PIN_A2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A4, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A5, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_C4, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_C5, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_C6, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_D0, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_D1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_D2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< 20 outputs spread over all 6 ports */
+
+static const Port_ConfigType DioBench_WideConfig = {
+	DioBench_WidePins, sizeof(DioBench_WidePins) / sizeof(DioBench_WidePins[0]), NULL_PTR
+};	/*!< 20 outputs set, folded at runtime */
+
+static const Dio_ChannelType DioBench_WideChannels[] = {
+	DIO_CHANNEL_A2, DIO_CHANNEL_A3, DIO_CHANNEL_A4, DIO_CHANNEL_A5, DIO_CHANNEL_B0,
+	DIO_CHANNEL_B1, DIO_CHANNEL_B2, DIO_CHANNEL_B3, DIO_CHANNEL_C4, DIO_CHANNEL_C5,
+	DIO_CHANNEL_C6, DIO_CHANNEL_D0, DIO_CHANNEL_D1, DIO_CHANNEL_D2, DIO_CHANNEL_E1,
+	DIO_CHANNEL_E2, DIO_CHANNEL_E3, DIO_CHANNEL_F1, DIO_CHANNEL_F2, DIO_CHANNEL_F3
+};	/*!< Channels of the 20 outputs, in the order of the set */
+
+#define DIO_BENCH_WIDE_CHANNELS	(sizeof(DioBench_WideChannels) / sizeof(DioBench_WideChannels[0]))	/*!< Number of wide channels */
+
+static Dio_LevelType DioBench_WideLevels[2][DIO_BENCH_WIDE_CHANNELS];	/*!< Two batches of levels of the 20 outputs */
+static Dio_LevelType DioBench_WideRead[DIO_BENCH_WIDE_CHANNELS];		/*!< Levels read from the 20 outputs */
+#if(DioChannelListApi == STD_ON)
+static Dio_ChannelSetType DioBench_WideSet;	/*!< Channel set of the 20 outputs */
+#endif /* DioChannelListApi check */
+
+#if(DioFlipChannelApi == STD_ON)
+static const Dio_PortLevelType DioBench_FlipMasks[HW_NO_OF_PORTS] = {
+	0x3C, 0x0F, 0x70, 0x07, 0, 0
+};	/*!< Outputs of the 20 outputs set on ports A .. D */
+#endif /* DioFlipChannelApi check */
+
+#if(DioDebounceApi == STD_ON)
+static Dio_DebounceChannelType DioBench_DebounceChannels[DIO_BENCH_DEBOUNCED];	/*!< Debounced channels */
+
+static const Dio_DebounceConfigType DioBench_DebounceConfig = {
+	DioBench_DebounceChannels, DIO_BENCH_DEBOUNCED
+};	/*!< Debounce configuration, the channels are filled by the setup */
+#endif /* DioDebounceApi check */
+
+#if(DioEdgeApi == STD_ON)
+static const Port_PinConfigType DioBench_EdgePins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH}
+};	/*!< Inputs interrupting on both edges */
+
+static const Port_ConfigType DioBench_EdgeConfig = {
+	DioBench_EdgePins, sizeof(DioBench_EdgePins) / sizeof(DioBench_EdgePins[0]), NULL_PTR
+};	/*!< Edges set, folded at runtime */
+
+static uint32 DioBench_Edges;	/*!< Edges notified */
+#endif /* DioEdgeApi check */
+
+#if(DioPatternApi == STD_ON)
+static const Dio_PatternStepType DioBench_PatternSteps[] = {
+	{DIO_PORTF, 0x0E, 0x02, 1},
+	{DIO_PORTF, 0x0E, 0x04, 1},
+	{DIO_PORTF, 0x0E, 0x08, 1},
+	{DIO_PORTF, 0x0E, 0x00, 1}
+};	/*!< Walking LED on F1 .. F3, a step per tick */
+
+static const Dio_PatternType DioBench_Pattern = {
+	DioBench_PatternSteps, sizeof(DioBench_PatternSteps) / sizeof(DioBench_PatternSteps[0]), TRUE
+};	/*!< Pattern replayed by the ticks */
+#endif /* DioPatternApi check */
+
+#if(DioLanesApi == STD_ON)
+static uint8 DioBench_LaneBytes[DIO_LANES_NO_OF_LANES][DIO_BENCH_LANE_BYTES];	/*!< Streams of the 8 lanes */
+static const uint8* DioBench_Lanes[DIO_LANES_NO_OF_LANES];						/*!< Lanes given to the encoder */
+static Dio_PortLevelType DioBench_LaneImages[8 * DIO_BENCH_LANE_BYTES];			/*!< Port images of the streams */
+#endif /* DioLanesApi check */
+
+#if(DioStreamApi == STD_ON)
+static const Dio_StreamConfigType DioBench_Stream = {
+	DIO_PORTB, 0xFF, DioBench_StreamNotification
+};	/*!< Stream of port B, the played buffers are queued again */
+
+static Dio_PortLevelType DioBench_StreamImages[2][DIO_BENCH_STREAM_IMAGES];	/*!< Ping-pong buffers of the stream */
+static uint16 DioBench_StreamLength;											/*!< Images of a buffer in the running benchmark */
+#endif /* DioStreamApi check */
+
+static uint8 DioBench_SerialTx[DIO_BENCH_SERIAL_BYTES];	/*!< Bytes sent by the soft SPI and I2C */
+static uint8 DioBench_SerialRx[DIO_BENCH_SERIAL_BYTES];	/*!< Bytes received by the soft SPI and I2C */
+
+#if(DioSoftSpiApi == STD_ON)
+static const Dio_SoftSpiConfigType DioBench_SpiJoined = {
+	DIO_CHANNEL_B0, DIO_CHANNEL_B1, DIO_CHANNEL_B2, DIO_CHANNEL_B3, DIO_SOFT_SPI_MODE_0, FALSE
+};	/*!< SCK and MOSI on port B, one store per clock edge */
+
+static const Dio_SoftSpiConfigType DioBench_SpiSplit = {
+	DIO_CHANNEL_B0, DIO_CHANNEL_E1, DIO_CHANNEL_E2, DIO_CHANNEL_B3, DIO_SOFT_SPI_MODE_0, FALSE
+};	/*!< SCK and MOSI on ports B and E */
+
+static const Dio_SoftSpiConfigType DioBench_SpiMode3 = {
+	DIO_CHANNEL_B0, DIO_CHANNEL_B1, DIO_CHANNEL_B2, DIO_CHANNEL_B3, DIO_SOFT_SPI_MODE_3, TRUE
+};	/*!< Joined pins, mode 3, LSB first */
+
+static Dio_SoftSpiType DioBench_Spi;	/*!< Soft SPI of the running benchmark */
+#endif /* DioSoftSpiApi check */
+
+#if(DioSoftI2cApi == STD_ON)
+static const Port_PinConfigType DioBench_I2cPins[] = {
+	{PORT_PIN_E4, PORT_PIN_DIO, PORT_CURRENT_DEFAULT, PORT_PIN_OUT, STD_HIGH, PORT_PULL_UP_ENABLE, PORT_PULL_DOWN_DISABLE,
+	 PORT_OPEN_DRAIN_ENABLE, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E5, PORT_PIN_DIO, PORT_CURRENT_DEFAULT, PORT_PIN_OUT, STD_HIGH, PORT_PULL_UP_ENABLE, PORT_PULL_DOWN_DISABLE,
+	 PORT_OPEN_DRAIN_ENABLE, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< SCL on E4 and SDA on E5, open-drain with pull-ups */
+
+static const Port_ConfigType DioBench_I2cConfig = {
+	DioBench_I2cPins, sizeof(DioBench_I2cPins) / sizeof(DioBench_I2cPins[0]), NULL_PTR
+};	/*!< Pins of the soft I2C */
+
+static const Dio_SoftI2cConfigType DioBench_I2cBus = {
+	DIO_CHANNEL_E4, DIO_CHANNEL_E5, 0, 0
+};	/*!< Soft I2C at the store rate */
+
+static Dio_SoftI2cType DioBench_I2c;	/*!< Soft I2C of the benchmarks */
+#endif /* DioSoftI2cApi check */
+
+static const Dio_ChannelGroupType DioBench_Group = {0x0E, 1, DIO_PORTF};	/*!< F1 .. F3 */
+
+static const DioBench_CaseType DioBench_Cases[] = {
+	{"Dio_ReadChannel",			NULL_PTR,				DioBench_ReadChannel,		1000000},
+	{"Dio_WriteChannel",		NULL_PTR,				DioBench_WriteChannel,		1000000},
+	{"Dio_ReadChannel 6 ports",	DioBench_SetupWide,		DioBench_ReadChannelWide,	1000000},
+	{"Dio_WriteChannel 6 ports",	DioBench_SetupWide,		DioBench_WriteChannelWide,	1000000},
+	{"Dio_ReadPort",			NULL_PTR,				DioBench_ReadPort,			1000000},
+	{"Dio_WritePort",			NULL_PTR,				DioBench_WritePort,			1000000},
+	{"Dio_ReadChannelGroup",	NULL_PTR,				DioBench_ReadChannelGroup,	1000000},
+	{"Dio_WriteChannelGroup",	NULL_PTR,				DioBench_WriteChannelGroup,	1000000},
+	{"GPIODATA F1 masked",		NULL_PTR,				DioBench_StoreMasked,		1000000},
+	{"GPIODATA F1 bit-band",	NULL_PTR,				DioBench_StoreBitBand,		1000000},
+	{"GPIODATA F1 APB",			DioBench_SetupApb,		DioBench_StoreApb,			1000000},
+	{"GPIODATA F1 AHB",			DioBench_SetupAhb,		DioBench_StoreAhb,			1000000},
+#if(DioFlipChannelApi == STD_ON)
+	{"Dio_FlipChannel",			NULL_PTR,				DioBench_FlipChannel,		1000000},
+	{"Dio_FlipChannels 4 ports",	DioBench_SetupWide,		DioBench_FlipChannels,		1000000},
+#endif /* DioFlipChannelApi check */
+	{"Port_Init",				NULL_PTR,				DioBench_PortInit,			20000},
+	{"Port_Init 8 pins A/E/F",	NULL_PTR,				DioBench_PortInitAef,		20000},
+	{"Port_Init images A/E/F",	NULL_PTR,				DioBench_PortInitImages,	20000},
+	{"Port_SetPinDirection",	NULL_PTR,				DioBench_SetPinDirection,	1000000},
+	{"Port_SetPinMode",			NULL_PTR,				DioBench_SetPinMode,		200000},
+	{"Dio_WriteChannel x20",	DioBench_SetupWide,		DioBench_WriteChannelBatch,	100000},
+	{"Dio_ReadChannel x20",		DioBench_SetupWide,		DioBench_ReadChannelBatch,	100000},
+#if(DioChannelListApi == STD_ON)
+	{"Dio_WriteChannelList 20",	DioBench_SetupWide,		DioBench_WriteChannelList,	100000},
+	{"Dio_ReadChannelList 20",	DioBench_SetupWide,		DioBench_ReadChannelList,	100000},
+	{"Dio_WriteChannelSet 20",	DioBench_SetupWideSet,	DioBench_WriteChannelSet,	100000},
+	{"Dio_ReadChannelSet 20",	DioBench_SetupWideSet,	DioBench_ReadChannelSet,	100000},
+#endif /* DioChannelListApi check */
+#if(DioDebounceApi == STD_ON)
+	{"Dio_DebounceMainFunction",	DioBench_SetupDebounce,	DioBench_DebounceMainFunction,	1000000},
+#endif /* DioDebounceApi check */
+#if(DioEdgeApi == STD_ON)
+	{"Dio_EdgeIsr 0x01",		DioBench_SetupEdge,		DioBench_EdgeIsr1,			1000000},
+	{"Dio_EdgeIsr 0x91",		DioBench_SetupEdge,		DioBench_EdgeIsr3,			1000000},
+	{"Dio_EdgeIsr 0x99",		DioBench_SetupEdge,		DioBench_EdgeIsr4,			1000000},
+#endif /* DioEdgeApi check */
+#if(DioPatternApi == STD_ON)
+	{"Dio_PatternTick",			DioBench_SetupPattern,	DioBench_PatternTick,		1000000},
+#endif /* DioPatternApi check */
+#if(DioCaptureApi == STD_ON)
+	{"Dio_CaptureSample 1 port",	DioBench_SetupCapture1,	DioBench_CaptureSample,		1000000},
+	{"Dio_CaptureSample 2 ports",	DioBench_SetupCapture2,	DioBench_CaptureSample,		1000000},
+	{"Dio_CaptureSample 3 ports",	DioBench_SetupCapture3,	DioBench_CaptureSample,		1000000},
+	{"Dio_CaptureSample 4 ports",	DioBench_SetupCapture4,	DioBench_CaptureSample,		1000000},
+#endif /* DioCaptureApi check */
+#if(DioLanesApi == STD_ON)
+	{"Dio_LanesEncode 8x4KiB",	DioBench_SetupLanes,	DioBench_LanesEncode,		2000},
+	{"Dio_LanesWrite 8x4KiB",	DioBench_SetupLanes,	DioBench_LanesWrite,		200},
+#endif /* DioLanesApi check */
+#if(DioStreamApi == STD_ON)
+	{"Dio_Stream 256 images",	DioBench_SetupStream256,	DioBench_StreamBuffer,	20000},
+	{"Dio_StreamIsr + queue",	DioBench_SetupStream1,	DioBench_StreamBuffer,		1000000},
+#endif /* DioStreamApi check */
+#if(DioSoftSpiApi == STD_ON)
+	{"Dio_SoftSpi 16 B joined",	DioBench_SetupSpiJoined,	DioBench_SoftSpi,		20000},
+	{"Dio_SoftSpi 16 B split",	DioBench_SetupSpiSplit,	DioBench_SoftSpi,			20000},
+	{"Dio_SoftSpi 16 B m3 LSB",	DioBench_SetupSpiMode3,	DioBench_SoftSpi,			20000},
+#endif /* DioSoftSpiApi check */
+#if(DioSoftI2cApi == STD_ON)
+	{"Dio_SoftI2c 16 B write",	DioBench_SetupI2c,		DioBench_SoftI2cWrite,		20000},
+	{"Dio_SoftI2c 16 B read",	DioBench_SetupI2c,		DioBench_SoftI2cRead,		20000},
+#endif /* DioSoftI2cApi check */
+	{"Port_SetPinMode 8 pins",	DioBench_SetupAef,		DioBench_SetPinModeAef,		50000},
+#if(DioFlipChannelApi == STD_ON)
+	{"Shadow workload",			NULL_PTR,				DioBench_ShadowWorkload,	50000}
+#endif /* DioFlipChannelApi check */
+};	/*!< Benchmarks */
+
+#define DIO_BENCH_NO_OF_CASES	(sizeof(DioBench_Cases) / sizeof(DioBench_Cases[0]))	/*!< Number of benchmarks */
+
+static const DioBench_LinkType DioBench_Links[] = {
+#if(DioSoftSpiApi == STD_ON)
+	{"Dio_SoftSpi 16 B joined",	8 * DIO_BENCH_SERIAL_BYTES},
+	{"Dio_SoftSpi 16 B split",	8 * DIO_BENCH_SERIAL_BYTES},
+	{"Dio_SoftSpi 16 B m3 LSB",	8 * DIO_BENCH_SERIAL_BYTES},
+#endif /* DioSoftSpiApi check */
+#if(DioSoftI2cApi == STD_ON)
+	{"Dio_SoftI2c 16 B write",	9 * (DIO_BENCH_SERIAL_BYTES + 1)},
+	{"Dio_SoftI2c 16 B read",	9 * (DIO_BENCH_SERIAL_BYTES + 1)},
+#endif /* DioSoftI2cApi check */
+	{NULL_PTR,					0}
+};	/*!< Serial links benchmarks: 8 clocks per byte, 9 per I2C byte with its acknowledge, the address included */
+
+static volatile uint32 DioBench_Sink;	/*!< Keeps the read levels alive */
+static uint32 DioBench_Faults = 0;		/*!< Faulty accesses of the benchmarks already run */
+
+/* Private Functions Declaration */
+static void DioBench_ReadChannel(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint32 DIO_Sum = 0;
+	
+	while(0 != Iterations--)
+	{
+		DIO_Sum += Dio_ReadChannel(DIO_CHANNEL_F4);
+	}
+	DioBench_Sink = DIO_Sum;
+}
+
+static void DioBench_WriteChannel(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_WriteChannel(DIO_CHANNEL_F1, (Dio_LevelType)(Iterations & 1));
+	}
+}
+
+static void DioBench_ReadChannelWide(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint32 DIO_Sum = 0;
+	uint8 DIO_Channel = 0;
+	
+	/* An operation: the next channel of the 20 outputs, so the lookups spread over the table */
+	while(0 != Iterations--)
+	{
+		DIO_Sum += Dio_ReadChannel(DioBench_WideChannels[DIO_Channel]);
+		DIO_Channel = (uint8)((DIO_Channel + 1) % DIO_BENCH_WIDE_CHANNELS);
+	}
+	DioBench_Sink = DIO_Sum;
+}
+
+static void DioBench_WriteChannelWide(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint8 DIO_Channel = 0;
+	
+	while(0 != Iterations--)
+	{
+		Dio_WriteChannel(DioBench_WideChannels[DIO_Channel], (Dio_LevelType)(Iterations & 1));
+		DIO_Channel = (uint8)((DIO_Channel + 1) % DIO_BENCH_WIDE_CHANNELS);
+	}
+}
+
+static void DioBench_ReadPort(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint32 DIO_Sum = 0;
+	
+	while(0 != Iterations--)
+	{
+		DIO_Sum += Dio_ReadPort(DIO_PORTF);
+	}
+	DioBench_Sink = DIO_Sum;
+}
+
+static void DioBench_WritePort(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_WritePort(DIO_PORTF, (Dio_PortLevelType)(Iterations & 0x0E));
+	}
+}
+
+static void DioBench_ReadChannelGroup(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint32 DIO_Sum = 0;
+	
+	while(0 != Iterations--)
+	{
+		DIO_Sum += Dio_ReadChannelGroup(&DioBench_Group);
+	}
+	DioBench_Sink = DIO_Sum;
+}
+
+static void DioBench_WriteChannelGroup(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_WriteChannelGroup(&DioBench_Group, (Dio_PortLevelType)(Iterations & 0x07));
+	}
+}
+
+static void DioBench_StoreMasked(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		HW_W_8RIG(HW_GPIOPORTF_BASE + HW_GPIODATA_OFFSET + (0x02 << 2), (Iterations & 1) ? 0xFF : 0x00);
+	}
+}
+
+static void DioBench_StoreBitBand(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		HW_W_8RIG(HW_BITBAND_ALIAS(HW_GPIOPORTF_BASE + HW_GPIODATA_OFFSET + 0x3FC, 1), Iterations & 1);
+	}
+}
+
+static void DioBench_StoreApb(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		HW_W_8RIG(HW_GPIOPORTF_APB_BASE + HW_GPIODATA_OFFSET + (0x02 << 2), (Iterations & 1) ? 0xFF : 0x00);
+	}
+}
+
+static void DioBench_StoreAhb(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		HW_W_8RIG(HW_GPIOPORTF_AHB_BASE + HW_GPIODATA_OFFSET + (0x02 << 2), (Iterations & 1) ? 0xFF : 0x00);
+	}
+}
+
+#if(DioFlipChannelApi == STD_ON)
+static void DioBench_FlipChannel(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint32 DIO_Sum = 0;
+	
+	while(0 != Iterations--)
+	{
+		DIO_Sum += Dio_FlipChannel(DIO_CHANNEL_F2);
+	}
+	DioBench_Sink = DIO_Sum;
+}
+
+static void DioBench_FlipChannels(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_FlipChannels(DioBench_FlipMasks);
+	}
+}
+#endif /* DioFlipChannelApi check */
+
+static void DioBench_PortInit(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Port_Init(&DioBench_Config);
+	}
+}
+
+static void DioBench_PortInitAef(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Port_Init(&DioBench_AefConfig);
+	}
+}
+
+static void DioBench_PortInitImages(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Port_Init(&DioBench_AefImageConfig);
+	}
+}
+
+static void DioBench_SetPinDirection(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Port_SetPinDirection(PORT_PIN_F3, (Port_PinDirectionType)(Iterations & 1));
+	}
+}
+
+static void DioBench_SetPinMode(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Port_SetPinMode(PORT_PIN_F2, PORT_PIN_DIO);
+	}
+}
+
+static void DioBench_WriteChannelBatch(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint8 DIO_Channel;
+	
+	/* An operation: a batch of the 20 outputs, one service call per channel */
+	while(0 != Iterations--)
+	{
+		for(DIO_Channel = 0; DIO_Channel < DIO_BENCH_WIDE_CHANNELS; DIO_Channel++)
+		{
+			Dio_WriteChannel(DioBench_WideChannels[DIO_Channel], DioBench_WideLevels[Iterations & 1][DIO_Channel]);
+		}
+	}
+}
+
+static void DioBench_ReadChannelBatch(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint8 DIO_Channel;
+	
+	while(0 != Iterations--)
+	{
+		for(DIO_Channel = 0; DIO_Channel < DIO_BENCH_WIDE_CHANNELS; DIO_Channel++)
+		{
+			DioBench_WideRead[DIO_Channel] = Dio_ReadChannel(DioBench_WideChannels[DIO_Channel]);
+		}
+	}
+}
+
+#if(DioChannelListApi == STD_ON)
+static void DioBench_WriteChannelList(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_WriteChannelList(DioBench_WideChannels, DioBench_WideLevels[Iterations & 1], DIO_BENCH_WIDE_CHANNELS);
+	}
+}
+
+static void DioBench_ReadChannelList(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_ReadChannelList(DioBench_WideChannels, DioBench_WideRead, DIO_BENCH_WIDE_CHANNELS);
+	}
+}
+
+static void DioBench_WriteChannelSet(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_WriteChannelSet(&DioBench_WideSet, DioBench_WideLevels[Iterations & 1]);
+	}
+}
+
+static void DioBench_ReadChannelSet(uint32 Iterations)
+{
+	while(0 != Iterations--)
+	{
+		Dio_ReadChannelSet(&DioBench_WideSet, DioBench_WideRead);
+	}
+}
+#endif /* DioChannelListApi check */
+
+#if(DioDebounceApi == STD_ON)
+static void DioBench_DebounceMainFunction(uint32 Iterations)
+{
+	/* An operation: a tick of the 40 channels, their levels don't move (same cost as a bouncing tick) */
+	while(0 != Iterations--)
+	{
+		Dio_DebounceMainFunction();
+	}
+}
+#endif /* DioDebounceApi check */
+
+#if(DioEdgeApi == STD_ON)
+static void DioBench_EdgeIsr1(uint32 Iterations)
+{
+	DioBench_EdgeIsr(Iterations, 0x01);
+}
+
+static void DioBench_EdgeIsr3(uint32 Iterations)
+{
+	DioBench_EdgeIsr(Iterations, 0x91);
+}
+
+static void DioBench_EdgeIsr4(uint32 Iterations)
+{
+	DioBench_EdgeIsr(Iterations, 0x99);
+}
+
+/**
+ *	\brief		Latches edges on pins of port B and dispatches them, Iterations times.
+ *	\param[in] 	Iterations: 	Number of dispatches.
+ *	\param[in] 	Pending: 	Pins whose edges are pending at every dispatch.
+ *	\return		None.
+ */
+static void DioBench_EdgeIsr(uint32 Iterations, uint8 Pending)
+{
+	/* An operation: the pending pins toggle (outside of the accounting, in the model) and
+	   the interrupt of the port dispatches their edges */
+	while(0 != Iterations--)
+	{
+		HW_RegsModelDrivePins(DIO_PORTB, Pending, (0 != (Iterations & 1)) ? Pending : 0);
+		Dio_EdgeIsr(DIO_PORTB);
+	}
+}
+
+/**
+ *	\brief		Notification of the edges, counts them.
+ *	\param[in] 	ChannelId: 	Channel of the edge.
+ *	\return		None.
+ */
+static void DioBench_EdgeNotification(Dio_ChannelType ChannelId)
+{
+	(void)ChannelId;
+	DioBench_Edges++;
+}
+#endif /* DioEdgeApi check */
+
+#if(DioPatternApi == STD_ON)
+static void DioBench_PatternTick(uint32 Iterations)
+{
+	/* An operation: a timer tick writing one step */
+	while(0 != Iterations--)
+	{
+		Dio_PatternTick();
+	}
+}
+#endif /* DioPatternApi check */
+
+#if(DioCaptureApi == STD_ON)
+static void DioBench_CaptureSample(uint32 Iterations)
+{
+	/* An operation: a quiet sample, the levels don't change so nothing is recorded */
+	while(0 != Iterations--)
+	{
+		Dio_CaptureSample();
+	}
+}
+#endif /* DioCaptureApi check */
+
+#if(DioLanesApi == STD_ON)
+static void DioBench_LanesEncode(uint32 Iterations)
+{
+	/* An operation: 4 KiB of every lane transposed into 32768 port images */
+	while(0 != Iterations--)
+	{
+		(void)Dio_LanesEncode(DioBench_Lanes, DioBench_LaneImages, DIO_BENCH_LANE_BYTES);
+	}
+}
+
+static void DioBench_LanesWrite(uint32 Iterations)
+{
+	/* An operation: the 32768 images stored to port B without delay, a bit time of the 8 lanes per store */
+	while(0 != Iterations--)
+	{
+		(void)Dio_LanesWrite(DIO_PORTB, 0xFF, DioBench_LaneImages, (uint16)(sizeof(DioBench_LaneImages) / sizeof(DioBench_LaneImages[0])), 0);
+	}
+}
+#endif /* DioLanesApi check */
+
+#if(DioStreamApi == STD_ON)
+static void DioBench_StreamBuffer(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint16 DIO_Request;
+	
+	/* An operation: a buffer played by the timer requests, then its completion interrupt
+	   queueing it again. With 1 image buffers it is the CPU cost of a buffer and one moved image */
+	while(0 != Iterations--)
+	{
+		for(DIO_Request = 0; DIO_Request < DioBench_StreamLength; DIO_Request++)
+		{
+			(void)HW_UdmaModelRequest(DioStreamDmaChannel);
+		}
+		Dio_StreamIsr();
+	}
+}
+
+/**
+ *	\brief		Notification of the played buffers, queues the buffer again.
+ *	\param[in] 	ImagesPtr: 	Played buffer.
+ *	\return		None.
+ */
+static void DioBench_StreamNotification(const Dio_PortLevelType* ImagesPtr)
+{
+	(void)Dio_StreamQueue(ImagesPtr, DioBench_StreamLength);
+}
+#endif /* DioStreamApi check */
+
+#if(DioSoftSpiApi == STD_ON)
+static void DioBench_SoftSpi(uint32 Iterations)
+{
+	/* An operation: 16 bytes both ways, CS included */
+	while(0 != Iterations--)
+	{
+		Dio_SoftSpiTransfer(&DioBench_Spi, DioBench_SerialTx, DioBench_SerialRx, DIO_BENCH_SERIAL_BYTES);
+	}
+}
+#endif /* DioSoftSpiApi check */
+
+#if(DioSoftI2cApi == STD_ON)
+static void DioBench_SoftI2cWrite(uint32 Iterations)
+{
+	/* An operation: START, address, 16 written bytes, STOP */
+	while(0 != Iterations--)
+	{
+		(void)Dio_SoftI2cTransfer(&DioBench_I2c, 0x3A, DioBench_SerialTx, DIO_BENCH_SERIAL_BYTES, NULL_PTR, 0);
+	}
+}
+
+static void DioBench_SoftI2cRead(uint32 Iterations)
+{
+	/* An operation: START, address, 16 read bytes, STOP */
+	while(0 != Iterations--)
+	{
+		(void)Dio_SoftI2cTransfer(&DioBench_I2c, 0x3A, NULL_PTR, 0, DioBench_SerialRx, DIO_BENCH_SERIAL_BYTES);
+	}
+}
+#endif /* DioSoftI2cApi check */
+
+static void DioBench_SetPinModeAef(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint8 DIO_Pin;
+	
+	/* An operation: every pin of the 8 pins set */
+	while(0 != Iterations--)
+	{
+		for(DIO_Pin = 0; DIO_Pin < (sizeof(DioBench_AefPins) / sizeof(DioBench_AefPins[0])); DIO_Pin++)
+		{
+			Port_SetPinMode(DioBench_AefPins[DIO_Pin].Port_Pin, PORT_PIN_DIO);
+		}
+	}
+}
+
+#if(DioFlipChannelApi == STD_ON)
+static void DioBench_ShadowWorkload(uint32 Iterations)
+{
+	/* Needed Variables */
+	uint32 DIO_Sum = 0;
+	uint8 DIO_Call;
+	
+	/* An operation: 10 flips, 10 writes of the level the pin holds, 1 unchanged direction */
+	while(0 != Iterations--)
+	{
+		for(DIO_Call = 0; DIO_Call < 10; DIO_Call++)
+		{
+			DIO_Sum += Dio_FlipChannel(DIO_CHANNEL_F1);
+			Dio_WriteChannel(DIO_CHANNEL_F2, STD_HIGH);
+		}
+		Port_SetPinDirection(PORT_PIN_F3, PORT_PIN_OUT);
+	}
+	DioBench_Sink = DIO_Sum;
+}
+#endif /* DioFlipChannelApi check */
+
+/**
+ *	\brief		Initializes the 8 pins set on ports A, E and F.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupAef(void)
+{
+	Port_Init(&DioBench_AefConfig);
+}
+
+/**
+ *	\brief		Moves PORT F to the APB aperture, whatever HW_GPIO_AHB_PORTS selects.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupApb(void)
+{
+	HW_W_8RIG((HW_SYSTEM_CONTROL_BA + HW_GPIOHBCTL_OFFSET),
+			  HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_GPIOHBCTL_OFFSET) & ~(uint32)(1 << DIO_PORTF));
+}
+
+/**
+ *	\brief		Moves PORT F to the AHB aperture, whatever HW_GPIO_AHB_PORTS selects.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupAhb(void)
+{
+	HW_W_8RIG((HW_SYSTEM_CONTROL_BA + HW_GPIOHBCTL_OFFSET),
+			  HW_R_8RIG(HW_SYSTEM_CONTROL_BA + HW_GPIOHBCTL_OFFSET) | (uint32)(1 << DIO_PORTF));
+}
+
+/**
+ *	\brief		Initializes the 20 outputs set on all 6 ports.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupWide(void)
+{
+	/* Needed Variables */
+	uint8 DIO_Channel;
+	
+	Port_Init(&DioBench_WideConfig);
+	for(DIO_Channel = 0; DIO_Channel < DIO_BENCH_WIDE_CHANNELS; DIO_Channel++)
+	{
+		DioBench_WideLevels[0][DIO_Channel] = (Dio_LevelType)(DIO_Channel & 1);
+		DioBench_WideLevels[1][DIO_Channel] = (Dio_LevelType)((DIO_Channel >> 1) & 1);
+	}
+}
+
+#if(DioChannelListApi == STD_ON)
+/**
+ *	\brief		Initializes the 20 outputs set and groups its channels into a set.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupWideSet(void)
+{
+	DioBench_SetupWide();
+	(void)Dio_CreateChannelSet(&DioBench_WideSet, DioBench_WideChannels, DIO_BENCH_WIDE_CHANNELS);
+}
+#endif /* DioChannelListApi check */
+
+#if(DioDebounceApi == STD_ON)
+/**
+ *	\brief		Initializes the 20 outputs set, so every port is clocked, and debounces 40
+ *				channels over all 6 ports with thresholds from 1 to 7 ticks.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupDebounce(void)
+{
+	/* Needed Variables */
+	uint8 DIO_Channel;
+	
+	DioBench_SetupWide();
+	for(DIO_Channel = 0; DIO_Channel < DIO_BENCH_DEBOUNCED; DIO_Channel++)
+	{
+		/* 8 pins of ports A .. D, then pins 0 .. 3 of E and F */
+		DioBench_DebounceChannels[DIO_Channel].Dio_ChannelId = (DIO_Channel < 32) ?
+			(Dio_ChannelType)(((DIO_Channel >> 3) << 4) | (DIO_Channel & 0x07)) :
+			(Dio_ChannelType)(((4 + ((DIO_Channel - 32) >> 2)) << 4) | (DIO_Channel & 0x03));
+		DioBench_DebounceChannels[DIO_Channel].Dio_Threshold = (uint8)((DIO_Channel % 7) + 1);
+	}
+	(void)Dio_DebounceInit(&DioBench_DebounceConfig);
+}
+#endif /* DioDebounceApi check */
+
+#if(DioEdgeApi == STD_ON)
+/**
+ *	\brief		Initializes the edges set and enables the notifications of its pins.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupEdge(void)
+{
+	/* Needed Variables */
+	uint8 DIO_Pin;
+	
+	Port_Init(&DioBench_EdgeConfig);
+	for(DIO_Pin = 0; DIO_Pin < (sizeof(DioBench_EdgePins) / sizeof(DioBench_EdgePins[0])); DIO_Pin++)
+	{
+		(void)Dio_EdgeSetNotification((Dio_ChannelType)DioBench_EdgePins[DIO_Pin].Port_Pin, DioBench_EdgeNotification);
+		(void)Dio_EdgeEnableNotification((Dio_ChannelType)DioBench_EdgePins[DIO_Pin].Port_Pin);
+	}
+}
+#endif /* DioEdgeApi check */
+
+#if(DioPatternApi == STD_ON)
+/**
+ *	\brief		Loads the walking LED pattern and plays its first step.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupPattern(void)
+{
+	Dio_PatternInit();
+	(void)Dio_PatternLoad(&DioBench_Pattern);
+	Dio_PatternTick();
+}
+#endif /* DioPatternApi check */
+
+#if(DioCaptureApi == STD_ON)
+static void DioBench_SetupCapture1(void)
+{
+	DioBench_SetupCapture(0x01);
+}
+
+static void DioBench_SetupCapture2(void)
+{
+	DioBench_SetupCapture(0x03);
+}
+
+static void DioBench_SetupCapture3(void)
+{
+	DioBench_SetupCapture(0x07);
+}
+
+static void DioBench_SetupCapture4(void)
+{
+	DioBench_SetupCapture(0x0F);
+}
+
+/**
+ *	\brief		Initializes the 20 outputs set and starts a capture of ports which never triggers.
+ *	\param[in] 	PortsMask: 	Sampled ports, a bit per port ID.
+ *	\return		None.
+ */
+static void DioBench_SetupCapture(uint8 PortsMask)
+{
+	/* Needed Variables */
+	Dio_CaptureConfigType DIO_Config;
+	
+	DioBench_SetupWide();
+	
+	/* A2 is a low output, waiting for it to be high keeps the capture armed */
+	DIO_Config.Dio_PortsMask = PortsMask;
+	DIO_Config.Dio_TriggerMask = 0x04;
+	DIO_Config.Dio_TriggerPattern = 0x04;
+	DIO_Config.Dio_PostTrigger = 0;
+	DIO_Config.Dio_SamplePeriodNs = 10000;
+	(void)Dio_CaptureStart(&DIO_Config);
+}
+#endif /* DioCaptureApi check */
+
+#if(DioLanesApi == STD_ON)
+/**
+ *	\brief		Initializes the 20 outputs set, so port B is clocked, fills the lanes with
+ *				pseudo random bytes and encodes them once.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupLanes(void)
+{
+	/* Needed Variables */
+	uint32 DIO_Random = 0x2545F491;
+	uint16 DIO_Byte;
+	uint8 DIO_Lane;
+	
+	DioBench_SetupWide();
+	for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+	{
+		for(DIO_Byte = 0; DIO_Byte < DIO_BENCH_LANE_BYTES; DIO_Byte++)
+		{
+			/* xorshift32 */
+			DIO_Random ^= (DIO_Random << 13) & 0xFFFFFFFF;
+			DIO_Random ^= DIO_Random >> 17;
+			DIO_Random ^= (DIO_Random << 5) & 0xFFFFFFFF;
+			DioBench_LaneBytes[DIO_Lane][DIO_Byte] = (uint8)DIO_Random;
+		}
+		DioBench_Lanes[DIO_Lane] = DioBench_LaneBytes[DIO_Lane];
+	}
+	(void)Dio_LanesEncode(DioBench_Lanes, DioBench_LaneImages, DIO_BENCH_LANE_BYTES);
+}
+#endif /* DioLanesApi check */
+
+#if(DioStreamApi == STD_ON)
+static void DioBench_SetupStream1(void)
+{
+	DioBench_SetupStream(1);
+}
+
+static void DioBench_SetupStream256(void)
+{
+	DioBench_SetupStream(DIO_BENCH_STREAM_IMAGES);
+}
+
+/**
+ *	\brief		Initializes the 20 outputs set and starts a stream of port B with both
+ *				buffers queued.
+ *	\param[in] 	Length: 	Images of a buffer.
+ *	\return		None.
+ */
+static void DioBench_SetupStream(uint16 Length)
+{
+	/* Needed Variables */
+	uint16 DIO_Image;
+	
+	DioBench_SetupWide();
+	for(DIO_Image = 0; DIO_Image < DIO_BENCH_STREAM_IMAGES; DIO_Image++)
+	{
+		DioBench_StreamImages[0][DIO_Image] = (Dio_PortLevelType)DIO_Image;
+		DioBench_StreamImages[1][DIO_Image] = (Dio_PortLevelType)~DIO_Image;
+	}
+	DioBench_StreamLength = Length;
+	(void)Dio_StreamInit();
+	(void)Dio_StreamStart(&DioBench_Stream);
+	(void)Dio_StreamQueue(DioBench_StreamImages[0], Length);
+	(void)Dio_StreamQueue(DioBench_StreamImages[1], Length);
+}
+#endif /* DioStreamApi check */
+
+#if(DioSoftSpiApi == STD_ON)
+static void DioBench_SetupSpiJoined(void)
+{
+	DioBench_SetupSpi(&DioBench_SpiJoined);
+}
+
+static void DioBench_SetupSpiSplit(void)
+{
+	DioBench_SetupSpi(&DioBench_SpiSplit);
+}
+
+static void DioBench_SetupSpiMode3(void)
+{
+	DioBench_SetupSpi(&DioBench_SpiMode3);
+}
+
+/**
+ *	\brief		Initializes the 20 outputs set and a soft SPI on them.
+ *	\param[in] 	ConfigPtr: 	Pins and mode of the soft SPI.
+ *	\return		None.
+ */
+static void DioBench_SetupSpi(const Dio_SoftSpiConfigType* ConfigPtr)
+{
+	/* Needed Variables */
+	uint8 DIO_Byte;
+	
+	DioBench_SetupWide();
+	for(DIO_Byte = 0; DIO_Byte < DIO_BENCH_SERIAL_BYTES; DIO_Byte++)
+	{
+		DioBench_SerialTx[DIO_Byte] = (uint8)(0x5A ^ (DIO_Byte * 0x3B));
+	}
+	(void)Dio_SoftSpiInit(&DioBench_Spi, ConfigPtr);
+}
+#endif /* DioSoftSpiApi check */
+
+#if(DioSoftI2cApi == STD_ON)
+/**
+ *	\brief		Initializes the soft I2C on a free bus, then holds SDA low: every acknowledge
+ *				reads 0, the master accesses the registers as with an acknowledging slave.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioBench_SetupI2c(void)
+{
+	/* Needed Variables */
+	uint8 DIO_Byte;
+	
+	Port_Init(&DioBench_I2cConfig);
+	for(DIO_Byte = 0; DIO_Byte < DIO_BENCH_SERIAL_BYTES; DIO_Byte++)
+	{
+		DioBench_SerialTx[DIO_Byte] = (uint8)(0x5A ^ (DIO_Byte * 0x3B));
+	}
+	(void)Dio_SoftI2cInit(&DioBench_I2c, &DioBench_I2cBus);
+	HW_RegsModelDrivePins(DIO_PORTE, 0x20, 0x00);
+}
+#endif /* DioSoftI2cApi check */
+
+/**
+ *	\brief		Opens the user-space instructions counter of the process.
+ *	\param		None.
+ *	\return		int: 	File descriptor of the counter, -1 if not available.
+ */
+static int DioBench_OpenCounter(void)
+{
+	/* Needed Variables */
+	int DIO_Counter = -1;
+#if defined(__linux__)
+	struct perf_event_attr DIO_Attr;
+	
+	memset(&DIO_Attr, 0, sizeof(DIO_Attr));
+	DIO_Attr.type = PERF_TYPE_HARDWARE;
+	DIO_Attr.size = sizeof(DIO_Attr);
+	DIO_Attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+	DIO_Attr.disabled = 1;
+	DIO_Attr.exclude_kernel = 1;
+	DIO_Attr.exclude_hv = 1;
+	DIO_Counter = (int)syscall(SYS_perf_event_open, &DIO_Attr, 0, -1, -1, 0);
+#endif /* Linux check */
+	
+	return (DIO_Counter >= 0) ? DIO_Counter : -1;
+}
+
+/**
+ *	\brief		Runs and measures a benchmark.
+ *	\param[in] 	CasePtr: 	Pointer to the benchmark.
+ *	\param[in] 	Divisor: 	Divisor of the iterations of the benchmark.
+ *	\param[in] 	Counter: 	File descriptor of the instructions counter, -1 if not available.
+ *	\param[out] ResultPtr: 	Pointer to the results.
+ *	\return		None.
+ */
+static void DioBench_Run(const DioBench_CaseType* CasePtr, uint32 Divisor, int Counter,
+						 DioBench_ResultType* ResultPtr)
+{
+	/* Needed Variables */
+	uint32 DIO_Iterations = CasePtr->DIO_Iterations / Divisor;
+	HW_AccountingCountsType DIO_Counts;
+	struct timespec DIO_Start;
+	struct timespec DIO_End;
+	double DIO_Ns;
+	uint8 DIO_Run;
+	
+	(void)snprintf(ResultPtr->DIO_Name, DIO_BENCH_NAME_SIZE, "%s", CasePtr->DIO_Name);
+	ResultPtr->DIO_Ns = 0;
+	ResultPtr->DIO_Instructions = DIO_BENCH_NA;
+	
+	/* Same start for every benchmark, the reset clears the faults of the model */
+	DioBench_Faults += HW_RegsModelGetFaults(NULL_PTR);
+	HW_RegsModelReset();
+	Port_Init(&DioBench_Config);
+	if(NULL_PTR != CasePtr->DIO_Setup)
+	{
+		CasePtr->DIO_Setup();
+	}
+	else
+	{
+		/* The benchmarks set is enough */
+	}
+	
+	/* Accesses of a few operations */
+	HW_AccountingReset();
+	HW_AccountingBegin(CasePtr->DIO_Name);
+	CasePtr->DIO_Body(DIO_BENCH_ACCESS_OPS);
+	HW_AccountingEnd();
+	(void)HW_AccountingGetApi(CasePtr->DIO_Name, &DIO_Counts);
+	ResultPtr->DIO_Transactions = (double)HW_ACCOUNTING_TRANSACTIONS(DIO_Counts) / DIO_BENCH_ACCESS_OPS;
+	HW_AccountingSuspend(TRUE);
+	
+	/* Warm up, then the best timed run */
+	CasePtr->DIO_Body(DIO_Iterations / 10);
+	for(DIO_Run = 0; DIO_Run < DIO_BENCH_RUNS; DIO_Run++)
+	{
+		(void)clock_gettime(CLOCK_MONOTONIC, &DIO_Start);
+		CasePtr->DIO_Body(DIO_Iterations);
+		(void)clock_gettime(CLOCK_MONOTONIC, &DIO_End);
+		DIO_Ns = (((double)(DIO_End.tv_sec - DIO_Start.tv_sec) * 1e9) + (double)(DIO_End.tv_nsec - DIO_Start.tv_nsec)) /
+				 DIO_Iterations;
+		if((0 == DIO_Run) || (DIO_Ns < ResultPtr->DIO_Ns))
+		{
+			ResultPtr->DIO_Ns = DIO_Ns;
+		}
+		else
+		{
+			/* Slower run */
+		}
+	}
+	
+#if defined(__linux__)
+	if(Counter >= 0)
+	{
+		/* Needed Variables */
+		uint64 DIO_Instructions = 0;
+	
+		(void)ioctl(Counter, PERF_EVENT_IOC_RESET, 0);
+		(void)ioctl(Counter, PERF_EVENT_IOC_ENABLE, 0);
+		CasePtr->DIO_Body(DIO_Iterations);
+		(void)ioctl(Counter, PERF_EVENT_IOC_DISABLE, 0);
+		if(sizeof(DIO_Instructions) == read(Counter, &DIO_Instructions, sizeof(DIO_Instructions)))
+		{
+			ResultPtr->DIO_Instructions = (double)DIO_Instructions / DIO_Iterations;
+		}
+		else
+		{
+			/* Counter not readable */
+		}
+	}
+	else
+	{
+		/* No instructions counter */
+	}
+#else
+	(void)Counter;
+#endif /* Linux check */
+	HW_AccountingSuspend(FALSE);
+}
+
+/**
+ *	\brief		Reads the results of an earlier run.
+ *	\param[in] 	FileName: 	Name of the CSV file.
+ *	\param[out] ResultsPtr: Pointer to the results, one per benchmark.
+ *	\param[in] 	MaxResults: Size of the results array.
+ *	\return		sint32: 	Number of results read, -1 if the file can't be opened.
+ */
+static sint32 DioBench_ReadBaseline(const char* FileName, DioBench_ResultType* ResultsPtr, uint8 MaxResults)
+{
+	/* Needed Variables */
+	FILE* DIO_File = fopen(FileName, "r");
+	sint32 DIO_NoOfResults = -1;
+	char DIO_Line[128];
+	char DIO_Instructions[32];
+	
+	if(NULL_PTR != DIO_File)
+	{
+		DIO_NoOfResults = 0;
+		while((DIO_NoOfResults < MaxResults) && (NULL_PTR != fgets(DIO_Line, sizeof(DIO_Line), DIO_File)))
+		{
+			/* The header and the malformed lines don't match */
+			if(4 == sscanf(DIO_Line, "%31[^,],%lf,%31[^,],%lf", ResultsPtr[DIO_NoOfResults].DIO_Name,
+						   &ResultsPtr[DIO_NoOfResults].DIO_Ns, DIO_Instructions, &ResultsPtr[DIO_NoOfResults].DIO_Transactions))
+			{
+				if(1 != sscanf(DIO_Instructions, "%lf", &ResultsPtr[DIO_NoOfResults].DIO_Instructions))
+				{
+					ResultsPtr[DIO_NoOfResults].DIO_Instructions = DIO_BENCH_NA;
+				}
+				else
+				{
+					/* Instructions available */
+				}
+				DIO_NoOfResults++;
+			}
+			else
+			{
+				/* Not a result */
+			}
+		}
+		(void)fclose(DIO_File);
+	}
+	else
+	{
+		/* No baseline */
+	}
+	
+	return DIO_NoOfResults;
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the benchmarks, prints and saves their results and compares them with a baseline.
+ *	\param[in] 	argc: 	Number of arguments.
+ *	\param[in] 	argv: 	Arguments: -q, -o results.csv, -b baseline.csv.
+ *	\return		int: 	0 on success, 1 on a fault of the register model, 2 on a wrong argument or file.
+ */
+int main(int argc, char* argv[])
+{
+	/* Needed Variables */
+	static DioBench_ResultType DIO_Results[DIO_BENCH_NO_OF_CASES];
+	static DioBench_ResultType DIO_Baseline[DIO_BENCH_NO_OF_CASES];
+	const char* DIO_OutputName = NULL_PTR;
+	const char* DIO_BaselineName = NULL_PTR;
+	sint32 DIO_NoOfBaseline = 0;
+	uint32 DIO_Divisor = 1;
+	FILE* DIO_Output;
+	int DIO_Counter;
+	int DIO_Arg;
+	sint32 DIO_Index;
+	sint32 DIO_Base;
+	uint8 DIO_Link;
+	int DIO_Status = 0;
+	
+	for(DIO_Arg = 1; (DIO_Arg < argc) && (0 == DIO_Status); DIO_Arg++)
+	{
+		if(0 == strcmp(argv[DIO_Arg], "-q"))
+		{
+			DIO_Divisor = 10;
+		}
+		else if((0 == strcmp(argv[DIO_Arg], "-o")) && ((DIO_Arg + 1) < argc))
+		{
+			DIO_OutputName = argv[++DIO_Arg];
+		}
+		else if((0 == strcmp(argv[DIO_Arg], "-b")) && ((DIO_Arg + 1) < argc))
+		{
+			DIO_BaselineName = argv[++DIO_Arg];
+		}
+		else
+		{
+			fprintf(stderr, "Usage: %s [-q] [-o results.csv] [-b baseline.csv]\n", argv[0]);
+			DIO_Status = 2;
+		}
+	}
+	if((0 == DIO_Status) && (NULL_PTR != DIO_BaselineName))
+	{
+		/* Read before running, the baseline may be the output file */
+		DIO_NoOfBaseline = DioBench_ReadBaseline(DIO_BaselineName, DIO_Baseline, DIO_BENCH_NO_OF_CASES);
+		if(DIO_NoOfBaseline < 0)
+		{
+			fprintf(stderr, "Can't read the baseline %s\n", DIO_BaselineName);
+			DIO_Status = 2;
+		}
+		else
+		{
+			/* Baseline read */
+		}
+	}
+	else
+	{
+		/* Wrong arguments or no comparison */
+	}
+	
+	if(0 == DIO_Status)
+	{
+		DIO_Counter = DioBench_OpenCounter();
+	
+		printf("%-24s %10s %14s %15s\n", "benchmark", "ns/op", "instructions/op", "transactions/op");
+		for(DIO_Index = 0; DIO_Index < (sint32)DIO_BENCH_NO_OF_CASES; DIO_Index++)
+		{
+			DioBench_Run(&DioBench_Cases[DIO_Index], DIO_Divisor, DIO_Counter, &DIO_Results[DIO_Index]);
+			if(DIO_Results[DIO_Index].DIO_Instructions != DIO_BENCH_NA)
+			{
+				printf("%-24s %10.2f %14.1f %15.2f\n", DIO_Results[DIO_Index].DIO_Name, DIO_Results[DIO_Index].DIO_Ns,
+					   DIO_Results[DIO_Index].DIO_Instructions, DIO_Results[DIO_Index].DIO_Transactions);
+			}
+			else
+			{
+				printf("%-24s %10.2f %14s %15.2f\n", DIO_Results[DIO_Index].DIO_Name, DIO_Results[DIO_Index].DIO_Ns,
+					   "na", DIO_Results[DIO_Index].DIO_Transactions);
+			}
+		}
+		if(DIO_Counter < 0)
+		{
+			printf("(instructions/op not available: no perf instructions counter)\n");
+		}
+		else
+		{
+#if defined(__linux__)
+			(void)close(DIO_Counter);
+#endif /* Linux check */
+		}
+	
+		/* Serial links per bit clocked, 2 clock edges per bit */
+		if(NULL_PTR != DioBench_Links[0].DIO_Name)
+		{
+			printf("\n%-24s %10s %16s %14s\n", "serial link", "ns/bit", "instructions/bit", "edges/s");
+		}
+		else
+		{
+			/* No serial link built */
+		}
+		for(DIO_Link = 0; NULL_PTR != DioBench_Links[DIO_Link].DIO_Name; DIO_Link++)
+		{
+			for(DIO_Index = 0; DIO_Index < (sint32)DIO_BENCH_NO_OF_CASES; DIO_Index++)
+			{
+				if(0 == strcmp(DIO_Results[DIO_Index].DIO_Name, DioBench_Links[DIO_Link].DIO_Name))
+				{
+					printf("%-24s %10.2f ", DIO_Results[DIO_Index].DIO_Name,
+						   DIO_Results[DIO_Index].DIO_Ns / DioBench_Links[DIO_Link].DIO_Bits);
+					if(DIO_Results[DIO_Index].DIO_Instructions != DIO_BENCH_NA)
+					{
+						printf("%16.1f ", DIO_Results[DIO_Index].DIO_Instructions / DioBench_Links[DIO_Link].DIO_Bits);
+					}
+					else
+					{
+						printf("%16s ", "na");
+					}
+					printf("%14.0f\n", (2e9 * DioBench_Links[DIO_Link].DIO_Bits) / DIO_Results[DIO_Index].DIO_Ns);
+				}
+				else
+				{
+					/* Another benchmark */
+				}
+			}
+		}
+	
+		if(NULL_PTR != DIO_OutputName)
+		{
+			DIO_Output = fopen(DIO_OutputName, "w");
+			if(NULL_PTR != DIO_Output)
+			{
+				fprintf(DIO_Output, "benchmark,ns_per_op,instructions_per_op,transactions_per_op\n");
+				for(DIO_Index = 0; DIO_Index < (sint32)DIO_BENCH_NO_OF_CASES; DIO_Index++)
+				{
+					fprintf(DIO_Output, "%s,%.3f,", DIO_Results[DIO_Index].DIO_Name, DIO_Results[DIO_Index].DIO_Ns);
+					if(DIO_Results[DIO_Index].DIO_Instructions != DIO_BENCH_NA)
+					{
+						fprintf(DIO_Output, "%.2f,", DIO_Results[DIO_Index].DIO_Instructions);
+					}
+					else
+					{
+						fprintf(DIO_Output, "na,");
+					}
+					fprintf(DIO_Output, "%.2f\n", DIO_Results[DIO_Index].DIO_Transactions);
+				}
+				(void)fclose(DIO_Output);
+			}
+			else
+			{
+				fprintf(stderr, "Can't write %s\n", DIO_OutputName);
+				DIO_Status = 2;
+			}
+		}
+		else
+		{
+			/* Results printed only */
+		}
+	
+		if(NULL_PTR != DIO_BaselineName)
+		{
+			printf("\n%-24s %10s %10s %8s %12s %15s\n", "versus baseline", "ns/op", "baseline", "change",
+				   "instr/op", "transactions/op");
+			for(DIO_Index = 0; DIO_Index < (sint32)DIO_BENCH_NO_OF_CASES; DIO_Index++)
+			{
+				for(DIO_Base = 0; (DIO_Base < DIO_NoOfBaseline) &&
+								  (0 != strcmp(DIO_Baseline[DIO_Base].DIO_Name, DIO_Results[DIO_Index].DIO_Name)); DIO_Base++)
+				{
+					/* Look for the benchmark */
+				}
+				if(DIO_Base < DIO_NoOfBaseline)
+				{
+					printf("%-24s %10.2f %10.2f %+7.1f%% ", DIO_Results[DIO_Index].DIO_Name, DIO_Results[DIO_Index].DIO_Ns,
+						   DIO_Baseline[DIO_Base].DIO_Ns,
+						   ((DIO_Results[DIO_Index].DIO_Ns / DIO_Baseline[DIO_Base].DIO_Ns) - 1.0) * 100.0);
+					if((DIO_Results[DIO_Index].DIO_Instructions != DIO_BENCH_NA) &&
+					   (DIO_Baseline[DIO_Base].DIO_Instructions != DIO_BENCH_NA))
+					{
+						printf("%+12.1f ", DIO_Results[DIO_Index].DIO_Instructions - DIO_Baseline[DIO_Base].DIO_Instructions);
+					}
+					else
+					{
+						printf("%12s ", "na");
+					}
+					printf("%+15.2f\n", DIO_Results[DIO_Index].DIO_Transactions - DIO_Baseline[DIO_Base].DIO_Transactions);
+				}
+				else
+				{
+					printf("%-24s %10.2f %10s\n", DIO_Results[DIO_Index].DIO_Name, DIO_Results[DIO_Index].DIO_Ns, "new");
+				}
+			}
+		}
+		else
+		{
+			/* No comparison */
+		}
+	
+		DioBench_Faults += HW_RegsModelGetFaults(NULL_PTR);
+		if((0 == DIO_Status) && (0 != DioBench_Faults))
+		{
+			fprintf(stderr, "%lu faulty registers accesses\n", (unsigned long)DioBench_Faults);
+			DIO_Status = 1;
+		}
+		else
+		{
+			/* No fault */
+		}
+	}
+	else
+	{
+		/* Wrong arguments */
+	}
+	
+	return DIO_Status;
+}
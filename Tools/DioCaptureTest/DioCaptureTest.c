@@ -0,0 +1,509 @@
+/**
+ *  \file	DioCaptureTest.c
+ *  \brief 	Host functional test of the DIO capture (DioCapture.h) and of its VCD decoder
+ *  		(Tools/DioCaptureVcd) on the register model (TivaRegsModel.h). A known waveform
+ *  		is driven on ports B and F and sampled until the capture is done:
+ *  		-	The records, walked back from the last one, give the driven levels at every
+ *  			sample of the kept history, the ring having wrapped and a delta overflowed.
+ *  		-	The trigger record is the first sample matching the trigger and Dio_PostTrigger
+ *  			records follow it.
+ *  		-	Round trip: the buffer is dumped in the target layout, converted by
+ *  			DioCaptureVcd.py and the value changes of the VCD are the driven ones,
+ *  			at their times, with TRIGGER rising at the trigger sample.
+ *  		Usage: DioCaptureTest [decoder], the decoder defaults to
+ *  		Tools/DioCaptureVcd/DioCaptureVcd.py, the dump and the VCD are written in the
+ *  		working directory and removed afterwards.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioCaptureTest/DioCaptureTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioCapture.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioCaptureTest
+ *  		./DioCaptureTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioCapture.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioCaptureApi != STD_ON)
+#error "DioCaptureTest needs DioCaptureApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_CAPTURE_TEST_BUSY		4000	/*!< Samples of toggling levels before the quiet stretch */
+#define DIO_CAPTURE_TEST_QUIET		70000	/*!< Samples without change, longer than a record delta */
+#define DIO_CAPTURE_TEST_SAMPLES	(DIO_CAPTURE_TEST_BUSY + DIO_CAPTURE_TEST_QUIET + 2000)	/*!< Samples of the waveform */
+#define DIO_CAPTURE_TEST_TRIGGER	(DIO_CAPTURE_TEST_BUSY + DIO_CAPTURE_TEST_QUIET + 10)	/*!< Sample raising B2 */
+#define DIO_CAPTURE_TEST_POST		100		/*!< Records after the trigger */
+#define DIO_CAPTURE_TEST_PERIOD		1000	/*!< Sample period in ns */
+#define DIO_CAPTURE_TEST_PINS_B		0x0F	/*!< Sampled inputs of port B, image byte 0 */
+#define DIO_CAPTURE_TEST_PINS_F		0x10	/*!< Sampled input of port F (SW1), image byte 1 */
+#define DIO_CAPTURE_TEST_B2			0x04	/*!< Image bit of B2, the trigger */
+#define DIO_CAPTURE_TEST_LINE		128		/*!< Characters of a VCD line */
+#define DIO_CAPTURE_TEST_DUMP		"DioCaptureTest.bin"	/*!< Buffer dump */
+#define DIO_CAPTURE_TEST_VCD		"DioCaptureTest.vcd"	/*!< Decoded dump */
+
+/* Private Variables */
+static const Port_PinConfigType DioCaptureTest_Pins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Sampled inputs, the other pins of the ports read 0 */
+
+static const Port_ConfigType DioCaptureTest_Config = {
+	DioCaptureTest_Pins,
+	(uint8)(sizeof(DioCaptureTest_Pins) / sizeof(DioCaptureTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the inputs */
+
+static const Dio_CaptureConfigType DioCaptureTest_Capture = {
+	(uint8)((1 << DIO_PORTB) | (1 << DIO_PORTF)),
+	DIO_CAPTURE_TEST_B2,
+	DIO_CAPTURE_TEST_B2,
+	DIO_CAPTURE_TEST_POST,
+	DIO_CAPTURE_TEST_PERIOD
+};	/*!< Ports B and F, triggered by B2 high */
+
+static uint16 DioCaptureTest_Levels[DIO_CAPTURE_TEST_SAMPLES];	/*!< Driven image of every sample */
+static uint32 DioCaptureTest_Sample[DioCaptureRecords];		/*!< Sample of every record, in time order */
+static uint32 DioCaptureTest_Last;							/*!< Sample which ended the capture */
+static uint32 DioCaptureTest_Seed = 7;						/*!< State of the waveform generator */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Returns the next pseudo random number.
+ *	\param		None.
+ *	\return		uint32: 	Pseudo random number of 16 bits.
+ */
+static uint32 DioCaptureTest_Random(void);
+
+/**
+ *	\brief		Returns a record of the buffer in time order.
+ *	\param[in] 	Position: 	Position of the record, 0 is the oldest one.
+ *	\return		const Dio_CaptureRecordType*:	Pointer to the record.
+ */
+static const Dio_CaptureRecordType* DioCaptureTest_Record(uint16 Position);
+
+/**
+ *	\brief		Drives the waveform and samples it until the capture is done.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioCaptureTest_Capture1(void);
+
+/**
+ *	\brief		Checks the records against the driven waveform.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioCaptureTest_Records(void);
+
+/**
+ *	\brief		Writes the buffer as a little-endian dump of the target layout of Dio_CaptureBufferType.
+ *	\param[in] 	FileName: 	Name of the dump.
+ *	\return		boolean: 	TRUE if the dump was written.
+ */
+static boolean DioCaptureTest_WriteDump(const char* FileName);
+
+/**
+ *	\brief		Checks the value changes of the VCD against the driven waveform.
+ *	\param[in] 	FileName: 	Name of the VCD.
+ *	\return		None.
+ */
+static void DioCaptureTest_ReadVcd(const char* FileName);
+
+/**
+ *	\brief		Dumps the buffer, decodes it and checks the VCD.
+ *	\param[in] 	Decoder: 	Path of DioCaptureVcd.py.
+ *	\return		None.
+ */
+static void DioCaptureTest_RoundTrip(const char* Decoder);
+
+/**
+ *	\brief		Dio_CaptureStart() with invalid configurations.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioCaptureTest_Start(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Returns the next pseudo random number.
+ *	\param		None.
+ *	\return		uint32: 	Pseudo random number of 16 bits.
+ */
+static uint32 DioCaptureTest_Random(void)
+{
+	DioCaptureTest_Seed = (DioCaptureTest_Seed * 1103515245u + 12345u) & 0x7FFFFFFFu;
+	
+	return (DioCaptureTest_Seed >> 15) & 0xFFFF;
+}
+
+/**
+ *	\brief		Returns a record of the buffer in time order.
+ *	\param[in] 	Position: 	Position of the record, 0 is the oldest one.
+ *	\return		const Dio_CaptureRecordType*:	Pointer to the record.
+ */
+static const Dio_CaptureRecordType* DioCaptureTest_Record(uint16 Position)
+{
+	/* Needed Variables */
+	uint16 DIO_First = (Dio_CaptureBuffer.Dio_Count == Dio_CaptureBuffer.Dio_Size) ? Dio_CaptureBuffer.Dio_Next : 0;
+	
+	return &Dio_CaptureBuffer.Dio_Records[(DIO_First + Position) % Dio_CaptureBuffer.Dio_Size];
+}
+
+/**
+ *	\brief		Drives the waveform and samples it until the capture is done.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioCaptureTest_Capture1(void)
+{
+	/* Needed Variables */
+	uint32 DIO_Sample;
+	uint16 DIO_Image = 0;
+	
+	/* Toggles of B0, B1, B3 and F4 every 1 to 4 samples, quiet, then B2 rises and everything toggles */
+	for(DIO_Sample = 0; DIO_Sample < DIO_CAPTURE_TEST_SAMPLES; DIO_Sample++)
+	{
+		if((DIO_Sample < DIO_CAPTURE_TEST_BUSY) && (0 == (DioCaptureTest_Random() & 0x03)))
+		{
+			DIO_Image ^= (uint16)(DioCaptureTest_Random() & 0x100B);
+		}
+		else if(DIO_CAPTURE_TEST_TRIGGER == DIO_Sample)
+		{
+			DIO_Image |= DIO_CAPTURE_TEST_B2;
+		}
+		else if((DIO_Sample > DIO_CAPTURE_TEST_TRIGGER) && (0 == (DioCaptureTest_Random() & 0x01)))
+		{
+			DIO_Image ^= (uint16)(DioCaptureTest_Random() & 0x100F);
+		}
+		else
+		{
+			/* Levels kept */
+		}
+		DioCaptureTest_Levels[DIO_Sample] = DIO_Image;
+	}
+	
+	HW_RegsModelReset();
+	Port_Init(&DioCaptureTest_Config);
+	Test_Check((E_OK == Dio_CaptureStart(&DioCaptureTest_Capture)) ? TRUE : FALSE, "capture started");
+	for(DIO_Sample = 0; (DIO_Sample < DIO_CAPTURE_TEST_SAMPLES) && (DIO_CAPTURE_DONE != Dio_CaptureGetState()); DIO_Sample++)
+	{
+		HW_RegsModelDrivePins(DIO_PORTB, 0xFF, (uint8)DioCaptureTest_Levels[DIO_Sample]);
+		HW_RegsModelDrivePins(DIO_PORTF, DIO_CAPTURE_TEST_PINS_F, (uint8)(DioCaptureTest_Levels[DIO_Sample] >> 8));
+		Dio_CaptureSample();
+		DioCaptureTest_Last = DIO_Sample;
+	}
+	Test_Check((DIO_CAPTURE_DONE == Dio_CaptureGetState()) ? TRUE : FALSE, "capture done after the post trigger records");
+}
+
+/**
+ *	\brief		Checks the records against the driven waveform.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioCaptureTest_Records(void)
+{
+	/* Needed Variables */
+	const Dio_CaptureRecordType* DIO_RecordPtr;
+	uint32 DIO_Sample = DioCaptureTest_Last;
+	uint32 DIO_Next;
+	uint16 DIO_Position;
+	uint16 DIO_Trigger = 0;
+	boolean DIO_Levels = TRUE;
+	boolean DIO_Changes = TRUE;
+	boolean DIO_Long = FALSE;
+	
+	Test_Check(((DioCaptureRecords == Dio_CaptureBuffer.Dio_Count) && (DIO_CAPTURE_MAGIC == Dio_CaptureBuffer.Dio_Magic) &&
+				(DIO_PORTB == Dio_CaptureBuffer.Dio_Ports[0]) && (DIO_PORTF == Dio_CaptureBuffer.Dio_Ports[1]) &&
+				(DIO_CAPTURE_NO_PORT == Dio_CaptureBuffer.Dio_Ports[2])) ? TRUE : FALSE,
+			   "header describes the wrapped ring");
+	
+	/* The last record was stored by the last sample, the deltas give the samples of the older ones */
+	for(DIO_Position = Dio_CaptureBuffer.Dio_Count; DIO_Position > 0; DIO_Position--)
+	{
+		DIO_RecordPtr = DioCaptureTest_Record((uint16)(DIO_Position - 1));
+		DioCaptureTest_Sample[DIO_Position - 1] = DIO_Sample;
+		DIO_Sample -= DIO_RecordPtr->Dio_Delta;
+		DIO_Long = (0xFFFF == DIO_RecordPtr->Dio_Delta) ? TRUE : DIO_Long;
+	}
+	
+	/* Every record holds its sample, and the levels don't change until the next record */
+	for(DIO_Position = 0; DIO_Position < Dio_CaptureBuffer.Dio_Count; DIO_Position++)
+	{
+		DIO_RecordPtr = DioCaptureTest_Record(DIO_Position);
+		if(DIO_RecordPtr->Dio_Image != (uint32)((DioCaptureTest_Levels[DioCaptureTest_Sample[DIO_Position]] & DIO_CAPTURE_TEST_PINS_B) |
+												(DioCaptureTest_Levels[DioCaptureTest_Sample[DIO_Position]] & (DIO_CAPTURE_TEST_PINS_F << 8))))
+		{
+			DIO_Levels = FALSE;
+		}
+		else
+		{
+			/* Same levels */
+		}
+		DIO_Next = ((DIO_Position + 1) < Dio_CaptureBuffer.Dio_Count) ? DioCaptureTest_Sample[DIO_Position + 1] : (DioCaptureTest_Last + 1);
+		for(DIO_Sample = DioCaptureTest_Sample[DIO_Position] + 1; DIO_Sample < DIO_Next; DIO_Sample++)
+		{
+			DIO_Changes = (DioCaptureTest_Levels[DIO_Sample] == DioCaptureTest_Levels[DIO_Sample - 1]) ? DIO_Changes : FALSE;
+		}
+		if((DIO_CAPTURE_NO_TRIGGER != Dio_CaptureBuffer.Dio_Trigger) &&
+		   (DIO_RecordPtr == &Dio_CaptureBuffer.Dio_Records[Dio_CaptureBuffer.Dio_Trigger]))
+		{
+			DIO_Trigger = DIO_Position;
+		}
+		else
+		{
+			/* Not the trigger record */
+		}
+	}
+	Test_Check(DIO_Levels, "records hold the driven levels");
+	Test_Check(DIO_Changes, "no change between two records");
+	Test_Check(DIO_Long, "quiet stretch longer than a delta stored");
+	Test_Check((DIO_CAPTURE_TEST_TRIGGER == DioCaptureTest_Sample[DIO_Trigger]) ? TRUE : FALSE,
+			   "trigger record is the first matching sample");
+	Test_Check(((DIO_Trigger + DIO_CAPTURE_TEST_POST + 1) == Dio_CaptureBuffer.Dio_Count) ? TRUE : FALSE,
+			   "post trigger records follow the trigger");
+}
+
+/**
+ *	\brief		Writes the buffer as a little-endian dump of the target layout of Dio_CaptureBufferType.
+ *	\param[in] 	FileName: 	Name of the dump.
+ *	\return		boolean: 	TRUE if the dump was written.
+ */
+static boolean DioCaptureTest_WriteDump(const char* FileName)
+{
+	/* Needed Variables */
+	FILE* DIO_File = fopen(FileName, "wb");
+	uint8 DIO_Bytes[8];
+	uint16 DIO_Index;
+	boolean DIO_Written = (NULL_PTR != DIO_File) ? TRUE : FALSE;
+	
+	/* Header: magic, ports, size, count, next, trigger and period, the host types may be wider */
+	if(TRUE == DIO_Written)
+	{
+		DIO_Bytes[0] = (uint8)Dio_CaptureBuffer.Dio_Magic;
+		DIO_Bytes[1] = (uint8)(Dio_CaptureBuffer.Dio_Magic >> 8);
+		DIO_Bytes[2] = (uint8)(Dio_CaptureBuffer.Dio_Magic >> 16);
+		DIO_Bytes[3] = (uint8)(Dio_CaptureBuffer.Dio_Magic >> 24);
+		(void)fwrite(DIO_Bytes, 1, 4, DIO_File);
+		(void)fwrite(Dio_CaptureBuffer.Dio_Ports, 1, DIO_CAPTURE_MAX_PORTS, DIO_File);
+		DIO_Bytes[0] = (uint8)Dio_CaptureBuffer.Dio_Size;
+		DIO_Bytes[1] = (uint8)(Dio_CaptureBuffer.Dio_Size >> 8);
+		DIO_Bytes[2] = (uint8)Dio_CaptureBuffer.Dio_Count;
+		DIO_Bytes[3] = (uint8)(Dio_CaptureBuffer.Dio_Count >> 8);
+		DIO_Bytes[4] = (uint8)Dio_CaptureBuffer.Dio_Next;
+		DIO_Bytes[5] = (uint8)(Dio_CaptureBuffer.Dio_Next >> 8);
+		DIO_Bytes[6] = (uint8)Dio_CaptureBuffer.Dio_Trigger;
+		DIO_Bytes[7] = (uint8)(Dio_CaptureBuffer.Dio_Trigger >> 8);
+		(void)fwrite(DIO_Bytes, 1, 8, DIO_File);
+		DIO_Bytes[0] = (uint8)Dio_CaptureBuffer.Dio_SamplePeriodNs;
+		DIO_Bytes[1] = (uint8)(Dio_CaptureBuffer.Dio_SamplePeriodNs >> 8);
+		DIO_Bytes[2] = (uint8)(Dio_CaptureBuffer.Dio_SamplePeriodNs >> 16);
+		DIO_Bytes[3] = (uint8)(Dio_CaptureBuffer.Dio_SamplePeriodNs >> 24);
+		(void)fwrite(DIO_Bytes, 1, 4, DIO_File);
+	
+		/* Records: image, delta and 2 bytes of padding */
+		for(DIO_Index = 0; DIO_Index < Dio_CaptureBuffer.Dio_Size; DIO_Index++)
+		{
+			DIO_Bytes[0] = (uint8)Dio_CaptureBuffer.Dio_Records[DIO_Index].Dio_Image;
+			DIO_Bytes[1] = (uint8)(Dio_CaptureBuffer.Dio_Records[DIO_Index].Dio_Image >> 8);
+			DIO_Bytes[2] = (uint8)(Dio_CaptureBuffer.Dio_Records[DIO_Index].Dio_Image >> 16);
+			DIO_Bytes[3] = (uint8)(Dio_CaptureBuffer.Dio_Records[DIO_Index].Dio_Image >> 24);
+			DIO_Bytes[4] = (uint8)Dio_CaptureBuffer.Dio_Records[DIO_Index].Dio_Delta;
+			DIO_Bytes[5] = (uint8)(Dio_CaptureBuffer.Dio_Records[DIO_Index].Dio_Delta >> 8);
+			DIO_Bytes[6] = 0;
+			DIO_Bytes[7] = 0;
+			(void)fwrite(DIO_Bytes, 1, 8, DIO_File);
+		}
+		DIO_Written = (0 == fclose(DIO_File)) ? TRUE : FALSE;
+	}
+	else
+	{
+		/* File not created */
+	}
+	
+	return DIO_Written;
+}
+
+/**
+ *	\brief		Checks the value changes of the VCD against the driven waveform.
+ *	\param[in] 	FileName: 	Name of the VCD.
+ *	\return		None.
+ */
+static void DioCaptureTest_ReadVcd(const char* FileName)
+{
+	/* Needed Variables */
+	FILE* DIO_File = fopen(FileName, "r");
+	char DIO_Line[DIO_CAPTURE_TEST_LINE];
+	char DIO_Id[DIO_CAPTURE_TEST_LINE];
+	char DIO_Name[DIO_CAPTURE_TEST_LINE];
+	char DIO_Ids[17][8];			/* VCD identifiers of the 16 pin wires, then TRIGGER */
+	uint16 DIO_Bits[17];			/* Image bit of every wire, 0 for TRIGGER */
+	uint8 DIO_NoOfWires = 0;
+	uint16 DIO_Image = 0;
+	uint32 DIO_Time = 0;
+	uint32 DIO_TriggerTime = 0xFFFFFFFFu;
+	uint32 DIO_Sample = DioCaptureTest_Sample[0];
+	uint32 DIO_Times = 0;
+	boolean DIO_Pending = FALSE;
+	boolean DIO_Match = (NULL_PTR != DIO_File) ? TRUE : FALSE;
+	uint8 DIO_Wire;
+	
+	while((TRUE == DIO_Match) && (NULL_PTR != fgets(DIO_Line, sizeof(DIO_Line), DIO_File)))
+	{
+		if((2 == sscanf(DIO_Line, "$var wire 1 %7s %127s", DIO_Id, DIO_Name)) && (DIO_NoOfWires < 17))
+		{
+			/* PB0 .. PB7 are image bits 0 .. 7, PF0 .. PF7 bits 8 .. 15 */
+			(void)strcpy(DIO_Ids[DIO_NoOfWires], DIO_Id);
+			DIO_Bits[DIO_NoOfWires] = (('P' == DIO_Name[0]) ? (uint16)(1 << (((('F' == DIO_Name[1]) ? 8 : 0)) + (DIO_Name[2] - '0'))) : 0);
+			DIO_NoOfWires++;
+		}
+		else if('#' == DIO_Line[0])
+		{
+			/* The levels at the previous time are complete, they match the driven ones since the previous change */
+			if(TRUE == DIO_Pending)
+			{
+				DIO_Match = (DIO_Image == (DioCaptureTest_Levels[DIO_Sample] & (DIO_CAPTURE_TEST_PINS_B | (DIO_CAPTURE_TEST_PINS_F << 8)))) ? TRUE : FALSE;
+				DIO_Times++;
+			}
+			else
+			{
+				/* First time */
+			}
+			DIO_Time = (uint32)strtoul(&DIO_Line[1], NULL_PTR, 10);
+			DIO_Sample = DioCaptureTest_Sample[0] + (DIO_Time / DIO_CAPTURE_TEST_PERIOD);
+			DIO_Pending = TRUE;
+		}
+		else if(('0' == DIO_Line[0]) || ('1' == DIO_Line[0]))
+		{
+			DIO_Line[strcspn(DIO_Line, "\r\n")] = '\0';
+			for(DIO_Wire = 0; DIO_Wire < DIO_NoOfWires; DIO_Wire++)
+			{
+				if(0 == strcmp(&DIO_Line[1], DIO_Ids[DIO_Wire]))
+				{
+					if(0 == DIO_Bits[DIO_Wire])
+					{
+						DIO_TriggerTime = ('1' == DIO_Line[0]) ? DIO_Time : DIO_TriggerTime;
+					}
+					else
+					{
+						DIO_Image = (uint16)(('1' == DIO_Line[0]) ? (DIO_Image | DIO_Bits[DIO_Wire]) : (DIO_Image & ~DIO_Bits[DIO_Wire]));
+					}
+				}
+				else
+				{
+					/* Another wire */
+				}
+			}
+		}
+		else
+		{
+			/* Declarations and $dumpvars */
+		}
+	}
+	if(TRUE == DIO_Pending)
+	{
+		DIO_Match = ((TRUE == DIO_Match) &&
+					 (DIO_Image == (DioCaptureTest_Levels[DIO_Sample] & (DIO_CAPTURE_TEST_PINS_B | (DIO_CAPTURE_TEST_PINS_F << 8))))) ? TRUE : FALSE;
+		DIO_Times++;
+	}
+	else
+	{
+		DIO_Match = FALSE;
+	}
+	if(NULL_PTR != DIO_File)
+	{
+		(void)fclose(DIO_File);
+	}
+	else
+	{
+		/* Nothing to close */
+	}
+	
+	/* A time per change of the sampled pins, the first sample and the trigger being changes too */
+	for(DIO_Sample = DioCaptureTest_Sample[0] + 1; DIO_Sample <= DioCaptureTest_Last; DIO_Sample++)
+	{
+		DIO_Times -= ((DioCaptureTest_Levels[DIO_Sample] != DioCaptureTest_Levels[DIO_Sample - 1]) ? 1 : 0);
+	}
+	Test_Check(((17 == DIO_NoOfWires) && (TRUE == DIO_Match)) ? TRUE : FALSE, "VCD levels are the driven ones");
+	Test_Check((1 == DIO_Times) ? TRUE : FALSE, "VCD has a time per change");
+	Test_Check((((DIO_CAPTURE_TEST_TRIGGER - DioCaptureTest_Sample[0]) * DIO_CAPTURE_TEST_PERIOD) == DIO_TriggerTime) ? TRUE : FALSE,
+			   "VCD trigger at the trigger sample");
+}
+
+/**
+ *	\brief		Dumps the buffer, decodes it and checks the VCD.
+ *	\param[in] 	Decoder: 	Path of DioCaptureVcd.py.
+ *	\return		None.
+ */
+static void DioCaptureTest_RoundTrip(const char* Decoder)
+{
+	/* Needed Variables */
+	char DIO_Command[256];
+	boolean DIO_Decoded = FALSE;
+	
+	if(TRUE == DioCaptureTest_WriteDump(DIO_CAPTURE_TEST_DUMP))
+	{
+		(void)snprintf(DIO_Command, sizeof(DIO_Command), "python3 \"%s\" %s %s", Decoder, DIO_CAPTURE_TEST_DUMP, DIO_CAPTURE_TEST_VCD);
+		DIO_Decoded = (0 == system(DIO_Command)) ? TRUE : FALSE;
+	}
+	else
+	{
+		/* No dump to decode */
+	}
+	Test_Check(DIO_Decoded, "dump decoded by DioCaptureVcd.py");
+	if(TRUE == DIO_Decoded)
+	{
+		DioCaptureTest_ReadVcd(DIO_CAPTURE_TEST_VCD);
+	}
+	else
+	{
+		/* No VCD to check */
+	}
+	(void)remove(DIO_CAPTURE_TEST_DUMP);
+	(void)remove(DIO_CAPTURE_TEST_VCD);
+}
+
+/**
+ *	\brief		Dio_CaptureStart() with invalid configurations.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioCaptureTest_Start(void)
+{
+	/* Needed Variables */
+	Dio_CaptureConfigType DIO_Config = DioCaptureTest_Capture;
+	
+	Test_Check((E_NOT_OK == Dio_CaptureStart(NULL_PTR)) ? TRUE : FALSE, "NULL configuration rejected");
+	DIO_Config.Dio_PortsMask = 0;
+	Test_Check((E_NOT_OK == Dio_CaptureStart(&DIO_Config)) ? TRUE : FALSE, "no port rejected");
+	DIO_Config.Dio_PortsMask = 0x1F;
+	Test_Check((E_NOT_OK == Dio_CaptureStart(&DIO_Config)) ? TRUE : FALSE, "5 ports rejected");
+	DIO_Config.Dio_PortsMask = 0x41;
+	Test_Check((E_NOT_OK == Dio_CaptureStart(&DIO_Config)) ? TRUE : FALSE, "missing port rejected");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param[in] 	argc: 	Number of arguments.
+ *	\param[in] 	argv: 	Arguments, the optional path of the decoder.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(int argc, char* argv[])
+{
+	DioCaptureTest_Capture1();
+	DioCaptureTest_Records();
+	DioCaptureTest_RoundTrip((argc > 1) ? argv[1] : "Tools/DioCaptureVcd/DioCaptureVcd.py");
+	DioCaptureTest_Start();
+	
+	return Test_Summary();
+}
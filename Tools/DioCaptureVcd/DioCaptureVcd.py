@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+ \\file		DioCaptureVcd.py
+ \\brief		Decoder of the DIO capture buffer (IO/DIO/DioCapture.h).
+ 			Converts a memory dump of Dio_CaptureBuffer into a VCD file that any
+ 			waveform viewer (GTKWave, PulseView ...) opens, with a wire per pin of
+ 			the sampled ports and a TRIGGER wire rising at the trigger record.
+ 			The time of the oldest record in the ring is 0.
+
+ Usage:		DioCaptureVcd.py <buffer dump> [output VCD]
+
+ Buffer dump:	Raw little-endian memory of Dio_CaptureBuffer, e.g. from gdb:
+ 			dump binary value capture.bin Dio_CaptureBuffer
+
+ \\author	Ahmed Wageh.
+"""
+
+import struct
+import sys
+
+# Layout of Dio_CaptureBufferType (DioCapture.h)
+MAGIC = 0x50414344
+HEADER = struct.Struct("<I4sHHHHI")
+RECORD = struct.Struct("<IHxx")
+NO_PORT = 0xFF
+NO_TRIGGER = 0xFFFF
+PORTS = "ABCDEF"
+
+
+class DecodeError(Exception):
+    """A buffer dump that can't be decoded."""
+
+
+def parse(dump):
+    """Returns (port IDs, sample period in ns, records in time order, index of the trigger record or None)."""
+    if len(dump) < HEADER.size:
+        raise DecodeError("dump is shorter than the buffer header")
+    magic, ports, size, count, next_index, trigger, period = HEADER.unpack_from(dump)
+    if magic != MAGIC:
+        raise DecodeError("bad magic 0x%08X, not a Dio_CaptureBuffer dump" % magic)
+    if count > size or next_index >= max(size, 1) or len(dump) < HEADER.size + size * RECORD.size:
+        raise DecodeError("inconsistent header (size %d, count %d, next %d) or truncated dump"
+                          % (size, count, next_index))
+    ports = [port for port in ports if port != NO_PORT]
+    first = next_index if count == size else 0
+    records = []
+    trigger_position = None
+    for position in range(count):
+        index = (first + position) % size
+        records.append(RECORD.unpack_from(dump, HEADER.size + index * RECORD.size))
+        if index == trigger:
+            trigger_position = position
+    return ports, period, records, trigger_position
+
+
+def identifier(number):
+    """Returns the VCD identifier of a wire."""
+    text = ""
+    number += 1
+    while number:
+        number, digit = divmod(number - 1, 94)
+        text += chr(33 + digit)
+    return text
+
+
+def write_vcd(out, source, ports, period, records, trigger):
+    wires = [(index, pin, "P%s%d" % (PORTS[port], pin)) for index, port in enumerate(ports) for pin in range(8)]
+    trigger_id = identifier(len(wires))
+    out.write("$comment Generated by DioCaptureVcd.py from %s $end\n" % source)
+    out.write("$timescale 1 ns $end\n")
+    out.write("$scope module dio $end\n")
+    for number, (_, _, name) in enumerate(wires):
+        out.write("$var wire 1 %s %s $end\n" % (identifier(number), name))
+    out.write("$var wire 1 %s TRIGGER $end\n" % trigger_id)
+    out.write("$upscope $end\n$enddefinitions $end\n")
+
+    time = 0
+    previous = None
+    for position, (image, delta) in enumerate(records):
+        if position:
+            time += delta * max(period, 1)
+        changes = []
+        for number, (index, pin, _) in enumerate(wires):
+            bit = (image >> (8 * index + pin)) & 1
+            if previous is None or bit != (previous >> (8 * index + pin)) & 1:
+                changes.append("%d%s" % (bit, identifier(number)))
+        if previous is None:
+            changes.append("0%s" % trigger_id)
+        if position == trigger:
+            changes.append("1%s" % trigger_id)
+        if changes:
+            out.write("#%d\n" % time)
+            if previous is None:
+                out.write("$dumpvars\n%s\n$end\n" % "\n".join(changes))
+            else:
+                out.write("\n".join(changes) + "\n")
+        previous = image
+    return time
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        sys.stderr.write("usage: %s <buffer dump> [output VCD]\n" % argv[0])
+        return 2
+    try:
+        ports, period, records, trigger = parse(open(argv[1], "rb").read())
+    except DecodeError as error:
+        sys.stderr.write("%s: %s\n" % (argv[1], error))
+        return 1
+    out = open(argv[2], "w") if len(argv) == 3 else sys.stdout
+    duration = write_vcd(out, argv[1], ports, period, records, trigger)
+    samples = 1 + sum(delta for _, delta in records[1:])
+    sys.stderr.write("%d records, %d samples of %d port(s) over %d ns, compression %.1f:1%s\n"
+                     % (len(records), samples, len(ports), duration,
+                        (samples * len(ports)) / float(max(len(records), 1) * RECORD.size),
+                        "" if trigger is None else ", trigger at record %d" % trigger))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
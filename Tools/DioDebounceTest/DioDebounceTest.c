@@ -0,0 +1,311 @@
+/**
+ *  \file	DioDebounceTest.c
+ *  \brief 	Host functional test of the DIO debounce (DioDebounce.h) on the register model
+ *  		(TivaRegsModel.h): noisy levels are driven on 10 inputs of ports B and E with
+ *  		thresholds of 1 to 2^DioDebounceCounterBits - 1 ticks, and after every tick the
+ *  		bit-sliced counters have to give the stable levels and changes of a reference
+ *  		debounce counting every channel on its own. Dio_DebounceInit() has to reject
+ *  		thresholds out of range and channels which don't exist.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioDebounceTest/DioDebounceTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioDebounce.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioDebounceTest
+ *  		./DioDebounceTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioDebounce.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioDebounceApi != STD_ON)
+#error "DioDebounceTest needs DioDebounceApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_DEBOUNCE_TEST_TICKS		20000	/*!< Debounce ticks of the noisy run */
+#define DIO_DEBOUNCE_TEST_MAX		((1 << DioDebounceCounterBits) - 1)	/*!< Largest threshold */
+
+/* Private Variables */
+static const Port_PinConfigType DioDebounceTest_Pins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B5, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E1, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Debounced inputs, pulled up */
+
+static const Port_ConfigType DioDebounceTest_Config = {
+	DioDebounceTest_Pins,
+	(uint8)(sizeof(DioDebounceTest_Pins) / sizeof(DioDebounceTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the inputs */
+
+static const Dio_DebounceChannelType DioDebounceTest_Channels[] = {
+	{DIO_CHANNEL_B0, 1},
+	{DIO_CHANNEL_B1, 2},
+	{DIO_CHANNEL_B2, 3},
+	{DIO_CHANNEL_B3, 4},
+	{DIO_CHANNEL_B4, 5},
+	{DIO_CHANNEL_B5, 6},
+	{DIO_CHANNEL_B6, DIO_DEBOUNCE_TEST_MAX},
+	{DIO_CHANNEL_B7, 3},
+	{DIO_CHANNEL_E0, 2},
+	{DIO_CHANNEL_E1, DIO_DEBOUNCE_TEST_MAX}
+};	/*!< Every threshold on port B, two on port E */
+
+#define DIO_DEBOUNCE_TEST_CHANNELS	(sizeof(DioDebounceTest_Channels) / sizeof(DioDebounceTest_Channels[0]))	/*!< Number of debounced channels */
+
+static const Dio_DebounceConfigType DioDebounceTest_DebounceConfig = {
+	DioDebounceTest_Channels, (uint8)DIO_DEBOUNCE_TEST_CHANNELS
+};	/*!< Debounce configuration */
+
+static Dio_LevelType DioDebounceTest_Stable[DIO_DEBOUNCE_TEST_CHANNELS];	/*!< Reference stable levels */
+static uint8 DioDebounceTest_Count[DIO_DEBOUNCE_TEST_CHANNELS];			/*!< Reference counters */
+static uint32 DioDebounceTest_Seed = 1;	/*!< State of the noise generator */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Returns the next pseudo random number.
+ *	\param		None.
+ *	\return		uint32: 	Pseudo random number of 16 bits.
+ */
+static uint32 DioDebounceTest_Random(void);
+
+/**
+ *	\brief		Reference debounce tick of a channel: a level differing from the stable one
+ *				for threshold consecutive ticks becomes the stable level.
+ *	\param[in] 	Index: 		Index of the channel in DioDebounceTest_Channels.
+ *	\param[in] 	Sample: 	Sampled level of the channel.
+ *	\return		boolean: 	TRUE if the stable level changed.
+ */
+static boolean DioDebounceTest_Reference(uint8 Index, Dio_LevelType Sample);
+
+/**
+ *	\brief		Noisy levels against the reference debounce.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioDebounceTest_Noise(void);
+
+/**
+ *	\brief		Dio_DebounceInit() with invalid configurations.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioDebounceTest_Init(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Returns the next pseudo random number.
+ *	\param		None.
+ *	\return		uint32: 	Pseudo random number of 16 bits.
+ */
+static uint32 DioDebounceTest_Random(void)
+{
+	DioDebounceTest_Seed = (DioDebounceTest_Seed * 1103515245u + 12345u) & 0x7FFFFFFFu;
+	
+	return (DioDebounceTest_Seed >> 15) & 0xFFFF;
+}
+
+/**
+ *	\brief		Reference debounce tick of a channel: a level differing from the stable one
+ *				for threshold consecutive ticks becomes the stable level.
+ *	\param[in] 	Index: 		Index of the channel in DioDebounceTest_Channels.
+ *	\param[in] 	Sample: 	Sampled level of the channel.
+ *	\return		boolean: 	TRUE if the stable level changed.
+ */
+static boolean DioDebounceTest_Reference(uint8 Index, Dio_LevelType Sample)
+{
+	/* Needed Variables */
+	boolean DIO_Changed = FALSE;
+	
+	if(Sample == DioDebounceTest_Stable[Index])
+	{
+		DioDebounceTest_Count[Index] = 0;
+	}
+	else
+	{
+		DioDebounceTest_Count[Index]++;
+		if(DioDebounceTest_Count[Index] == DioDebounceTest_Channels[Index].Dio_Threshold)
+		{
+			DioDebounceTest_Stable[Index] = Sample;
+			DioDebounceTest_Count[Index] = 0;
+			DIO_Changed = TRUE;
+		}
+		else
+		{
+			/* Not stable yet */
+		}
+	}
+	
+	return DIO_Changed;
+}
+
+/**
+ *	\brief		Noisy levels against the reference debounce.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioDebounceTest_Noise(void)
+{
+	/* Needed Variables */
+	Dio_PortLevelType DIO_Stable[HW_NO_OF_PORTS];
+	Dio_PortLevelType DIO_Changed[HW_NO_OF_PORTS];
+	Dio_PortLevelType DIO_RefStable[HW_NO_OF_PORTS];
+	Dio_PortLevelType DIO_RefChanged[HW_NO_OF_PORTS];
+	Dio_PortLevelType DIO_Levels[HW_NO_OF_PORTS] = {0};
+	Dio_ChannelType DIO_Channel;
+	uint32 DIO_Tick;
+	uint32 DIO_Changes = 0;
+	uint8 DIO_Port;
+	uint8 DIO_Index;
+	boolean DIO_Match = TRUE;
+	boolean DIO_ChannelMatch = TRUE;
+	
+	HW_RegsModelReset();
+	Port_Init(&DioDebounceTest_Config);
+	
+	/* Inputs start low, the levels at the init are stable */
+	HW_RegsModelDrivePins(DIO_PORTB, 0xFF, 0x00);
+	HW_RegsModelDrivePins(DIO_PORTE, 0x03, 0x00);
+	Test_Check((E_OK == Dio_DebounceInit(&DioDebounceTest_DebounceConfig)) ? TRUE : FALSE, "init accepts the configuration");
+	for(DIO_Index = 0; DIO_Index < DIO_DEBOUNCE_TEST_CHANNELS; DIO_Index++)
+	{
+		DioDebounceTest_Stable[DIO_Index] = STD_LOW;
+		DioDebounceTest_Count[DIO_Index] = 0;
+	}
+	
+	for(DIO_Tick = 0; (DIO_Tick < DIO_DEBOUNCE_TEST_TICKS) && (TRUE == DIO_Match); DIO_Tick++)
+	{
+		/* Every channel toggles with a probability varying along the run, from bouncing to steady */
+		for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+		{
+			DIO_RefStable[DIO_Port] = 0;
+			DIO_RefChanged[DIO_Port] = 0;
+		}
+		for(DIO_Index = 0; DIO_Index < DIO_DEBOUNCE_TEST_CHANNELS; DIO_Index++)
+		{
+			DIO_Channel = DioDebounceTest_Channels[DIO_Index].Dio_ChannelId;
+			DIO_Port = (uint8)(DIO_Channel >> 4);
+			if((DioDebounceTest_Random() & 0x3FF) < (((DIO_Tick >> 9) & 0x07) * 64))
+			{
+				DIO_Levels[DIO_Port] ^= (Dio_PortLevelType)(1 << (DIO_Channel & 0x07));
+			}
+			else
+			{
+				/* Level kept */
+			}
+		}
+		HW_RegsModelDrivePins(DIO_PORTB, 0xFF, (uint8)DIO_Levels[DIO_PORTB]);
+		HW_RegsModelDrivePins(DIO_PORTE, 0x03, (uint8)DIO_Levels[DIO_PORTE]);
+	
+		Dio_DebounceMainFunction();
+		for(DIO_Index = 0; DIO_Index < DIO_DEBOUNCE_TEST_CHANNELS; DIO_Index++)
+		{
+			DIO_Channel = DioDebounceTest_Channels[DIO_Index].Dio_ChannelId;
+			DIO_Port = (uint8)(DIO_Channel >> 4);
+			if(TRUE == DioDebounceTest_Reference(DIO_Index, (0 != (DIO_Levels[DIO_Port] & (1 << (DIO_Channel & 0x07)))) ? STD_HIGH : STD_LOW))
+			{
+				DIO_RefChanged[DIO_Port] |= (Dio_PortLevelType)(1 << (DIO_Channel & 0x07));
+				DIO_Changes++;
+			}
+			else
+			{
+				/* Stable level kept */
+			}
+			if(STD_HIGH == DioDebounceTest_Stable[DIO_Index])
+			{
+				DIO_RefStable[DIO_Port] |= (Dio_PortLevelType)(1 << (DIO_Channel & 0x07));
+			}
+			else
+			{
+				/* Low */
+			}
+			if(DioDebounceTest_Stable[DIO_Index] != Dio_DebounceGetChannel(DIO_Channel))
+			{
+				DIO_ChannelMatch = FALSE;
+			}
+			else
+			{
+				/* Same level */
+			}
+		}
+	
+		/* The changes are read at every tick, so they are the changes of this tick */
+		Dio_DebounceGetImage(DIO_Stable, DIO_Changed);
+		for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+		{
+			if((DIO_Stable[DIO_Port] != DIO_RefStable[DIO_Port]) || (DIO_Changed[DIO_Port] != DIO_RefChanged[DIO_Port]))
+			{
+				printf("tick %lu port %u: stable 0x%02X changed 0x%02X, reference 0x%02X 0x%02X\n", (unsigned long)DIO_Tick,
+					   DIO_Port, DIO_Stable[DIO_Port], DIO_Changed[DIO_Port], DIO_RefStable[DIO_Port], DIO_RefChanged[DIO_Port]);
+				DIO_Match = FALSE;
+			}
+			else
+			{
+				/* Same image */
+			}
+		}
+	}
+	
+	Test_Check(DIO_Match, "images match the reference debounce");
+	Test_Check(DIO_ChannelMatch, "channels match the reference debounce");
+	Test_Check((DIO_Changes > (DIO_DEBOUNCE_TEST_TICKS / 100)) ? TRUE : FALSE, "the noise changes the stable levels");
+}
+
+/**
+ *	\brief		Dio_DebounceInit() with invalid configurations.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioDebounceTest_Init(void)
+{
+	/* Needed Variables */
+	Dio_DebounceChannelType DIO_Channels[2] = {{DIO_CHANNEL_B0, 1}, {DIO_CHANNEL_B1, 1}};
+	const Dio_DebounceConfigType DIO_Config = {DIO_Channels, 2};
+	
+	HW_RegsModelReset();
+	Port_Init(&DioDebounceTest_Config);
+	HW_RegsModelDrivePins(DIO_PORTB, 0xFF, 0x00);
+	Test_Check((E_OK == Dio_DebounceInit(&DIO_Config)) ? TRUE : FALSE, "threshold 1 accepted");
+	
+	Test_Check((E_NOT_OK == Dio_DebounceInit(NULL_PTR)) ? TRUE : FALSE, "NULL configuration rejected");
+	
+	DIO_Channels[1].Dio_Threshold = 0;
+	Test_Check((E_NOT_OK == Dio_DebounceInit(&DIO_Config)) ? TRUE : FALSE, "threshold 0 rejected");
+	
+	DIO_Channels[1].Dio_Threshold = DIO_DEBOUNCE_TEST_MAX + 1;
+	Test_Check((E_NOT_OK == Dio_DebounceInit(&DIO_Config)) ? TRUE : FALSE, "threshold past the counters rejected");
+	
+	DIO_Channels[1].Dio_Threshold = 1;
+	DIO_Channels[1].Dio_ChannelId = (Dio_ChannelType)0x18;
+	Test_Check((E_NOT_OK == Dio_DebounceInit(&DIO_Config)) ? TRUE : FALSE, "missing channel rejected");
+	
+	/* A rejected configuration stops the debouncing of the valid one, B0 included */
+	HW_RegsModelDrivePins(DIO_PORTB, 0xFF, 0x01);
+	Dio_DebounceMainFunction();
+	Test_Check((STD_LOW == Dio_DebounceGetChannel(DIO_CHANNEL_B0)) ? TRUE : FALSE, "rejected configuration debounces nothing");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	DioDebounceTest_Noise();
+	DioDebounceTest_Init();
+	
+	return Test_Summary();
+}
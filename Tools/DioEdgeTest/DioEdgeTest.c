@@ -0,0 +1,416 @@
+/**
+ *  \file	DioEdgeTest.c
+ *  \brief 	Host functional test of the DIO edge notifications (DioEdge.h) on the register
+ *  		model (TivaRegsModel.h), the port interrupt handlers are called by the test:
+ *  		-	Pending channels are dispatched highest pin first, once each, with their channel ID.
+ *  		-	Rising, falling, both edges and high level senses of the PORT configuration.
+ *  		-	A masked channel isn't dispatched and an edge latched before its enabling is discarded.
+ *  		-	An edge during a notification interrupts again, a level stays pending until removed.
+ *  		-	A pending channel without notification, unmasked outside DioEdge or removed by a
+ *  			notification of the same dispatch, is acknowledged and skipped.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioEdgeTest/DioEdgeTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioEdge.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioEdgeTest
+ *  		./DioEdgeTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioEdge.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioEdgeApi != STD_ON)
+#error "DioEdgeTest needs DioEdgeApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_EDGE_TEST_LOG	16	/*!< Notifications recorded */
+
+/* GPIOMIS of a port through the aperture used by the drivers */
+#define DIO_EDGE_TEST_MIS(PORT_ID)	HW_R_8RIG(HW_PortsAddresses[PORT_ID] + HW_GPIOMIS_OFFSET)
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static const Port_PinConfigType DioEdgeTest_Pins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_HIGH},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_RISING},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_FALLING},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_BOTH},
+	{PORT_PIN_F4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_RISING}
+};	/*!< Inputs of every sense on port B and SW1 */
+
+static const Port_ConfigType DioEdgeTest_Config = {
+	DioEdgeTest_Pins,
+	(uint8)(sizeof(DioEdgeTest_Pins) / sizeof(DioEdgeTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the inputs */
+
+static Dio_ChannelType DioEdgeTest_Log[DIO_EDGE_TEST_LOG];	/*!< Notified channels, in calling order */
+static uint8 DioEdgeTest_Logged = 0;						/*!< Number of notifications */
+static uint8 DioEdgeTest_Levels = 0;						/*!< Levels driven on port B */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Checks the notifications since the previous check, then clears them.
+ *	\param[in] 	Expected: 	Channels expected, in calling order.
+ *	\param[in] 	Count: 		Number of expected channels.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void DioEdgeTest_CheckLog(const Dio_ChannelType* Expected, uint8 Count, const char* Name);
+
+/**
+ *	\brief		Drives some pins of port B, keeping the levels driven on the others.
+ *	\param[in] 	Mask: 		Pins changed.
+ *	\param[in] 	Levels: 	Levels of the changed pins.
+ *	\return		None.
+ */
+static void DioEdgeTest_Drive(uint8 Mask, uint8 Levels);
+
+/**
+ *	\brief		Notification recording its channel.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_Record(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Notification recording its channel and raising an edge on B0.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_RecordAndEdge(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Notification recording its channel and removing the level of B2.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_RecordAndRelease(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Notification recording its channel and removing the notification of B3.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_RecordAndRemove(Dio_ChannelType ChannelId);
+
+/**
+ *	\brief		Resets the model, initializes the pins and registers the notifications.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Setup(void);
+
+/**
+ *	\brief		Dispatch order and senses.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Dispatch(void);
+
+/**
+ *	\brief		Masked channels and notifications enabled after an edge.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Mask(void);
+
+/**
+ *	\brief		Edges during a notification and level interrupts.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Pending(void);
+
+/**
+ *	\brief		Pending channels without notification.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Missing(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Checks the notifications since the previous check, then clears them.
+ *	\param[in] 	Expected: 	Channels expected, in calling order.
+ *	\param[in] 	Count: 		Number of expected channels.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void DioEdgeTest_CheckLog(const Dio_ChannelType* Expected, uint8 Count, const char* Name)
+{
+	/* Needed Variables */
+	boolean DIO_Passed = (Count == DioEdgeTest_Logged) ? TRUE : FALSE;
+	uint8 DIO_Index;
+	
+	for(DIO_Index = 0; (DIO_Index < Count) && (TRUE == DIO_Passed); DIO_Index++)
+	{
+		DIO_Passed = (Expected[DIO_Index] == DioEdgeTest_Log[DIO_Index]) ? TRUE : FALSE;
+	}
+	Test_Check(DIO_Passed, Name);
+	DioEdgeTest_Logged = 0;
+}
+
+/**
+ *	\brief		Drives some pins of port B, keeping the levels driven on the others.
+ *	\param[in] 	Mask: 		Pins changed.
+ *	\param[in] 	Levels: 	Levels of the changed pins.
+ *	\return		None.
+ */
+static void DioEdgeTest_Drive(uint8 Mask, uint8 Levels)
+{
+	DioEdgeTest_Levels = (uint8)((DioEdgeTest_Levels & ~Mask) | (Levels & Mask));
+	HW_RegsModelDrivePins(DIO_PORTB, 0xFF, DioEdgeTest_Levels);
+}
+
+/**
+ *	\brief		Notification recording its channel.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_Record(Dio_ChannelType ChannelId)
+{
+	if(DioEdgeTest_Logged < DIO_EDGE_TEST_LOG)
+	{
+		DioEdgeTest_Log[DioEdgeTest_Logged] = ChannelId;
+		DioEdgeTest_Logged++;
+	}
+	else
+	{
+		/* Log full, the count check fails */
+	}
+}
+
+/**
+ *	\brief		Notification recording its channel and raising an edge on B0.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_RecordAndEdge(Dio_ChannelType ChannelId)
+{
+	DioEdgeTest_Record(ChannelId);
+	DioEdgeTest_Drive(0x01, (uint8)~DioEdgeTest_Levels);
+}
+
+/**
+ *	\brief		Notification recording its channel and removing the level of B2.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_RecordAndRelease(Dio_ChannelType ChannelId)
+{
+	DioEdgeTest_Record(ChannelId);
+	DioEdgeTest_Drive(0x04, 0x00);
+}
+
+/**
+ *	\brief		Notification recording its channel and removing the notification of B3.
+ *	\param[in] 	ChannelId: 	Notified channel.
+ *	\return		None.
+ */
+static void DioEdgeTest_RecordAndRemove(Dio_ChannelType ChannelId)
+{
+	DioEdgeTest_Record(ChannelId);
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B3, NULL_PTR);
+}
+
+/**
+ *	\brief		Resets the model, initializes the pins and registers the notifications.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Setup(void)
+{
+	/* Needed Variables */
+	static const Dio_ChannelType DIO_Channels[] = {
+		DIO_CHANNEL_B0, DIO_CHANNEL_B1, DIO_CHANNEL_B3, DIO_CHANNEL_B4, DIO_CHANNEL_B6, DIO_CHANNEL_B7, DIO_CHANNEL_F4
+	};
+	uint8 DIO_Index;
+	
+	/* Inputs start low, B2 is level sensitive and is raised by the tests */
+	HW_RegsModelReset();
+	DioEdgeTest_Levels = 0;
+	DioEdgeTest_Drive(0xFF, 0x00);
+	HW_RegsModelDrivePins(DIO_PORTF, 0x10, 0x00);
+	Port_Init(&DioEdgeTest_Config);
+	for(DIO_Index = 0; DIO_Index < (uint8)(sizeof(DIO_Channels) / sizeof(DIO_Channels[0])); DIO_Index++)
+	{
+		(void)Dio_EdgeSetNotification(DIO_Channels[DIO_Index], DioEdgeTest_Record);
+		(void)Dio_EdgeEnableNotification(DIO_Channels[DIO_Index]);
+	}
+	DioEdgeTest_Logged = 0;
+}
+
+/**
+ *	\brief		Dispatch order and senses.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Dispatch(void)
+{
+	/* Needed Variables */
+	static const Dio_ChannelType DIO_Order[] = {DIO_CHANNEL_B7, DIO_CHANNEL_B3, DIO_CHANNEL_B0};
+	static const Dio_ChannelType DIO_Rising[] = {DIO_CHANNEL_B4};
+	static const Dio_ChannelType DIO_Falling[] = {DIO_CHANNEL_B6};
+	static const Dio_ChannelType DIO_PortF[] = {DIO_CHANNEL_F4};
+	
+	DioEdgeTest_Setup();
+	Test_Check((0 != (HW_R_8RIG(HW_NVIC_EN0_ADDRESS) & ((uint32)1 << HW_GPIOF_IRQ))) ? TRUE : FALSE,
+			   "enabling a notification enables the port interrupt");
+	
+	/* Three edges latched together */
+	DioEdgeTest_Drive(0x89, 0x89);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_Order, 3, "highest pending pin dispatched first");
+	Test_Check((0 == DIO_EDGE_TEST_MIS(DIO_PORTB)) ? TRUE : FALSE, "dispatched edges are cleared");
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_Order, 0, "nothing dispatched twice");
+	
+	/* Rising and falling senses, both edges of B0 */
+	DioEdgeTest_Drive(0x50, 0x50);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_Rising, 1, "rising edge of the rising pin only");
+	DioEdgeTest_Drive(0x50, 0x00);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_Falling, 1, "falling edge of the falling pin only");
+	DioEdgeTest_Drive(0x89, 0x00);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_Order, 3, "falling edges of the both edges pins");
+	
+	/* Channel ID of another port */
+	HW_RegsModelDrivePins(DIO_PORTF, 0x10, 0x10);
+	Dio_EdgePortF_Handler();
+	DioEdgeTest_CheckLog(DIO_PortF, 1, "port F handler notifies F4");
+}
+
+/**
+ *	\brief		Masked channels and notifications enabled after an edge.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Mask(void)
+{
+	/* Needed Variables */
+	static const Dio_ChannelType DIO_B3[] = {DIO_CHANNEL_B3};
+	static const Dio_ChannelType DIO_B1[] = {DIO_CHANNEL_B1};
+	
+	DioEdgeTest_Setup();
+	
+	/* B1 is disabled while B3 isn't */
+	(void)Dio_EdgeDisableNotification(DIO_CHANNEL_B1);
+	DioEdgeTest_Drive(0x0A, 0x0A);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B3, 1, "disabled channel isn't dispatched");
+	
+	/* The edge of B1 latched while disabled doesn't show up at the enabling */
+	(void)Dio_EdgeEnableNotification(DIO_CHANNEL_B1);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B1, 0, "edge latched before the enabling is discarded");
+	DioEdgeTest_Drive(0x02, 0x00);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B1, 1, "enabled channel is dispatched");
+	
+	/* Removing a notification disables the channel */
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B1, NULL_PTR);
+	DioEdgeTest_Drive(0x02, 0x02);
+	Test_Check((0 == DIO_EDGE_TEST_MIS(DIO_PORTB)) ? TRUE : FALSE, "removed notification masks the channel");
+	
+	Test_Check((E_NOT_OK == Dio_EdgeEnableNotification(DIO_CHANNEL_B1)) ? TRUE : FALSE,
+			   "enabling without notification rejected");
+	Test_Check((E_NOT_OK == Dio_EdgeSetNotification((Dio_ChannelType)0x18, DioEdgeTest_Record)) ? TRUE : FALSE,
+			   "missing channel rejected");
+	Test_Check((E_NOT_OK == Dio_EdgeSetNotification((Dio_ChannelType)0x60, DioEdgeTest_Record)) ? TRUE : FALSE,
+			   "missing port rejected");
+}
+
+/**
+ *	\brief		Edges during a notification and level interrupts.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Pending(void)
+{
+	/* Needed Variables */
+	static const Dio_ChannelType DIO_B7[] = {DIO_CHANNEL_B7};
+	static const Dio_ChannelType DIO_B0[] = {DIO_CHANNEL_B0};
+	static const Dio_ChannelType DIO_B2Twice[] = {DIO_CHANNEL_B2, DIO_CHANNEL_B2};
+	
+	DioEdgeTest_Setup();
+	
+	/* The notification of B7 raises an edge on B0 after GPIOICR was written */
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B7, DioEdgeTest_RecordAndEdge);
+	DioEdgeTest_Drive(0x80, 0x80);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B7, 1, "edge during a notification isn't dispatched by the same call");
+	Test_Check((0x01 == DIO_EDGE_TEST_MIS(DIO_PORTB)) ? TRUE : FALSE, "edge during a notification stays pending");
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B0, 1, "edge during a notification interrupts again");
+	
+	/* B2 interrupts while high */
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B2, DioEdgeTest_Record);
+	(void)Dio_EdgeEnableNotification(DIO_CHANNEL_B2);
+	DioEdgeTest_Drive(0x04, 0x04);
+	Dio_EdgePortB_Handler();
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B2Twice, 2, "level stays pending while held");
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B2, DioEdgeTest_RecordAndRelease);
+	Dio_EdgePortB_Handler();
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B2Twice, 1, "removed level isn't pending");
+}
+
+/**
+ *	\brief		Pending channels without notification.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioEdgeTest_Missing(void)
+{
+	/* Needed Variables */
+	static const Dio_ChannelType DIO_B3[] = {DIO_CHANNEL_B3};
+	static const Dio_ChannelType DIO_B7[] = {DIO_CHANNEL_B7};
+	
+	DioEdgeTest_Setup();
+	
+	/* B1 has no notification and is unmasked behind DioEdge, as the PORT configuration could */
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B1, NULL_PTR);
+	HW_W_8RIG((HW_PortsAddresses[DIO_PORTB] + HW_GPIOIM_OFFSET),
+			  HW_R_8RIG(HW_PortsAddresses[DIO_PORTB] + HW_GPIOIM_OFFSET) | 0x02);
+	DioEdgeTest_Drive(0x0A, 0x0A);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B3, 1, "channel unmasked without notification skipped");
+	Test_Check((0 == DIO_EDGE_TEST_MIS(DIO_PORTB)) ? TRUE : FALSE,
+			   "channel unmasked without notification acknowledged");
+	
+	/* The notification of B7 removes the one of B3, pending in the same dispatch */
+	(void)Dio_EdgeSetNotification(DIO_CHANNEL_B7, DioEdgeTest_RecordAndRemove);
+	DioEdgeTest_Drive(0x88, 0x88);
+	Dio_EdgePortB_Handler();
+	DioEdgeTest_CheckLog(DIO_B7, 1, "notification removed during the dispatch skipped");
+	Test_Check((0 == DIO_EDGE_TEST_MIS(DIO_PORTB)) ? TRUE : FALSE,
+			   "channel whose notification was removed acknowledged");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	DioEdgeTest_Dispatch();
+	DioEdgeTest_Mask();
+	DioEdgeTest_Pending();
+	DioEdgeTest_Missing();
+	
+	return Test_Summary();
+}
@@ -0,0 +1,312 @@
+/**
+ *  \file	DioLanesTest.c
+ *  \brief 	Host functional test of the DIO lanes (DioLanes.h) against a per-lane reference,
+ *  		image K of a byte holding bit 7 - K of lane N in bit N:
+ *  		-	Dio_LanesTranspose() for every single bit and random bytes.
+ *  		-	Dio_LanesEncode() for even and odd lengths (the host two bytes path and its
+ *  			tail) with lanes held low by a NULL_PTR stream.
+ *  		-	Dio_LanesWrite() on the register model (TivaRegsModel.h): the pins give back the
+ *  			lane streams and the pins out of the mask keep their levels.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioLanesTest/DioLanesTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioLanes.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioLanesTest
+ *  		./DioLanesTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioLanes.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioLanesApi != STD_ON)
+#error "DioLanesTest needs DioLanesApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_LANES_TEST_RANDOM	10000	/*!< Random byte sets transposed */
+#define DIO_LANES_TEST_LENGTH	37		/*!< Bytes of the longest lane stream */
+
+/* Private Variables */
+static const Port_PinConfigType DioLanesTest_Pins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B5, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Port B outputs, lane N on pin N */
+
+static const Port_ConfigType DioLanesTest_Config = {
+	DioLanesTest_Pins,
+	(uint8)(sizeof(DioLanesTest_Pins) / sizeof(DioLanesTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the outputs */
+
+static uint8 DioLanesTest_Streams[DIO_LANES_NO_OF_LANES][DIO_LANES_TEST_LENGTH];	/*!< Lane streams */
+static Dio_PortLevelType DioLanesTest_Images[(8 * DIO_LANES_TEST_LENGTH) + 1];		/*!< Encoded images and a guard */
+static uint32 DioLanesTest_Seed = 3;	/*!< State of the bytes generator */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Returns the next pseudo random byte.
+ *	\param		None.
+ *	\return		uint8: 	Pseudo random byte.
+ */
+static uint8 DioLanesTest_Random(void);
+
+/**
+ *	\brief		Reference level of a lane in an image, taken bit by bit from the lane byte.
+ *	\param[in] 	Byte: 		Byte of the lane.
+ *	\param[in] 	Image: 		Index of the image in the byte images, 0 is sent first.
+ *	\return		uint8: 		Level of the lane, 0 or 1.
+ */
+static uint8 DioLanesTest_Bit(uint8 Byte, uint8 Image);
+
+/**
+ *	\brief		Compares 8 images of a byte of every lane with the reference.
+ *	\param[in] 	BytesPtr: 	Pointer to 8 bytes, byte N of lane N.
+ *	\param[in] 	ImagesPtr: 	Pointer to the 8 images.
+ *	\return		boolean: 	TRUE if every lane matches.
+ */
+static boolean DioLanesTest_Compare(const uint8* BytesPtr, const Dio_PortLevelType* ImagesPtr);
+
+/**
+ *	\brief		Dio_LanesTranspose() against the reference.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioLanesTest_Transpose(void);
+
+/**
+ *	\brief		Dio_LanesEncode() against the reference.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioLanesTest_Encode(void);
+
+/**
+ *	\brief		Dio_LanesWrite() on the register model.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioLanesTest_Write(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Returns the next pseudo random byte.
+ *	\param		None.
+ *	\return		uint8: 	Pseudo random byte.
+ */
+static uint8 DioLanesTest_Random(void)
+{
+	DioLanesTest_Seed = (DioLanesTest_Seed * 1103515245u + 12345u) & 0x7FFFFFFFu;
+	
+	return (uint8)(DioLanesTest_Seed >> 16);
+}
+
+/**
+ *	\brief		Reference level of a lane in an image, taken bit by bit from the lane byte.
+ *	\param[in] 	Byte: 		Byte of the lane.
+ *	\param[in] 	Image: 		Index of the image in the byte images, 0 is sent first.
+ *	\return		uint8: 		Level of the lane, 0 or 1.
+ */
+static uint8 DioLanesTest_Bit(uint8 Byte, uint8 Image)
+{
+	return (uint8)((Byte >> (7 - Image)) & 0x01);
+}
+
+/**
+ *	\brief		Compares 8 images of a byte of every lane with the reference.
+ *	\param[in] 	BytesPtr: 	Pointer to 8 bytes, byte N of lane N.
+ *	\param[in] 	ImagesPtr: 	Pointer to the 8 images.
+ *	\return		boolean: 	TRUE if every lane matches.
+ */
+static boolean DioLanesTest_Compare(const uint8* BytesPtr, const Dio_PortLevelType* ImagesPtr)
+{
+	/* Needed Variables */
+	boolean DIO_Match = TRUE;
+	uint8 DIO_Image;
+	uint8 DIO_Lane;
+	
+	for(DIO_Image = 0; DIO_Image < 8; DIO_Image++)
+	{
+		for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+		{
+			if(((ImagesPtr[DIO_Image] >> DIO_Lane) & 0x01) != DioLanesTest_Bit(BytesPtr[DIO_Lane], DIO_Image))
+			{
+				DIO_Match = FALSE;
+			}
+			else
+			{
+				/* Same level */
+			}
+		}
+	}
+	
+	return DIO_Match;
+}
+
+/**
+ *	\brief		Dio_LanesTranspose() against the reference.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioLanesTest_Transpose(void)
+{
+	/* Needed Variables */
+	uint8 DIO_Bytes[DIO_LANES_NO_OF_LANES];
+	Dio_PortLevelType DIO_Images[8];
+	boolean DIO_Match = TRUE;
+	uint32 DIO_Set;
+	uint8 DIO_Lane;
+	
+	/* Every single bit of the 8x8 matrix, so a swapped or lost bit is found by position */
+	for(DIO_Set = 0; DIO_Set < 64; DIO_Set++)
+	{
+		for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+		{
+			DIO_Bytes[DIO_Lane] = (uint8)(((DIO_Set >> 3) == DIO_Lane) ? (1 << (DIO_Set & 0x07)) : 0);
+		}
+		Dio_LanesTranspose(DIO_Bytes, DIO_Images);
+		DIO_Match = (TRUE == DioLanesTest_Compare(DIO_Bytes, DIO_Images)) ? DIO_Match : FALSE;
+	}
+	Test_Check(DIO_Match, "transpose of every single bit");
+	
+	for(DIO_Set = 0; DIO_Set < DIO_LANES_TEST_RANDOM; DIO_Set++)
+	{
+		for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+		{
+			DIO_Bytes[DIO_Lane] = DioLanesTest_Random();
+		}
+		Dio_LanesTranspose(DIO_Bytes, DIO_Images);
+		DIO_Match = (TRUE == DioLanesTest_Compare(DIO_Bytes, DIO_Images)) ? DIO_Match : FALSE;
+	}
+	Test_Check(DIO_Match, "transpose of random bytes");
+}
+
+/**
+ *	\brief		Dio_LanesEncode() against the reference.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioLanesTest_Encode(void)
+{
+	/* Needed Variables */
+	const uint8* DIO_Lanes[DIO_LANES_NO_OF_LANES];
+	uint8 DIO_Bytes[DIO_LANES_NO_OF_LANES];
+	boolean DIO_Match = TRUE;
+	uint16 DIO_Length;
+	uint16 DIO_Index;
+	uint8 DIO_Lane;
+	
+	for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+	{
+		for(DIO_Index = 0; DIO_Index < DIO_LANES_TEST_LENGTH; DIO_Index++)
+		{
+			DioLanesTest_Streams[DIO_Lane][DIO_Index] = DioLanesTest_Random();
+		}
+		/* Lanes 2 and 5 have no stream */
+		DIO_Lanes[DIO_Lane] = ((2 == DIO_Lane) || (5 == DIO_Lane)) ? NULL_PTR : DioLanesTest_Streams[DIO_Lane];
+	}
+	
+	/* Lengths 1, 2 and 37 take the tail only, the pairs only and both */
+	for(DIO_Length = 1; DIO_Length <= DIO_LANES_TEST_LENGTH; DIO_Length = (uint16)((2 == DIO_Length) ? DIO_LANES_TEST_LENGTH : (DIO_Length + 1)))
+	{
+		DioLanesTest_Images[8 * DIO_Length] = 0xA5;
+		DIO_Match = (E_OK == Dio_LanesEncode(DIO_Lanes, DioLanesTest_Images, DIO_Length)) ? DIO_Match : FALSE;
+		for(DIO_Index = 0; DIO_Index < DIO_Length; DIO_Index++)
+		{
+			for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+			{
+				DIO_Bytes[DIO_Lane] = (NULL_PTR != DIO_Lanes[DIO_Lane]) ? DioLanesTest_Streams[DIO_Lane][DIO_Index] : 0;
+			}
+			DIO_Match = (TRUE == DioLanesTest_Compare(DIO_Bytes, &DioLanesTest_Images[8 * DIO_Index])) ? DIO_Match : FALSE;
+		}
+		DIO_Match = (0xA5 == DioLanesTest_Images[8 * DIO_Length]) ? DIO_Match : FALSE;
+	}
+	Test_Check(DIO_Match, "encoded lanes match, nothing written past the images");
+	
+	Test_Check((E_NOT_OK == Dio_LanesEncode(NULL_PTR, DioLanesTest_Images, 1)) ? TRUE : FALSE, "NULL lanes rejected");
+	Test_Check((E_NOT_OK == Dio_LanesEncode(DIO_Lanes, NULL_PTR, 1)) ? TRUE : FALSE, "NULL images rejected");
+}
+
+/**
+ *	\brief		Dio_LanesWrite() on the register model.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioLanesTest_Write(void)
+{
+	/* Needed Variables */
+	const uint8* DIO_Lanes[DIO_LANES_NO_OF_LANES];
+	uint8 DIO_Received[DIO_LANES_NO_OF_LANES][4];
+	boolean DIO_Match = TRUE;
+	boolean DIO_Kept = TRUE;
+	uint16 DIO_Image;
+	uint8 DIO_Lane;
+	uint8 DIO_Pins;
+	
+	for(DIO_Lane = 0; DIO_Lane < DIO_LANES_NO_OF_LANES; DIO_Lane++)
+	{
+		DIO_Lanes[DIO_Lane] = DioLanesTest_Streams[DIO_Lane];
+		DIO_Received[DIO_Lane][0] = 0;
+		DIO_Received[DIO_Lane][1] = 0;
+		DIO_Received[DIO_Lane][2] = 0;
+		DIO_Received[DIO_Lane][3] = 0;
+	}
+	(void)Dio_LanesEncode(DIO_Lanes, DioLanesTest_Images, 4);
+	
+	/* Lanes 0 to 6 are played, B7 is held high by the application */
+	HW_RegsModelReset();
+	Port_Init(&DioLanesTest_Config);
+	Dio_WriteChannel(DIO_CHANNEL_B7, STD_HIGH);
+	for(DIO_Image = 0; DIO_Image < 32; DIO_Image++)
+	{
+		DIO_Match = (E_OK == Dio_LanesWrite(DIO_PORTB, 0x7F, &DioLanesTest_Images[DIO_Image], 1, 0)) ? DIO_Match : FALSE;
+		DIO_Pins = HW_RegsModelGetPins(DIO_PORTB);
+		DIO_Kept = (0x80 == (DIO_Pins & 0x80)) ? DIO_Kept : FALSE;
+		for(DIO_Lane = 0; DIO_Lane < 7; DIO_Lane++)
+		{
+			DIO_Received[DIO_Lane][DIO_Image >> 3] = (uint8)((DIO_Received[DIO_Lane][DIO_Image >> 3] << 1) | ((DIO_Pins >> DIO_Lane) & 0x01));
+		}
+	}
+	for(DIO_Lane = 0; DIO_Lane < 7; DIO_Lane++)
+	{
+		for(DIO_Image = 0; DIO_Image < 4; DIO_Image++)
+		{
+			DIO_Match = (DioLanesTest_Streams[DIO_Lane][DIO_Image] == DIO_Received[DIO_Lane][DIO_Image]) ? DIO_Match : FALSE;
+		}
+	}
+	Test_Check(DIO_Match, "pins give back the lane streams");
+	Test_Check(DIO_Kept, "pin out of the mask keeps its level");
+	
+	/* A whole burst leaves its last image, and the shadow keeps it under a later channel write */
+	(void)Dio_LanesWrite(DIO_PORTB, 0x7F, DioLanesTest_Images, 32, 2);
+	Dio_WriteChannel(DIO_CHANNEL_B7, STD_LOW);
+	Test_Check((HW_RegsModelGetPins(DIO_PORTB) == (DioLanesTest_Images[31] & 0x7F)) ? TRUE : FALSE,
+			   "burst leaves its last image");
+	
+	Test_Check((E_NOT_OK == Dio_LanesWrite(DIO_PORTB, 0xFF, NULL_PTR, 1, 0)) ? TRUE : FALSE, "NULL images rejected");
+	Test_Check((E_NOT_OK == Dio_LanesWrite((Dio_PortType)HW_NO_OF_PORTS, 0xFF, DioLanesTest_Images, 1, 0)) ? TRUE : FALSE,
+			   "missing port rejected");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	DioLanesTest_Transpose();
+	DioLanesTest_Encode();
+	DioLanesTest_Write();
+	
+	return Test_Summary();
+}
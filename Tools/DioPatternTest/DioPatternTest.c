@@ -0,0 +1,318 @@
+/**
+ *  \file	DioPatternTest.c
+ *  \brief 	Host functional test of the DIO pattern generator (DioPattern.h) on the register
+ *  		model (TivaRegsModel.h). The pins are read after every Dio_PatternTick() and
+ *  		compared with a reference timeline built from the steps delays:
+ *  		-	A pattern starts at the tick following its load, step n + 1 is written
+ *  			Dio_Delay ticks after step n, 0 writes it in the same tick.
+ *  		-	A repeated pattern starts its next pass Dio_Delay ticks after its last step.
+ *  		-	A pattern loaded while another plays starts at the end of the current pass.
+ *  		-	A stopped pattern writes nothing more, the pins keep their levels.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioPatternTest/DioPatternTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioPattern.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioPatternTest
+ *  		./DioPatternTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioPattern.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioPatternApi != STD_ON)
+#error "DioPatternTest needs DioPatternApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_PATTERN_TEST_TICKS	64		/*!< Ticks of the reference timeline */
+#define DIO_PATTERN_TEST_PINS_A	0x0C	/*!< Outputs of port A */
+#define DIO_PATTERN_TEST_PINS_F	0x0E	/*!< Outputs of port F, the LEDs */
+
+/* Private Variables */
+static const Port_PinConfigType DioPatternTest_Pins[] = {
+	{PORT_PIN_A2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Outputs of the patterns, low after the init */
+
+static const Port_ConfigType DioPatternTest_Config = {
+	DioPatternTest_Pins,
+	(uint8)(sizeof(DioPatternTest_Pins) / sizeof(DioPatternTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the outputs */
+
+static const Dio_PatternStepType DioPatternTest_StepsA[] = {
+	{DIO_PORTF, 0x0E, 0x02, 2},
+	{DIO_PORTA, 0x04, 0x04, 0},
+	{DIO_PORTF, 0x0E, 0x04, 3},
+	{DIO_PORTA, 0x0C, 0x08, 1},
+	{DIO_PORTF, 0x0E, 0x00, 4}
+};	/*!< Steps on two ports, with a step written in the tick of the previous one, 10 ticks a pass */
+
+static const Dio_PatternStepType DioPatternTest_StepsB[] = {
+	{DIO_PORTF, 0x08, 0x08, 1},
+	{DIO_PORTA, 0x0C, 0x00, 0},
+	{DIO_PORTF, 0x08, 0x00, 2}
+};	/*!< Blink of F3, 3 ticks a pass */
+
+static const Dio_PatternType DioPatternTest_OnceA = {DioPatternTest_StepsA, 5, FALSE};	/*!< Single pass of A */
+static const Dio_PatternType DioPatternTest_RepeatA = {DioPatternTest_StepsA, 5, TRUE};	/*!< Replayed A */
+static const Dio_PatternType DioPatternTest_RepeatB = {DioPatternTest_StepsB, 3, TRUE};	/*!< Replayed B */
+
+static uint8 DioPatternTest_Expected[DIO_PATTERN_TEST_TICKS][HW_NO_OF_PORTS];	/*!< Reference levels after every tick */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Clears the reference timeline, every output low.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Clear(void);
+
+/**
+ *	\brief		Adds the passes of a pattern to the reference timeline.
+ *	\param[in] 	PatternPtr: 	Pointer to the pattern.
+ *	\param[in] 	Start: 			Tick writing the first step.
+ *	\param[in] 	End: 			First tick the pattern doesn't play any more, only whole passes started
+ *								before it are added.
+ *	\return		uint16: 		Tick following the last added pass.
+ */
+static uint16 DioPatternTest_Reference(const Dio_PatternType* PatternPtr, uint16 Start, uint16 End);
+
+/**
+ *	\brief		Ticks the generator and compares the pins with the reference timeline.
+ *	\param[in] 	From: 		First tick.
+ *	\param[in] 	To: 		Tick following the last one.
+ *	\return		boolean: 	TRUE if every tick matched.
+ */
+static boolean DioPatternTest_Run(uint16 From, uint16 To);
+
+/**
+ *	\brief		Resets the model and the generator.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Setup(void);
+
+/**
+ *	\brief		Single and repeated passes.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Passes(void);
+
+/**
+ *	\brief		Pattern loaded while another one plays, then stopped.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Replace(void);
+
+/**
+ *	\brief		Dio_PatternLoad() with invalid patterns.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Load(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Clears the reference timeline, every output low.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Clear(void)
+{
+	/* Needed Variables */
+	uint16 DIO_Tick;
+	uint8 DIO_Port;
+	
+	for(DIO_Tick = 0; DIO_Tick < DIO_PATTERN_TEST_TICKS; DIO_Tick++)
+	{
+		for(DIO_Port = 0; DIO_Port < HW_NO_OF_PORTS; DIO_Port++)
+		{
+			DioPatternTest_Expected[DIO_Tick][DIO_Port] = 0;
+		}
+	}
+}
+
+/**
+ *	\brief		Adds the passes of a pattern to the reference timeline.
+ *	\param[in] 	PatternPtr: 	Pointer to the pattern.
+ *	\param[in] 	Start: 			Tick writing the first step.
+ *	\param[in] 	End: 			First tick the pattern doesn't play any more, only whole passes started
+ *								before it are added.
+ *	\return		uint16: 		Tick following the last added pass.
+ */
+static uint16 DioPatternTest_Reference(const Dio_PatternType* PatternPtr, uint16 Start, uint16 End)
+{
+	/* Needed Variables */
+	const Dio_PatternStepType* DIO_StepPtr;
+	uint16 DIO_Time = Start;
+	uint16 DIO_Step;
+	uint16 DIO_Tick;
+	
+	do
+	{
+		/* Every step holds its levels from its tick on */
+		for(DIO_Step = 0; DIO_Step < PatternPtr->Dio_NoOfSteps; DIO_Step++)
+		{
+			DIO_StepPtr = &PatternPtr->Dio_Steps[DIO_Step];
+			for(DIO_Tick = DIO_Time; DIO_Tick < DIO_PATTERN_TEST_TICKS; DIO_Tick++)
+			{
+				DioPatternTest_Expected[DIO_Tick][DIO_StepPtr->Dio_Port] =
+					(uint8)((DioPatternTest_Expected[DIO_Tick][DIO_StepPtr->Dio_Port] & ~DIO_StepPtr->Dio_Mask) |
+							(DIO_StepPtr->Dio_Level & DIO_StepPtr->Dio_Mask));
+			}
+			DIO_Time = (uint16)(DIO_Time + DIO_StepPtr->Dio_Delay);
+		}
+	}while((TRUE == PatternPtr->Dio_Repeat) && (DIO_Time < End));
+	
+	return DIO_Time;
+}
+
+/**
+ *	\brief		Ticks the generator and compares the pins with the reference timeline.
+ *	\param[in] 	From: 		First tick.
+ *	\param[in] 	To: 		Tick following the last one.
+ *	\return		boolean: 	TRUE if every tick matched.
+ */
+static boolean DioPatternTest_Run(uint16 From, uint16 To)
+{
+	/* Needed Variables */
+	boolean DIO_Match = TRUE;
+	uint16 DIO_Tick;
+	uint8 DIO_PinsA;
+	uint8 DIO_PinsF;
+	
+	for(DIO_Tick = From; DIO_Tick < To; DIO_Tick++)
+	{
+		Dio_PatternTick();
+		DIO_PinsA = (uint8)(HW_RegsModelGetPins(DIO_PORTA) & DIO_PATTERN_TEST_PINS_A);
+		DIO_PinsF = (uint8)(HW_RegsModelGetPins(DIO_PORTF) & DIO_PATTERN_TEST_PINS_F);
+		if((DIO_PinsA != DioPatternTest_Expected[DIO_Tick][DIO_PORTA]) ||
+		   (DIO_PinsF != DioPatternTest_Expected[DIO_Tick][DIO_PORTF]))
+		{
+			printf("tick %u: A 0x%02X F 0x%02X, reference 0x%02X 0x%02X\n", DIO_Tick, DIO_PinsA, DIO_PinsF,
+				   DioPatternTest_Expected[DIO_Tick][DIO_PORTA], DioPatternTest_Expected[DIO_Tick][DIO_PORTF]);
+			DIO_Match = FALSE;
+		}
+		else
+		{
+			/* Same levels */
+		}
+	}
+	
+	return DIO_Match;
+}
+
+/**
+ *	\brief		Resets the model and the generator.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Setup(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&DioPatternTest_Config);
+	Dio_PatternInit();
+	DioPatternTest_Clear();
+}
+
+/**
+ *	\brief		Single and repeated passes.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Passes(void)
+{
+	/* Single pass, loaded before tick 3: the pins hold the last step after it */
+	DioPatternTest_Setup();
+	(void)DioPatternTest_Reference(&DioPatternTest_OnceA, 3, 3);
+	Test_Check(DioPatternTest_Run(0, 3), "idle generator writes nothing");
+	Test_Check((E_OK == Dio_PatternLoad(&DioPatternTest_OnceA)) ? TRUE : FALSE, "single pass loaded");
+	Test_Check(DioPatternTest_Run(3, DIO_PATTERN_TEST_TICKS), "single pass timing");
+	
+	/* Repeated passes */
+	DioPatternTest_Setup();
+	(void)DioPatternTest_Reference(&DioPatternTest_RepeatA, 0, DIO_PATTERN_TEST_TICKS);
+	(void)Dio_PatternLoad(&DioPatternTest_RepeatA);
+	Test_Check(DioPatternTest_Run(0, DIO_PATTERN_TEST_TICKS), "repeated passes timing");
+}
+
+/**
+ *	\brief		Pattern loaded while another one plays, then stopped.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Replace(void)
+{
+	/* Needed Variables */
+	uint16 DIO_Switch;
+	uint16 DIO_Tick;
+	
+	/* B is loaded during the third pass of A, it starts at the end of that pass */
+	DioPatternTest_Setup();
+	DIO_Switch = DioPatternTest_Reference(&DioPatternTest_RepeatA, 0, 25);
+	(void)DioPatternTest_Reference(&DioPatternTest_RepeatB, DIO_Switch, 50);
+	(void)Dio_PatternLoad(&DioPatternTest_RepeatA);
+	Test_Check(DioPatternTest_Run(0, 25), "first pattern plays");
+	Test_Check((E_OK == Dio_PatternLoad(&DioPatternTest_RepeatB)) ? TRUE : FALSE, "second pattern loaded while playing");
+	Test_Check((E_NOT_OK == Dio_PatternLoad(&DioPatternTest_OnceA)) ? TRUE : FALSE, "load while another is pending rejected");
+	Test_Check(DioPatternTest_Run(25, (uint16)(DIO_Switch - 1)), "current pass completed");
+	Test_Check(Dio_PatternIsLoadPending(), "load pending until the end of the pass");
+	Test_Check(DioPatternTest_Run((uint16)(DIO_Switch - 1), 50), "second pattern starts at the end of the pass");
+	Test_Check((FALSE == Dio_PatternIsLoadPending()) ? TRUE : FALSE, "load released once started");
+	
+	/* Stopped before tick 50, the levels are kept */
+	Dio_PatternStop();
+	for(DIO_Tick = 50; DIO_Tick < DIO_PATTERN_TEST_TICKS; DIO_Tick++)
+	{
+		DioPatternTest_Expected[DIO_Tick][DIO_PORTA] = DioPatternTest_Expected[49][DIO_PORTA];
+		DioPatternTest_Expected[DIO_Tick][DIO_PORTF] = DioPatternTest_Expected[49][DIO_PORTF];
+	}
+	Test_Check(DioPatternTest_Run(50, DIO_PATTERN_TEST_TICKS), "stopped pattern keeps the levels");
+}
+
+/**
+ *	\brief		Dio_PatternLoad() with invalid patterns.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioPatternTest_Load(void)
+{
+	/* Needed Variables */
+	static const Dio_PatternStepType DIO_BadSteps[] = {
+		{DIO_PORTF, 0x02, 0x02, 1},
+		{(Dio_PortType)HW_NO_OF_PORTS, 0x01, 0x01, 1}
+	};
+	const Dio_PatternType DIO_BadPort = {DIO_BadSteps, 2, FALSE};
+	const Dio_PatternType DIO_Empty = {DIO_BadSteps, 0, FALSE};
+	
+	DioPatternTest_Setup();
+	Test_Check((E_NOT_OK == Dio_PatternLoad(NULL_PTR)) ? TRUE : FALSE, "NULL pattern rejected");
+	Test_Check((E_NOT_OK == Dio_PatternLoad(&DIO_Empty)) ? TRUE : FALSE, "empty pattern rejected");
+	Test_Check((E_NOT_OK == Dio_PatternLoad(&DIO_BadPort)) ? TRUE : FALSE, "missing port rejected");
+	Test_Check(DioPatternTest_Run(0, 4), "rejected patterns don't play");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	DioPatternTest_Passes();
+	DioPatternTest_Replace();
+	DioPatternTest_Load();
+	
+	return Test_Summary();
+}
@@ -0,0 +1,321 @@
+/**
+ *  \file	DioShadowTest.c
+ *  \brief 	Host functional test of the DIO shadow (DioShadow.h) on the register model
+ *  		(TivaRegsModel.h). The registers and the pins are compared after every step:
+ *  		-	Port_Init() after the registers were reset configures the port again, also
+ *  			when the shadow was loaded before the reset.
+ *  		-	The drive strength and pull registers read back what the hardware holds
+ *  			after their side effects on the other registers.
+ *  		-	A DIO write of a pin driven behind the shadow reaches the port once its
+ *  			level is forgotten, Dio_ShadowInvalidate() reloads a changed register.
+ *  		-	With DioShadowRegisters on: an unchanged GPIODATA write is skipped, the level
+ *  			of a push-pull output is read from RAM and an unchanged register write is
+ *  			skipped.
+ *  		Passes with DioShadowRegisters (DioGeneral.h) off and on.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioShadowTest/DioShadowTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioShadowTest
+ *  		./DioShadowTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioShadow.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+/* Macros */
+/* Register of a port through the aperture used by the drivers */
+#define DIO_SHADOW_TEST_REG(PORT_ID, OFFSET)	(HW_PortsAddresses[PORT_ID] + (OFFSET))
+
+#define DIO_SHADOW_TEST_F1	0x02	/*!< Red LED, push-pull output */
+#define DIO_SHADOW_TEST_F4	0x10	/*!< SW1, input with pull-up */
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static const Port_PinConfigType DioShadowTest_Pins[] = {
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Red LED and SW1 */
+
+static const Port_ConfigType DioShadowTest_Config = {
+	DioShadowTest_Pins,
+	(uint8)(sizeof(DioShadowTest_Pins) / sizeof(DioShadowTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the pins */
+
+static const uint16 DioShadowTest_Offsets[DIO_SHADOW_NO_OF_REGS] = {
+	HW_GPIODIR_OFFSET,
+	HW_GPIOAFSEL_OFFSET,
+	HW_GPIODR2R_OFFSET,
+	HW_GPIODR4R_OFFSET,
+	HW_GPIODR8R_OFFSET,
+	HW_GPIOODR_OFFSET,
+	HW_GPIOPUR_OFFSET,
+	HW_GPIOPDR_OFFSET,
+	HW_GPIODEN_OFFSET
+};	/*!< Offsets of the shadowed registers, indexed by Dio_ShadowRegType */
+
+static uint16 DioShadowTest_DataReads = 0;		/*!< GPIODATA reads of PORTF seen by the pins hook */
+static uint16 DioShadowTest_DataWrites = 0;	/*!< GPIODATA writes of PORTF seen by the pins hook */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Counts the GPIODATA accesses of PORTF, pins hook of the register model.
+ *	\param[in] 	PortId: 	ID of the accessed port.
+ *	\param[in] 	Written: 	TRUE for a write.
+ *	\return		None.
+ */
+static void DioShadowTest_Hook(uint8 PortId, boolean Written);
+
+/**
+ *	\brief		Resets the registers and initializes the pins.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Init(void);
+
+/**
+ *	\brief		Checks that PORTF is configured by DioShadowTest_Config.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void DioShadowTest_CheckConfigured(const char* Name);
+
+/**
+ *	\brief		Port_Init() after the registers were reset behind a loaded shadow.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Reset(void);
+
+/**
+ *	\brief		Side effects of the drive strength and pull registers.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_SideEffects(void);
+
+/**
+ *	\brief		Pins and registers changed behind the shadow.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Behind(void);
+
+#if(DioShadowRegisters == STD_ON)
+/**
+ *	\brief		Accesses skipped by the shadow.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Elision(void);
+#endif /* DioShadowRegisters check */
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Counts the GPIODATA accesses of PORTF, pins hook of the register model.
+ *	\param[in] 	PortId: 	ID of the accessed port.
+ *	\param[in] 	Written: 	TRUE for a write.
+ *	\return		None.
+ */
+static void DioShadowTest_Hook(uint8 PortId, boolean Written)
+{
+	if(PORT_DIO_PORTF != PortId)
+	{
+		/* Other ports aren't counted */
+	}
+	else if(TRUE == Written)
+	{
+		DioShadowTest_DataWrites++;
+	}
+	else
+	{
+		DioShadowTest_DataReads++;
+	}
+}
+
+/**
+ *	\brief		Resets the registers and initializes the pins.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Init(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&DioShadowTest_Config);
+	HW_RegsModelSetPinsHook(DioShadowTest_Hook);
+	DioShadowTest_DataReads = 0;
+	DioShadowTest_DataWrites = 0;
+}
+
+/**
+ *	\brief		Checks that PORTF is configured by DioShadowTest_Config.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void DioShadowTest_CheckConfigured(const char* Name)
+{
+	Test_Check(((DIO_SHADOW_TEST_F1 == (HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) &
+										 (DIO_SHADOW_TEST_F1 | DIO_SHADOW_TEST_F4))) &&
+				((DIO_SHADOW_TEST_F1 | DIO_SHADOW_TEST_F4) ==
+				 (HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIODEN_OFFSET)) & (DIO_SHADOW_TEST_F1 | DIO_SHADOW_TEST_F4))) &&
+				(DIO_SHADOW_TEST_F4 == (HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET)) &
+										(DIO_SHADOW_TEST_F1 | DIO_SHADOW_TEST_F4))) &&
+				(DIO_SHADOW_TEST_F4 == (HW_RegsModelGetPins(PORT_DIO_PORTF) & (DIO_SHADOW_TEST_F1 | DIO_SHADOW_TEST_F4)))) ? TRUE : FALSE,
+			   Name);
+}
+
+/**
+ *	\brief		Port_Init() after the registers were reset behind a loaded shadow.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Reset(void)
+{
+	DioShadowTest_Init();
+	DioShadowTest_CheckConfigured("Port_Init configures the port");
+	
+	/* Load the shadow of every register and level, then reset the registers behind it */
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_HIGH);
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_LOW);
+	HW_RegsModelReset();
+	Port_Init(&DioShadowTest_Config);
+	DioShadowTest_CheckConfigured("Port_Init after a reset configures the port again");
+	
+	/* The initial level is latched again, the output was low before the reset too */
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_HIGH);
+	HW_RegsModelReset();
+	Port_Init(&DioShadowTest_Config);
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_HIGH);
+	Test_Check((DIO_SHADOW_TEST_F1 == (HW_RegsModelGetPins(PORT_DIO_PORTF) & DIO_SHADOW_TEST_F1)) ? TRUE : FALSE,
+			   "write after Port_Init reaches the reset port");
+	Test_Check((STD_HIGH == Dio_ReadChannel(DIO_CHANNEL_F1)) ? TRUE : FALSE,
+			   "written level read back");
+}
+
+/**
+ *	\brief		Side effects of the drive strength and pull registers.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_SideEffects(void)
+{
+	/* Needed Variables */
+	uint8 DioShadowTest_Reg;
+	boolean DioShadowTest_Coherent = TRUE;
+	
+	DioShadowTest_Init();
+	
+	/* Selecting 8 mA clears the 2 mA bit, selecting the pull-down clears the pull-up */
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_DR2R, 0, DIO_SHADOW_TEST_F1);
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_DR8R, 0, DIO_SHADOW_TEST_F1);
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_PDR, 0, DIO_SHADOW_TEST_F4);
+	for(DioShadowTest_Reg = 0; DioShadowTest_Reg < (uint8)DIO_SHADOW_NO_OF_REGS; DioShadowTest_Reg++)
+	{
+		if(Dio_ShadowReadReg(PORT_DIO_PORTF, (Dio_ShadowRegType)DioShadowTest_Reg) !=
+		   (uint8)HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, DioShadowTest_Offsets[DioShadowTest_Reg])))
+		{
+			DioShadowTest_Coherent = FALSE;
+			printf("register %u differs from its shadow\n", DioShadowTest_Reg);
+		}
+		else
+		{
+			/* Shadow holds the register */
+		}
+	}
+	Test_Check(DioShadowTest_Coherent, "every register read back as the hardware holds it");
+	
+	/* Clearing the 8 mA bit doesn't give back the 2 mA one */
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_DR8R, DIO_SHADOW_TEST_F1, 0);
+	Test_Check((0 == (Dio_ShadowReadReg(PORT_DIO_PORTF, DIO_SHADOW_DR2R) & DIO_SHADOW_TEST_F1)) ? TRUE : FALSE,
+			   "2 mA bit stays cleared");
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_DR2R, 0, DIO_SHADOW_TEST_F1);
+	Test_Check((DIO_SHADOW_TEST_F1 == (HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIODR2R_OFFSET)) &
+									   DIO_SHADOW_TEST_F1)) ? TRUE : FALSE,
+			   "2 mA bit set again reaches the port");
+}
+
+/**
+ *	\brief		Pins and registers changed behind the shadow.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Behind(void)
+{
+	DioShadowTest_Init();
+	
+	/* The output is driven high behind the shadow, as the uDMA or a soft engine would */
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_LOW);
+	HW_W_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIODATA_OFFSET + (DIO_SHADOW_TEST_F1 << 2)), DIO_SHADOW_TEST_F1);
+	Dio_ShadowForgetData(PORT_DIO_PORTF, DIO_SHADOW_TEST_F1);
+	Test_Check((STD_HIGH == Dio_ReadChannel(DIO_CHANNEL_F1)) ? TRUE : FALSE,
+			   "forgotten level read from the port");
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_LOW);
+	Test_Check((0 == (HW_RegsModelGetPins(PORT_DIO_PORTF) & DIO_SHADOW_TEST_F1)) ? TRUE : FALSE,
+			   "write of a forgotten level reaches the port");
+	
+	/* GPIODIR changed behind the shadow */
+	(void)Dio_ShadowReadReg(PORT_DIO_PORTF, DIO_SHADOW_DIR);
+	HW_W_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET), 0);
+	Dio_ShadowInvalidate(PORT_DIO_PORTF);
+	Test_Check((0 == Dio_ShadowReadReg(PORT_DIO_PORTF, DIO_SHADOW_DIR)) ? TRUE : FALSE,
+			   "invalidated register read from the port");
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_DIR, 0, DIO_SHADOW_TEST_F1);
+	Test_Check((DIO_SHADOW_TEST_F1 == HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET))) ? TRUE : FALSE,
+			   "invalidated register written again");
+}
+
+#if(DioShadowRegisters == STD_ON)
+/**
+ *	\brief		Accesses skipped by the shadow.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioShadowTest_Elision(void)
+{
+	DioShadowTest_Init();
+	
+	/* Port_Init latched the initial level of the output */
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_LOW);
+	Test_Check((0 == DioShadowTest_DataWrites) ? TRUE : FALSE, "write of the initial level skipped");
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_HIGH);
+	Dio_WriteChannel(DIO_CHANNEL_F1, STD_HIGH);
+	Test_Check((1 == DioShadowTest_DataWrites) ? TRUE : FALSE, "unchanged level written once");
+	Test_Check((STD_HIGH == Dio_ReadChannel(DIO_CHANNEL_F1)) && (0 == DioShadowTest_DataReads) ? TRUE : FALSE,
+			   "output level read from RAM");
+	
+	/* An input is always read from the port */
+	HW_RegsModelDrivePins(PORT_DIO_PORTF, DIO_SHADOW_TEST_F4, 0);
+	Test_Check((STD_LOW == Dio_ReadChannel(DIO_CHANNEL_F4)) && (1 == DioShadowTest_DataReads) ? TRUE : FALSE,
+			   "input level read from the port");
+	
+	/* The register is changed behind the shadow, the unchanged write is skipped */
+	HW_W_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIOODR_OFFSET), DIO_SHADOW_TEST_F1);
+	Dio_ShadowModifyReg(PORT_DIO_PORTF, DIO_SHADOW_ODR, DIO_SHADOW_TEST_F1, 0);
+	Test_Check((DIO_SHADOW_TEST_F1 == HW_R_8RIG(DIO_SHADOW_TEST_REG(PORT_DIO_PORTF, HW_GPIOODR_OFFSET))) ? TRUE : FALSE,
+			   "unchanged register write skipped");
+}
+#endif /* DioShadowRegisters check */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	DioShadowTest_Reset();
+	DioShadowTest_SideEffects();
+	DioShadowTest_Behind();
+#if(DioShadowRegisters == STD_ON)
+	DioShadowTest_Elision();
+#endif /* DioShadowRegisters check */
+	
+	return Test_Summary();
+}
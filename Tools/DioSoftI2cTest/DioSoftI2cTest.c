@@ -0,0 +1,466 @@
+/**
+ *  \file	DioSoftI2cTest.c
+ *  \brief 	Host functional test of the soft I2C (DioSoftI2c.h) against a pin-level slave
+ *  		modelled on the register model (TivaRegsModel.h): open-drain SCL and SDA with
+ *  		pull-ups, the slave following the lines after every access of the master through
+ *  		the pins hook and pulling them low to answer, as a device on the bus would.
+ *  		-	START, repeated START and STOP seen on the lines, written bytes and address
+ *  			acknowledged, read bytes acknowledged by the master but the last one.
+ *  		-	Address and written byte not acknowledged, the message aborted and stopped.
+ *  		-	Clock stretched after every acknowledge for 1 poll less than the limit, then
+ *  			for the limit.
+ *  		-	Bus recovery: SDA held low by the slave for up to 9 clocks, then for ever.
+ *  		-	The rejected configurations.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioSoftI2cTest/DioSoftI2cTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioSoftI2c.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioSoftI2cTest
+ *  		./DioSoftI2cTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioSoftI2c.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioSoftI2cApi != STD_ON)
+#error "DioSoftI2cTest needs DioSoftI2cApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_SOFT_I2C_TEST_PORT		4		/*!< Port of the bus, E */
+#define DIO_SOFT_I2C_TEST_SCL		0x10	/*!< SCL on E4 */
+#define DIO_SOFT_I2C_TEST_SDA		0x20	/*!< SDA on E5 */
+#define DIO_SOFT_I2C_TEST_ADDRESS	0x3A	/*!< Address of the slave */
+#define DIO_SOFT_I2C_TEST_LENGTH	8		/*!< Bytes of a message at most */
+#define DIO_SOFT_I2C_TEST_LIMIT		20		/*!< Polls of a stretched clock */
+#define DIO_SOFT_I2C_TEST_NO_NACK	0xFF	/*!< The slave acknowledges every written byte */
+
+/* Slave states */
+#define DIO_SOFT_I2C_TEST_IDLE		0	/*!< Waits for a START */
+#define DIO_SOFT_I2C_TEST_ADDRESS_BYTE	1	/*!< Receives the address */
+#define DIO_SOFT_I2C_TEST_WRITE		2	/*!< Receives the written bytes */
+#define DIO_SOFT_I2C_TEST_READ		3	/*!< Sends the read bytes */
+
+/* Defined data types */
+typedef struct{
+	uint8	DIO_State;			/*!< Slave state */
+	uint8	DIO_Clocks;			/*!< SCL rises of the byte, 8 the acknowledge, 9 after it */
+	uint8	DIO_Byte;			/*!< Byte being received */
+	uint8	DIO_Pulled;			/*!< Lines pulled low by the slave */
+	uint8	DIO_Lines;			/*!< Last levels of the lines */
+	uint8	DIO_NackIndex;		/*!< Written byte not acknowledged */
+	uint8	DIO_Received;		/*!< Written bytes received */
+	uint8	DIO_Sent;			/*!< Read bytes sent */
+	uint8	DIO_Acks;			/*!< Read bytes acknowledged by the master */
+	uint8	DIO_Starts;			/*!< STARTs, repeated ones included */
+	uint8	DIO_Stops;			/*!< STOPs */
+	uint8	DIO_Falls;			/*!< SCL falls */
+	uint16	DIO_Stretch;		/*!< Reads of the port the clock is held low for after an acknowledge */
+	uint16	DIO_StretchLeft;	/*!< Reads of the port left before the clock is released */
+	uint8	DIO_StuckFalls;		/*!< SCL falls SDA is held low for, 0xFF for ever */
+	uint8	DIO_Rx[DIO_SOFT_I2C_TEST_LENGTH];		/*!< Written bytes */
+	uint8	DIO_Tx[DIO_SOFT_I2C_TEST_LENGTH + 1];	/*!< Read bytes */
+}DioSoftI2cTest_SlaveType;	/*!< Pin-level I2C slave */
+
+/* Private Variables */
+static const Port_PinConfigType DioSoftI2cTest_Pins[] = {
+	{PORT_PIN_E4, PORT_PIN_DIO, PORT_CURRENT_DEFAULT, PORT_PIN_OUT, STD_HIGH, PORT_PULL_UP_ENABLE, PORT_PULL_DOWN_DISABLE,
+	 PORT_OPEN_DRAIN_ENABLE, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E5, PORT_PIN_DIO, PORT_CURRENT_DEFAULT, PORT_PIN_OUT, STD_HIGH, PORT_PULL_UP_ENABLE, PORT_PULL_DOWN_DISABLE,
+	 PORT_OPEN_DRAIN_ENABLE, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< SCL on E4 and SDA on E5, open-drain with pull-ups */
+
+static const Port_ConfigType DioSoftI2cTest_Config = {
+	DioSoftI2cTest_Pins,
+	(uint8)(sizeof(DioSoftI2cTest_Pins) / sizeof(DioSoftI2cTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the pins */
+
+static const Dio_SoftI2cConfigType DioSoftI2cTest_Bus = {
+	DIO_CHANNEL_E4, DIO_CHANNEL_E5, 0, DIO_SOFT_I2C_TEST_LIMIT
+};	/*!< Soft I2C on the bus */
+
+static DioSoftI2cTest_SlaveType DioSoftI2cTest_Slave;	/*!< Slave on the bus */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Pulls low or releases a line of the slave and drives the lines.
+ *	\param[in] 	Line: 	Mask of the line.
+ *	\param[in] 	Low: 	TRUE to pull it low.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Pull(uint8 Line, boolean Low);
+
+/**
+ *	\brief		Slave side of an SCL fall: acknowledge slot, next read bit, clock stretching.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Fall(void);
+
+/**
+ *	\brief		Pins hook: the slave follows the lines after every access of the master.
+ *	\param[in] 	PortId: 	ID of the accessed port.
+ *	\param[in] 	Written: 	TRUE for a store.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Hook(uint8 PortId, boolean Written);
+
+/**
+ *	\brief		Puts the slave back on an idle bus.
+ *	\param[in] 	NackIndex: 	Written byte not acknowledged, DIO_SOFT_I2C_TEST_NO_NACK for none.
+ *	\param[in] 	Stretch: 	Reads of the port the clock is held low for after an acknowledge.
+ *	\param[in] 	StuckFalls: SCL falls SDA is held low for, 0 for none and 0xFF for ever.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Attach(uint8 NackIndex, uint16 Stretch, uint8 StuckFalls);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Pulls low or releases a line of the slave and drives the lines.
+ *	\param[in] 	Line: 	Mask of the line.
+ *	\param[in] 	Low: 	TRUE to pull it low.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Pull(uint8 Line, boolean Low)
+{
+	DioSoftI2cTest_Slave.DIO_Pulled = (TRUE == Low) ? (uint8)(DioSoftI2cTest_Slave.DIO_Pulled | Line) :
+													  (uint8)(DioSoftI2cTest_Slave.DIO_Pulled & ~Line);
+	
+	/* A released line is pulled up */
+	HW_RegsModelDrivePins(DIO_SOFT_I2C_TEST_PORT, DioSoftI2cTest_Slave.DIO_Pulled, 0x00);
+}
+
+/**
+ *	\brief		Slave side of an SCL fall: acknowledge slot, next read bit, clock stretching.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Fall(void)
+{
+	/* Needed Variables */
+	DioSoftI2cTest_SlaveType* DIO_SlavePtr = &DioSoftI2cTest_Slave;
+	uint8 DIO_Byte = DIO_SlavePtr->DIO_Tx[DIO_SlavePtr->DIO_Sent];
+	
+	DIO_SlavePtr->DIO_Falls++;
+	if(0 != DIO_SlavePtr->DIO_StuckFalls)
+	{
+		/* Interrupted in the middle of a byte, SDA is freed once the missing bits are clocked out */
+		DIO_SlavePtr->DIO_StuckFalls -= (0xFF != DIO_SlavePtr->DIO_StuckFalls) ? 1 : 0;
+		DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA, (0 != DIO_SlavePtr->DIO_StuckFalls) ? TRUE : FALSE);
+	}
+	else if(DIO_SOFT_I2C_TEST_IDLE == DIO_SlavePtr->DIO_State)
+	{
+		/* Not addressed */
+	}
+	else if(8 == DIO_SlavePtr->DIO_Clocks)
+	{
+		/* Acknowledge slot */
+		if(DIO_SOFT_I2C_TEST_ADDRESS_BYTE == DIO_SlavePtr->DIO_State)
+		{
+			if((DIO_SOFT_I2C_TEST_ADDRESS << 1) == (DIO_SlavePtr->DIO_Byte & 0xFE))
+			{
+				DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA, TRUE);
+			}
+			else
+			{
+				DIO_SlavePtr->DIO_State = DIO_SOFT_I2C_TEST_IDLE;
+			}
+		}
+		else if(DIO_SOFT_I2C_TEST_WRITE == DIO_SlavePtr->DIO_State)
+		{
+			DIO_SlavePtr->DIO_Rx[DIO_SlavePtr->DIO_Received % DIO_SOFT_I2C_TEST_LENGTH] = DIO_SlavePtr->DIO_Byte;
+			if(DIO_SlavePtr->DIO_Received != DIO_SlavePtr->DIO_NackIndex)
+			{
+				DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA, TRUE);
+			}
+			else
+			{
+				DIO_SlavePtr->DIO_State = DIO_SOFT_I2C_TEST_IDLE;
+			}
+			DIO_SlavePtr->DIO_Received++;
+		}
+		else
+		{
+			/* The master acknowledges a read byte */
+			DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA, FALSE);
+		}
+	}
+	else if(9 == DIO_SlavePtr->DIO_Clocks)
+	{
+		/* After the acknowledge, the address gives the direction */
+		if(DIO_SOFT_I2C_TEST_ADDRESS_BYTE == DIO_SlavePtr->DIO_State)
+		{
+			DIO_SlavePtr->DIO_State = (0 != (DIO_SlavePtr->DIO_Byte & 0x01)) ? DIO_SOFT_I2C_TEST_READ : DIO_SOFT_I2C_TEST_WRITE;
+		}
+		else
+		{
+			/* Same direction */
+		}
+		DIO_SlavePtr->DIO_Clocks = 0;
+		DIO_SlavePtr->DIO_Byte = 0;
+		DIO_Byte = DIO_SlavePtr->DIO_Tx[DIO_SlavePtr->DIO_Sent];
+		DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA,
+							((DIO_SOFT_I2C_TEST_READ == DIO_SlavePtr->DIO_State) && (0 == (DIO_Byte & 0x80))) ? TRUE : FALSE);
+		if(0 != DIO_SlavePtr->DIO_Stretch)
+		{
+			DIO_SlavePtr->DIO_StretchLeft = DIO_SlavePtr->DIO_Stretch;
+			DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SCL, TRUE);
+		}
+		else
+		{
+			/* Clock not stretched */
+		}
+	}
+	else if(DIO_SOFT_I2C_TEST_READ == DIO_SlavePtr->DIO_State)
+	{
+		/* Next bit of the read byte */
+		DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA, (0 == ((DIO_Byte << DIO_SlavePtr->DIO_Clocks) & 0x80)) ? TRUE : FALSE);
+	}
+	else
+	{
+		/* The master sends the bit */
+	}
+}
+
+/**
+ *	\brief		Pins hook: the slave follows the lines after every access of the master.
+ *	\param[in] 	PortId: 	ID of the accessed port.
+ *	\param[in] 	Written: 	TRUE for a store.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Hook(uint8 PortId, boolean Written)
+{
+	/* Needed Variables */
+	DioSoftI2cTest_SlaveType* DIO_SlavePtr = &DioSoftI2cTest_Slave;
+	uint8 DIO_Lines;
+	uint8 DIO_Changed;
+	uint8 DIO_Sda;
+	
+	/* A stretched clock is released after a number of polls of the master */
+	if((DIO_SOFT_I2C_TEST_PORT == PortId) && (FALSE == Written) && (0 != DIO_SlavePtr->DIO_StretchLeft))
+	{
+		DIO_SlavePtr->DIO_StretchLeft--;
+		DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SCL, (0 != DIO_SlavePtr->DIO_StretchLeft) ? TRUE : FALSE);
+	}
+	else
+	{
+		/* Not stretching */
+	}
+	
+	DIO_Lines = (uint8)(HW_RegsModelGetPins(DIO_SOFT_I2C_TEST_PORT) & (DIO_SOFT_I2C_TEST_SCL | DIO_SOFT_I2C_TEST_SDA));
+	DIO_Changed = (uint8)(DIO_Lines ^ DIO_SlavePtr->DIO_Lines);
+	DIO_Sda = (0 != (DIO_Lines & DIO_SOFT_I2C_TEST_SDA)) ? 1 : 0;
+	DIO_SlavePtr->DIO_Lines = DIO_Lines;
+	
+	if((0 != (DIO_Changed & DIO_SOFT_I2C_TEST_SDA)) && (0 != (DIO_Lines & DIO_SOFT_I2C_TEST_SCL)) &&
+	   (0 == (DIO_Changed & DIO_SOFT_I2C_TEST_SCL)))
+	{
+		/* SDA changed while SCL is high */
+		if(0 == DIO_Sda)
+		{
+			DIO_SlavePtr->DIO_Starts++;
+			DIO_SlavePtr->DIO_State = DIO_SOFT_I2C_TEST_ADDRESS_BYTE;
+			DIO_SlavePtr->DIO_Clocks = 0;
+			DIO_SlavePtr->DIO_Byte = 0;
+		}
+		else
+		{
+			DIO_SlavePtr->DIO_Stops++;
+			DIO_SlavePtr->DIO_State = DIO_SOFT_I2C_TEST_IDLE;
+		}
+	}
+	else if(0 != (DIO_Changed & DIO_SOFT_I2C_TEST_SCL))
+	{
+		if(0 != (DIO_Lines & DIO_SOFT_I2C_TEST_SCL))
+		{
+			/* SCL rise, SDA is sampled */
+			if(DIO_SOFT_I2C_TEST_IDLE == DIO_SlavePtr->DIO_State)
+			{
+				/* Not addressed */
+			}
+			else if(DIO_SlavePtr->DIO_Clocks < 8)
+			{
+				DIO_SlavePtr->DIO_Byte = (uint8)((DIO_SlavePtr->DIO_Byte << 1) | DIO_Sda);
+				DIO_SlavePtr->DIO_Clocks++;
+			}
+			else if(DIO_SOFT_I2C_TEST_READ == DIO_SlavePtr->DIO_State)
+			{
+				/* Acknowledge of the master, the slave stops sending after a not acknowledged byte */
+				DIO_SlavePtr->DIO_Sent++;
+				DIO_SlavePtr->DIO_Acks += (0 == DIO_Sda) ? 1 : 0;
+				DIO_SlavePtr->DIO_State = (0 == DIO_Sda) ? DIO_SOFT_I2C_TEST_READ : DIO_SOFT_I2C_TEST_IDLE;
+				DIO_SlavePtr->DIO_Clocks++;
+			}
+			else
+			{
+				DIO_SlavePtr->DIO_Clocks++;
+			}
+		}
+		else
+		{
+			DioSoftI2cTest_Fall();
+		}
+	}
+	else
+	{
+		/* Lines unchanged */
+	}
+}
+
+/**
+ *	\brief		Puts the slave back on an idle bus.
+ *	\param[in] 	NackIndex: 	Written byte not acknowledged, DIO_SOFT_I2C_TEST_NO_NACK for none.
+ *	\param[in] 	Stretch: 	Reads of the port the clock is held low for after an acknowledge.
+ *	\param[in] 	StuckFalls: SCL falls SDA is held low for, 0 for none and 0xFF for ever.
+ *	\return		None.
+ */
+static void DioSoftI2cTest_Attach(uint8 NackIndex, uint16 Stretch, uint8 StuckFalls)
+{
+	/* Needed Variables */
+	DioSoftI2cTest_SlaveType* DIO_SlavePtr = &DioSoftI2cTest_Slave;
+	uint8 DIO_Index;
+	
+	DIO_SlavePtr->DIO_State = DIO_SOFT_I2C_TEST_IDLE;
+	DIO_SlavePtr->DIO_Clocks = 0;
+	DIO_SlavePtr->DIO_Byte = 0;
+	DIO_SlavePtr->DIO_NackIndex = NackIndex;
+	DIO_SlavePtr->DIO_Received = 0;
+	DIO_SlavePtr->DIO_Sent = 0;
+	DIO_SlavePtr->DIO_Acks = 0;
+	DIO_SlavePtr->DIO_Starts = 0;
+	DIO_SlavePtr->DIO_Stops = 0;
+	DIO_SlavePtr->DIO_Falls = 0;
+	DIO_SlavePtr->DIO_Stretch = Stretch;
+	DIO_SlavePtr->DIO_StretchLeft = 0;
+	DIO_SlavePtr->DIO_StuckFalls = StuckFalls;
+	for(DIO_Index = 0; DIO_Index < DIO_SOFT_I2C_TEST_LENGTH; DIO_Index++)
+	{
+		DIO_SlavePtr->DIO_Rx[DIO_Index] = 0;
+		DIO_SlavePtr->DIO_Tx[DIO_Index] = (uint8)(0xA5 ^ (DIO_Index * 0x3B));
+	}
+	DIO_SlavePtr->DIO_Pulled = 0;
+	DioSoftI2cTest_Pull(DIO_SOFT_I2C_TEST_SDA, (0 != StuckFalls) ? TRUE : FALSE);
+	DIO_SlavePtr->DIO_Lines = (uint8)(HW_RegsModelGetPins(DIO_SOFT_I2C_TEST_PORT) & (DIO_SOFT_I2C_TEST_SCL | DIO_SOFT_I2C_TEST_SDA));
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	/* Needed Variables */
+	Dio_SoftI2cConfigType DIO_Config = DioSoftI2cTest_Bus;
+	Dio_SoftI2cType DIO_I2c;
+	Std_ReturnType DIO_Result;
+	uint8 DIO_Tx[4] = {0x00, 0xFF, 0x5A, 0x81};
+	uint8 DIO_Rx[4] = {0, 0, 0, 0};
+	uint8 DIO_Index;
+	boolean DIO_Match;
+	
+	HW_RegsModelReset();
+	Port_Init(&DioSoftI2cTest_Config);
+	HW_RegsModelSetPinsHook(DioSoftI2cTest_Hook);
+	
+	/* Free bus */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0);
+	DIO_Result = Dio_SoftI2cInit(&DIO_I2c, &DioSoftI2cTest_Bus);
+	Test_Check(((E_OK == DIO_Result) && (0 == DioSoftI2cTest_Slave.DIO_Starts) && (1 == DioSoftI2cTest_Slave.DIO_Stops) &&
+				((DIO_SOFT_I2C_TEST_SCL | DIO_SOFT_I2C_TEST_SDA) == DioSoftI2cTest_Slave.DIO_Lines)) ? TRUE : FALSE,
+			   "init of a free bus sends a STOP");
+	
+	/* Write */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, DIO_Tx, 4, NULL_PTR, 0);
+	DIO_Match = (4 == DioSoftI2cTest_Slave.DIO_Received) ? TRUE : FALSE;
+	for(DIO_Index = 0; DIO_Index < 4; DIO_Index++)
+	{
+		DIO_Match = (DIO_Tx[DIO_Index] == DioSoftI2cTest_Slave.DIO_Rx[DIO_Index]) ? DIO_Match : FALSE;
+	}
+	Test_Check(((E_OK == DIO_Result) && (TRUE == DIO_Match)) ? TRUE : FALSE, "write: bytes acknowledged");
+	Test_Check(((1 == DioSoftI2cTest_Slave.DIO_Starts) && (1 == DioSoftI2cTest_Slave.DIO_Stops) &&
+				(0 == DioSoftI2cTest_Slave.DIO_Sent) && (46 == DioSoftI2cTest_Slave.DIO_Falls)) ? TRUE : FALSE,
+			   "write: START, 5 bytes, STOP");
+	
+	/* Write then read, the master acknowledges all read bytes but the last one */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, &DIO_Tx[2], 1, DIO_Rx, 4);
+	DIO_Match = ((0x5A == DioSoftI2cTest_Slave.DIO_Rx[0]) && (1 == DioSoftI2cTest_Slave.DIO_Received)) ? TRUE : FALSE;
+	for(DIO_Index = 0; DIO_Index < 4; DIO_Index++)
+	{
+		DIO_Match = (DioSoftI2cTest_Slave.DIO_Tx[DIO_Index] == DIO_Rx[DIO_Index]) ? DIO_Match : FALSE;
+	}
+	Test_Check(((E_OK == DIO_Result) && (TRUE == DIO_Match)) ? TRUE : FALSE, "write then read: bytes both ways");
+	Test_Check(((2 == DioSoftI2cTest_Slave.DIO_Starts) && (1 == DioSoftI2cTest_Slave.DIO_Stops) &&
+				(4 == DioSoftI2cTest_Slave.DIO_Sent) && (3 == DioSoftI2cTest_Slave.DIO_Acks)) ? TRUE : FALSE,
+			   "write then read: repeated START, last byte not acknowledged");
+	
+	/* Read only */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, NULL_PTR, 0, DIO_Rx, 1);
+	Test_Check(((E_OK == DIO_Result) && (DioSoftI2cTest_Slave.DIO_Tx[0] == DIO_Rx[0]) &&
+				(1 == DioSoftI2cTest_Slave.DIO_Starts) && (0 == DioSoftI2cTest_Slave.DIO_Received) &&
+				(1 == DioSoftI2cTest_Slave.DIO_Sent) && (0 == DioSoftI2cTest_Slave.DIO_Acks)) ? TRUE : FALSE,
+			   "read only");
+	
+	/* Address only, present then absent */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, NULL_PTR, 0, NULL_PTR, 0);
+	Test_Check(((E_OK == DIO_Result) && (1 == DioSoftI2cTest_Slave.DIO_Stops)) ? TRUE : FALSE,
+			   "address acknowledged");
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS + 1, DIO_Tx, 4, DIO_Rx, 4);
+	Test_Check(((E_NOT_OK == DIO_Result) && (1 == DioSoftI2cTest_Slave.DIO_Starts) &&
+				(1 == DioSoftI2cTest_Slave.DIO_Stops) && (0 == DioSoftI2cTest_Slave.DIO_Received) &&
+				(10 == DioSoftI2cTest_Slave.DIO_Falls)) ? TRUE : FALSE, "address not acknowledged: stopped");
+	
+	/* Written byte not acknowledged */
+	DioSoftI2cTest_Attach(2, 0, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, DIO_Tx, 4, DIO_Rx, 4);
+	Test_Check(((E_NOT_OK == DIO_Result) && (3 == DioSoftI2cTest_Slave.DIO_Received) &&
+				(1 == DioSoftI2cTest_Slave.DIO_Starts) && (1 == DioSoftI2cTest_Slave.DIO_Stops) &&
+				(0 == DioSoftI2cTest_Slave.DIO_Sent)) ? TRUE : FALSE, "byte not acknowledged: stopped");
+	
+	/* Clock stretching */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, DIO_SOFT_I2C_TEST_LIMIT - 1, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, DIO_Tx, 2, DIO_Rx, 2);
+	Test_Check(((E_OK == DIO_Result) && (2 == DioSoftI2cTest_Slave.DIO_Received) && (0x00 == DioSoftI2cTest_Slave.DIO_Rx[0]) &&
+				(0xFF == DioSoftI2cTest_Slave.DIO_Rx[1]) && (DioSoftI2cTest_Slave.DIO_Tx[1] == DIO_Rx[1]) &&
+				(1 == DioSoftI2cTest_Slave.DIO_Stops)) ? TRUE : FALSE, "clock stretched below the limit");
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, DIO_SOFT_I2C_TEST_LIMIT, 0);
+	DIO_Result = Dio_SoftI2cTransfer(&DIO_I2c, DIO_SOFT_I2C_TEST_ADDRESS, DIO_Tx, 2, DIO_Rx, 2);
+	Test_Check(((E_NOT_OK == DIO_Result) && (0 == DioSoftI2cTest_Slave.DIO_Received) &&
+				(1 == DioSoftI2cTest_Slave.DIO_Stops)) ? TRUE : FALSE, "clock stretched to the limit: timeout");
+	
+	/* Bus recovery */
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 3);
+	DIO_Result = Dio_SoftI2cInit(&DIO_I2c, &DioSoftI2cTest_Bus);
+	Test_Check(((E_OK == DIO_Result) && (4 == DioSoftI2cTest_Slave.DIO_Falls) && (1 == DioSoftI2cTest_Slave.DIO_Stops)) ?
+			   TRUE : FALSE, "SDA held for 3 clocks: recovered");
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 9);
+	DIO_Result = Dio_SoftI2cInit(&DIO_I2c, &DioSoftI2cTest_Bus);
+	Test_Check(((E_OK == DIO_Result) && (1 == DioSoftI2cTest_Slave.DIO_Stops)) ? TRUE : FALSE,
+			   "SDA held for 9 clocks: recovered");
+	DioSoftI2cTest_Attach(DIO_SOFT_I2C_TEST_NO_NACK, 0, 0xFF);
+	DIO_Result = Dio_SoftI2cInit(&DIO_I2c, &DioSoftI2cTest_Bus);
+	Test_Check(((E_NOT_OK == DIO_Result) && (9 == DioSoftI2cTest_Slave.DIO_Falls)) ? TRUE : FALSE,
+			   "SDA held for ever: bus busy");
+	
+	/* Rejections */
+	DIO_Config.Dio_Scl = 0x60;
+	Test_Check((E_NOT_OK == Dio_SoftI2cInit(&DIO_I2c, &DIO_Config)) ? TRUE : FALSE, "missing port rejected");
+	DIO_Config = DioSoftI2cTest_Bus;
+	DIO_Config.Dio_Sda = 0x48;
+	Test_Check((E_NOT_OK == Dio_SoftI2cInit(&DIO_I2c, &DIO_Config)) ? TRUE : FALSE, "missing pin rejected");
+	Test_Check(((E_NOT_OK == Dio_SoftI2cInit(NULL_PTR, &DioSoftI2cTest_Bus)) &&
+				(E_NOT_OK == Dio_SoftI2cInit(&DIO_I2c, NULL_PTR))) ? TRUE : FALSE, "NULL pointers rejected");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "no faulty access");
+	
+	return Test_Summary();
+}
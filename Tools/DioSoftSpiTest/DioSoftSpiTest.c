@@ -0,0 +1,394 @@
+/**
+ *  \file	DioSoftSpiTest.c
+ *  \brief 	Host functional test of the soft SPI (DioSoftSpi.h) against a pin-level slave
+ *  		modelled on the register model (TivaRegsModel.h): the slave sees every store of
+ *  		the master through the pins hook, samples MOSI and shifts MISO on the clock edges
+ *  		of the SPI mode, as a device on the pins would.
+ *  		-	Modes 0 to 3, MSB and LSB first, with MOSI and SCK joined on port B (one store
+ *  			sets the data and its clock edge) and split on ports E and B: the bytes both
+ *  			ways, SCK idle when CS changes, 16 edges per byte and MOSI never changed by
+ *  			the store of the edge the slave samples it on.
+ *  		-	NULL_PTR transmit (0xFF sent) and receive buffers, no MISO.
+ *  		-	A DIO write of a pin driven by a transfer reaches the port.
+ *  		-	The rejected configurations.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioSoftSpiTest/DioSoftSpiTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioSoftSpi.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioSoftSpiTest
+ *  		./DioSoftSpiTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioSoftSpi.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+#if(DioSoftSpiApi != STD_ON)
+#error "DioSoftSpiTest needs DioSoftSpiApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_SOFT_SPI_TEST_LENGTH	32		/*!< Bytes of a frame */
+#define DIO_SOFT_SPI_TEST_NAME_SIZE	64		/*!< Characters of a check name */
+
+/* Port and pin of a channel */
+#define DIO_SOFT_SPI_TEST_PORT(CHANNEL)	(uint8)((CHANNEL) >> 4)
+#define DIO_SOFT_SPI_TEST_PIN(CHANNEL)	(uint8)((CHANNEL) & 0x07)
+
+/* Defined data types */
+typedef struct{
+	const Dio_SoftSpiConfigType*	DIO_ConfigPtr;	/*!< Master configuration the slave follows */
+	uint8	DIO_Sck;			/*!< Last SCK level */
+	uint8	DIO_Cs;				/*!< Last CS level */
+	uint8	DIO_Mosi;			/*!< Last MOSI level */
+	uint8	DIO_Bit;			/*!< Bit of the byte on the wire, in wire order */
+	uint8	DIO_Rx;				/*!< Byte being received */
+	uint16	DIO_Index;			/*!< Byte of the frame */
+	uint16	DIO_Edges;			/*!< SCK edges while CS is low */
+	uint16	DIO_Races;			/*!< Sampling edges stored together with a MOSI change */
+	uint16	DIO_BusyCs;			/*!< CS edges while SCK isn't idle */
+	uint8	DIO_Tx[DIO_SOFT_SPI_TEST_LENGTH + 1];	/*!< Bytes sent by the slave */
+	uint8	DIO_Received[DIO_SOFT_SPI_TEST_LENGTH];	/*!< Bytes received by the slave */
+}DioSoftSpiTest_SlaveType;	/*!< Pin-level SPI slave */
+
+/* Private Variables */
+static const Port_PinConfigType DioSoftSpiTest_Pins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B5, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E2, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Joined SPI on B0 .. B3, split SPI on B4, E1, E2 and B5, B6 held high by the application */
+
+static const Port_ConfigType DioSoftSpiTest_Config = {
+	DioSoftSpiTest_Pins,
+	(uint8)(sizeof(DioSoftSpiTest_Pins) / sizeof(DioSoftSpiTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the pins */
+
+static DioSoftSpiTest_SlaveType DioSoftSpiTest_Slave;	/*!< Slave on the pins */
+static uint32 DioSoftSpiTest_Seed = 5;					/*!< State of the bytes generator */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Returns the next pseudo random byte.
+ *	\param		None.
+ *	\return		uint8: 	Pseudo random byte.
+ */
+static uint8 DioSoftSpiTest_Random(void);
+
+/**
+ *	\brief		Level of the pin of a channel.
+ *	\param[in] 	Channel: 	Channel of the pin.
+ *	\return		uint8: 		Level, 0 or 1.
+ */
+static uint8 DioSoftSpiTest_Level(uint8 Channel);
+
+/**
+ *	\brief		Drives MISO with the wire bit of the byte the slave sends.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioSoftSpiTest_Shift(void);
+
+/**
+ *	\brief		Pins hook: the slave follows CS and the SCK edges after every store of the master.
+ *	\param[in] 	PortId: 	ID of the accessed port.
+ *	\param[in] 	Written: 	TRUE for a store.
+ *	\return		None.
+ */
+static void DioSoftSpiTest_Hook(uint8 PortId, boolean Written);
+
+/**
+ *	\brief		Attaches the slave to a configuration and initializes the master with it.
+ *	\param[in] 	ConfigPtr: 	Master configuration.
+ *	\param[out] SpiPtr: 	Decoded soft SPI.
+ *	\return		Std_ReturnType: 	Result of Dio_SoftSpiInit().
+ */
+static Std_ReturnType DioSoftSpiTest_Attach(const Dio_SoftSpiConfigType* ConfigPtr, Dio_SoftSpiType* SpiPtr);
+
+/**
+ *	\brief		Transfers a frame of random bytes in every mode and order of a pins set.
+ *	\param[in] 	ConfigPtr: 	Pins set, its mode and order are overwritten.
+ *	\param[in] 	Pins: 		Name of the pins set.
+ *	\return		None.
+ */
+static void DioSoftSpiTest_Frames(const Dio_SoftSpiConfigType* ConfigPtr, const char* Pins);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Returns the next pseudo random byte.
+ *	\param		None.
+ *	\return		uint8: 	Pseudo random byte.
+ */
+static uint8 DioSoftSpiTest_Random(void)
+{
+	DioSoftSpiTest_Seed = (DioSoftSpiTest_Seed * 1103515245u + 12345u) & 0x7FFFFFFFu;
+	
+	return (uint8)(DioSoftSpiTest_Seed >> 16);
+}
+
+/**
+ *	\brief		Level of the pin of a channel.
+ *	\param[in] 	Channel: 	Channel of the pin.
+ *	\return		uint8: 		Level, 0 or 1.
+ */
+static uint8 DioSoftSpiTest_Level(uint8 Channel)
+{
+	return (uint8)((HW_RegsModelGetPins(DIO_SOFT_SPI_TEST_PORT(Channel)) >> DIO_SOFT_SPI_TEST_PIN(Channel)) & 0x01);
+}
+
+/**
+ *	\brief		Drives MISO with the wire bit of the byte the slave sends.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioSoftSpiTest_Shift(void)
+{
+	/* Needed Variables */
+	DioSoftSpiTest_SlaveType* DIO_SlavePtr = &DioSoftSpiTest_Slave;
+	uint8 DIO_Miso = DIO_SlavePtr->DIO_ConfigPtr->Dio_Miso;
+	uint8 DIO_Byte = DIO_SlavePtr->DIO_Tx[DIO_SlavePtr->DIO_Index];
+	uint8 DIO_Level;
+	
+	DIO_Level = (TRUE == DIO_SlavePtr->DIO_ConfigPtr->Dio_LsbFirst) ? (uint8)((DIO_Byte >> DIO_SlavePtr->DIO_Bit) & 0x01) :
+																	  (uint8)((DIO_Byte >> (7 - DIO_SlavePtr->DIO_Bit)) & 0x01);
+	if(DIO_SOFT_SPI_NO_PIN != DIO_Miso)
+	{
+		HW_RegsModelDrivePins(DIO_SOFT_SPI_TEST_PORT(DIO_Miso), (uint8)(1 << DIO_SOFT_SPI_TEST_PIN(DIO_Miso)),
+							  (uint8)(DIO_Level << DIO_SOFT_SPI_TEST_PIN(DIO_Miso)));
+	}
+	else
+	{
+		/* Nothing sent back */
+	}
+}
+
+/**
+ *	\brief		Pins hook: the slave follows CS and the SCK edges after every store of the master.
+ *	\param[in] 	PortId: 	ID of the accessed port.
+ *	\param[in] 	Written: 	TRUE for a store.
+ *	\return		None.
+ */
+static void DioSoftSpiTest_Hook(uint8 PortId, boolean Written)
+{
+	/* Needed Variables */
+	DioSoftSpiTest_SlaveType* DIO_SlavePtr = &DioSoftSpiTest_Slave;
+	const Dio_SoftSpiConfigType* DIO_ConfigPtr = DIO_SlavePtr->DIO_ConfigPtr;
+	uint8 DIO_Idle = (uint8)((DIO_ConfigPtr->Dio_Mode >> 1) & 0x01);
+	boolean DIO_Phase = (0 != (DIO_ConfigPtr->Dio_Mode & 0x01)) ? TRUE : FALSE;
+	uint8 DIO_Sck = DioSoftSpiTest_Level(DIO_ConfigPtr->Dio_Sck);
+	uint8 DIO_Cs = DioSoftSpiTest_Level(DIO_ConfigPtr->Dio_Cs);
+	uint8 DIO_Mosi = DioSoftSpiTest_Level(DIO_ConfigPtr->Dio_Mosi);
+	boolean DIO_Leading;
+	
+	(void)PortId;
+	if(TRUE == Written)
+	{
+		if(DIO_Cs != DIO_SlavePtr->DIO_Cs)
+		{
+			DIO_SlavePtr->DIO_BusyCs += (DIO_Sck != DIO_Idle) ? 1 : 0;
+			if(0 == DIO_Cs)
+			{
+				/* Frame start, with a clock phase of 0 the first bit is out before the first edge */
+				DIO_SlavePtr->DIO_Bit = 0;
+				DIO_SlavePtr->DIO_Rx = 0;
+				DIO_SlavePtr->DIO_Index = 0;
+				DIO_SlavePtr->DIO_Edges = 0;
+				DioSoftSpiTest_Shift();
+			}
+			else
+			{
+				/* Frame end */
+			}
+		}
+		else if((0 == DIO_Cs) && (DIO_Sck != DIO_SlavePtr->DIO_Sck))
+		{
+			DIO_SlavePtr->DIO_Edges++;
+			DIO_Leading = (DIO_Sck != DIO_Idle) ? TRUE : FALSE;
+			if(DIO_Leading != DIO_Phase)
+			{
+				/* Sampling edge, MOSI has to be set up by an earlier store */
+				DIO_SlavePtr->DIO_Races += (DIO_Mosi != DIO_SlavePtr->DIO_Mosi) ? 1 : 0;
+				DIO_SlavePtr->DIO_Rx |= (TRUE == DIO_ConfigPtr->Dio_LsbFirst) ? (uint8)(DIO_Mosi << DIO_SlavePtr->DIO_Bit) :
+																				(uint8)(DIO_Mosi << (7 - DIO_SlavePtr->DIO_Bit));
+				DIO_SlavePtr->DIO_Bit++;
+				if(8 == DIO_SlavePtr->DIO_Bit)
+				{
+					DIO_SlavePtr->DIO_Received[DIO_SlavePtr->DIO_Index % DIO_SOFT_SPI_TEST_LENGTH] = DIO_SlavePtr->DIO_Rx;
+					DIO_SlavePtr->DIO_Index++;
+					DIO_SlavePtr->DIO_Bit = 0;
+					DIO_SlavePtr->DIO_Rx = 0;
+				}
+				else
+				{
+					/* Byte not complete */
+				}
+			}
+			else
+			{
+				/* Shifting edge, the next bit goes out */
+				DioSoftSpiTest_Shift();
+			}
+		}
+		else
+		{
+			/* Nothing for the slave */
+		}
+	}
+	else
+	{
+		/* The master reads MISO */
+	}
+	DIO_SlavePtr->DIO_Sck = DIO_Sck;
+	DIO_SlavePtr->DIO_Cs = DIO_Cs;
+	DIO_SlavePtr->DIO_Mosi = DIO_Mosi;
+}
+
+/**
+ *	\brief		Attaches the slave to a configuration and initializes the master with it.
+ *	\param[in] 	ConfigPtr: 	Master configuration.
+ *	\param[out] SpiPtr: 	Decoded soft SPI.
+ *	\return		Std_ReturnType: 	Result of Dio_SoftSpiInit().
+ */
+static Std_ReturnType DioSoftSpiTest_Attach(const Dio_SoftSpiConfigType* ConfigPtr, Dio_SoftSpiType* SpiPtr)
+{
+	DioSoftSpiTest_Slave.DIO_ConfigPtr = ConfigPtr;
+	DioSoftSpiTest_Slave.DIO_Sck = DioSoftSpiTest_Level(ConfigPtr->Dio_Sck);
+	DioSoftSpiTest_Slave.DIO_Cs = 1;
+	DioSoftSpiTest_Slave.DIO_Mosi = DioSoftSpiTest_Level(ConfigPtr->Dio_Mosi);
+	DioSoftSpiTest_Slave.DIO_Races = 0;
+	DioSoftSpiTest_Slave.DIO_BusyCs = 0;
+	HW_RegsModelSetPinsHook(DioSoftSpiTest_Hook);
+	
+	return Dio_SoftSpiInit(SpiPtr, ConfigPtr);
+}
+
+/**
+ *	\brief		Transfers a frame of random bytes in every mode and order of a pins set.
+ *	\param[in] 	ConfigPtr: 	Pins set, its mode and order are overwritten.
+ *	\param[in] 	Pins: 		Name of the pins set.
+ *	\return		None.
+ */
+static void DioSoftSpiTest_Frames(const Dio_SoftSpiConfigType* ConfigPtr, const char* Pins)
+{
+	/* Needed Variables */
+	Dio_SoftSpiConfigType DIO_Config = *ConfigPtr;
+	Dio_SoftSpiType DIO_Spi;
+	uint8 DIO_Tx[DIO_SOFT_SPI_TEST_LENGTH];
+	uint8 DIO_Rx[DIO_SOFT_SPI_TEST_LENGTH];
+	char DIO_Name[DIO_SOFT_SPI_TEST_NAME_SIZE];
+	boolean DIO_Match;
+	uint8 DIO_Order;
+	uint8 DIO_Index;
+	
+	for(DIO_Order = 0; DIO_Order < 8; DIO_Order++)
+	{
+		DIO_Config.Dio_Mode = (Dio_SoftSpiModeType)(DIO_Order >> 1);
+		DIO_Config.Dio_LsbFirst = (0 != (DIO_Order & 0x01)) ? TRUE : FALSE;
+		(void)DioSoftSpiTest_Attach(&DIO_Config, &DIO_Spi);
+		for(DIO_Index = 0; DIO_Index < DIO_SOFT_SPI_TEST_LENGTH; DIO_Index++)
+		{
+			DIO_Tx[DIO_Index] = DioSoftSpiTest_Random();
+			DioSoftSpiTest_Slave.DIO_Tx[DIO_Index] = DioSoftSpiTest_Random();
+		}
+		Dio_SoftSpiTransfer(&DIO_Spi, DIO_Tx, DIO_Rx, DIO_SOFT_SPI_TEST_LENGTH);
+	
+		DIO_Match = (DIO_SOFT_SPI_TEST_LENGTH == DioSoftSpiTest_Slave.DIO_Index) ? TRUE : FALSE;
+		for(DIO_Index = 0; DIO_Index < DIO_SOFT_SPI_TEST_LENGTH; DIO_Index++)
+		{
+			DIO_Match = ((DIO_Rx[DIO_Index] == DioSoftSpiTest_Slave.DIO_Tx[DIO_Index]) &&
+						 (DIO_Tx[DIO_Index] == DioSoftSpiTest_Slave.DIO_Received[DIO_Index])) ? DIO_Match : FALSE;
+		}
+		(void)snprintf(DIO_Name, sizeof(DIO_Name), "%s mode %u %s first: bytes both ways", Pins,
+					   DIO_Config.Dio_Mode, (TRUE == DIO_Config.Dio_LsbFirst) ? "LSB" : "MSB");
+		Test_Check(DIO_Match, DIO_Name);
+	
+		(void)snprintf(DIO_Name, sizeof(DIO_Name), "%s mode %u %s first: clock and setup", Pins,
+					   DIO_Config.Dio_Mode, (TRUE == DIO_Config.Dio_LsbFirst) ? "LSB" : "MSB");
+		Test_Check(((0 == DioSoftSpiTest_Slave.DIO_Races) && (0 == DioSoftSpiTest_Slave.DIO_BusyCs) &&
+					((16 * DIO_SOFT_SPI_TEST_LENGTH) == DioSoftSpiTest_Slave.DIO_Edges) &&
+					(1 == DioSoftSpiTest_Level(DIO_Config.Dio_Cs)) &&
+					(1 == DioSoftSpiTest_Level(DIO_CHANNEL_B6))) ? TRUE : FALSE, DIO_Name);
+	}
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	/* Needed Variables */
+	const Dio_SoftSpiConfigType DIO_Joined = {
+		DIO_CHANNEL_B0, DIO_CHANNEL_B1, DIO_CHANNEL_B2, DIO_CHANNEL_B3, DIO_SOFT_SPI_MODE_0, FALSE
+	};
+	const Dio_SoftSpiConfigType DIO_Split = {
+		DIO_CHANNEL_B4, DIO_CHANNEL_E1, DIO_CHANNEL_E2, DIO_CHANNEL_B5, DIO_SOFT_SPI_MODE_0, FALSE
+	};
+	Dio_SoftSpiConfigType DIO_Config = DIO_Joined;
+	Dio_SoftSpiType DIO_Spi;
+	uint8 DIO_Rx[4] = {0x55, 0x55, 0x55, 0x55};
+	uint8 DIO_Tx[4] = {0x12, 0x34, 0x56, 0x78};
+	
+	/* Reset once, the DIO shadow doesn't follow a reset of the model */
+	HW_RegsModelReset();
+	Port_Init(&DioSoftSpiTest_Config);
+	Dio_WriteChannel(DIO_CHANNEL_B6, STD_HIGH);
+	HW_RegsModelSetPinsHook(DioSoftSpiTest_Hook);
+	
+	DioSoftSpiTest_Frames(&DIO_Joined, "joined");
+	DioSoftSpiTest_Frames(&DIO_Split, "split");
+	
+	/* Nothing to send sends 0xFF, a NULL receive buffer drops the bytes */
+	(void)DioSoftSpiTest_Attach(&DIO_Joined, &DIO_Spi);
+	DioSoftSpiTest_Slave.DIO_Tx[0] = 0xC3;
+	DioSoftSpiTest_Slave.DIO_Tx[1] = 0x3C;
+	Dio_SoftSpiTransfer(&DIO_Spi, NULL_PTR, DIO_Rx, 2);
+	Test_Check(((0xFF == DioSoftSpiTest_Slave.DIO_Received[0]) && (0xFF == DioSoftSpiTest_Slave.DIO_Received[1]) &&
+				(0xC3 == DIO_Rx[0]) && (0x3C == DIO_Rx[1])) ? TRUE : FALSE, "NULL transmit buffer sends 0xFF");
+	Dio_SoftSpiTransfer(&DIO_Spi, DIO_Tx, NULL_PTR, 1);
+	Test_Check((0x12 == DioSoftSpiTest_Slave.DIO_Received[0]) ? TRUE : FALSE, "NULL receive buffer");
+	
+	/* Without MISO the bytes are still sent and 0 is received */
+	DIO_Config.Dio_Miso = DIO_SOFT_SPI_NO_PIN;
+	(void)DioSoftSpiTest_Attach(&DIO_Config, &DIO_Spi);
+	Dio_SoftSpiTransfer(&DIO_Spi, DIO_Tx, DIO_Rx, 4);
+	Test_Check(((0x78 == DioSoftSpiTest_Slave.DIO_Received[3]) && (0 == DIO_Rx[0]) && (0 == DIO_Rx[3])) ? TRUE : FALSE,
+			   "without MISO");
+	
+	/* The engine stores behind the DIO shadow, a DIO write of MOSI after a frame ending with a 1 has to reach the pin */
+	(void)DioSoftSpiTest_Attach(&DIO_Split, &DIO_Spi);
+	Dio_WriteChannel(DIO_CHANNEL_E1, STD_LOW);
+	DIO_Tx[0] = 0x01;
+	Dio_SoftSpiTransfer(&DIO_Spi, DIO_Tx, DIO_Rx, 1);
+	DIO_Rx[0] = DioSoftSpiTest_Level(DIO_CHANNEL_E1);
+	Dio_WriteChannel(DIO_CHANNEL_E1, STD_LOW);
+	Test_Check(((1 == DIO_Rx[0]) && (0 == DioSoftSpiTest_Level(DIO_CHANNEL_E1))) ? TRUE : FALSE,
+			   "DIO writes after a transfer reach the pins");
+	
+	/* Rejections */
+	DIO_Config = DIO_Joined;
+	DIO_Config.Dio_Mode = 4;
+	Test_Check((E_NOT_OK == Dio_SoftSpiInit(&DIO_Spi, &DIO_Config)) ? TRUE : FALSE, "bad mode rejected");
+	DIO_Config = DIO_Joined;
+	DIO_Config.Dio_Mosi = 0x60;
+	Test_Check((E_NOT_OK == Dio_SoftSpiInit(&DIO_Spi, &DIO_Config)) ? TRUE : FALSE, "missing port rejected");
+	DIO_Config = DIO_Joined;
+	DIO_Config.Dio_Cs = 0x18;
+	Test_Check((E_NOT_OK == Dio_SoftSpiInit(&DIO_Spi, &DIO_Config)) ? TRUE : FALSE, "missing pin rejected");
+	Test_Check(((E_NOT_OK == Dio_SoftSpiInit(NULL_PTR, &DIO_Joined)) && (E_NOT_OK == Dio_SoftSpiInit(&DIO_Spi, NULL_PTR))) ?
+			   TRUE : FALSE, "NULL pointers rejected");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "no faulty access");
+	
+	return Test_Summary();
+}
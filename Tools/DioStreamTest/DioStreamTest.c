@@ -0,0 +1,348 @@
+/**
+ *  \file	DioStreamTest.c
+ *  \brief 	Host functional test of the DIO stream (DioStream.h) on the register model and its
+ *  		uDMA model (TivaRegsModel.h, TivaUdmaModel.h). The timer requests are raised with
+ *  		HW_UdmaModelRequest() and the pins are compared after every request with the images
+ *  		queued so far:
+ *  		-	Ping-pong refill: the notification refills and queues every played buffer, with
+ *  			the completion handler called after every request then delayed by up to 5 requests.
+ *  		-	Underrun: the buffers requeued late by the task, the stream holds its last image
+ *  			and goes on with the next image once queued.
+ *  		-	End of stream: the last buffers given back in order, the channel stopped.
+ *  		-	Stop and the start / queue rejections.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/DioStreamTest/DioStreamTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/DIO/DioStream.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o DioStreamTest
+ *  		./DioStreamTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "DioStream.h"
+#include "TivaRegsModel.h"
+#include "TivaUdmaModel.h"
+#include "TestHarness.h"
+
+#if(DioStreamApi != STD_ON)
+#error "DioStreamTest needs DioStreamApi (DioGeneral.h)"
+#endif
+
+/* Macros */
+#define DIO_STREAM_TEST_LENGTH	7		/*!< Images of a buffer */
+#define DIO_STREAM_TEST_MASK	0x3F	/*!< Streamed pins, B0 .. B5 */
+#define DIO_STREAM_TEST_BUFFERS	200		/*!< Buffers played by the ping-pong runs */
+
+/* Private Variables */
+static const Port_PinConfigType DioStreamTest_Pins[] = {
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B5, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Port B outputs, B0 .. B5 streamed, B6 and B7 kept by the application */
+
+static const Port_ConfigType DioStreamTest_Config = {
+	DioStreamTest_Pins,
+	(uint8)(sizeof(DioStreamTest_Pins) / sizeof(DioStreamTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration of the outputs */
+
+static void DioStreamTest_Notification(const Dio_PortLevelType* ImagesPtr);
+
+static const Dio_StreamConfigType DioStreamTest_Stream = {
+	DIO_PORTB, DIO_STREAM_TEST_MASK, DioStreamTest_Notification
+};	/*!< Stream of B0 .. B5 */
+
+static Dio_PortLevelType DioStreamTest_Buffers[2][DIO_STREAM_TEST_LENGTH];	/*!< Ping-pong buffers of the test */
+static uint32 DioStreamTest_Queued;		/*!< Images queued since the start */
+static uint32 DioStreamTest_Played;		/*!< Images seen on the pins since the start */
+static uint32 DioStreamTest_Limit;		/*!< Images the notification may queue in total */
+static uint32 DioStreamTest_Returned;	/*!< Buffers given back by the notification */
+static uint32 DioStreamTest_Idle;		/*!< Requests moving no image */
+static boolean DioStreamTest_Refill;	/*!< The notification refills the played buffer */
+static boolean DioStreamTest_InOrder;	/*!< Every image and buffer came back in order */
+static boolean DioStreamTest_Kept;		/*!< B6 and B7 kept their levels */
+static uint32 DioStreamTest_Seed = 7;	/*!< State of the delays generator */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Image number Index of the stream.
+ *	\param[in] 	Index: 		Index of the image since the start.
+ *	\return		Dio_PortLevelType: 	Image, every bit changes within a few images.
+ */
+static Dio_PortLevelType DioStreamTest_Image(uint32 Index);
+
+/**
+ *	\brief		Fills a buffer with the next images and queues it.
+ *	\param[in] 	Buffer: 	Buffer, 0 or 1.
+ *	\return		Std_ReturnType: 	Result of Dio_StreamQueue().
+ */
+static Std_ReturnType DioStreamTest_Queue(uint8 Buffer);
+
+/**
+ *	\brief		Raises timer requests, compares the pins after every moved image and calls the
+ *				completion handler after a random number of requests.
+ *	\param[in] 	Requests: 	Number of requests.
+ *	\param[in] 	MaxDelay: 	Most requests between two calls of the completion handler, 1 to call it every request.
+ *	\return		None.
+ */
+static void DioStreamTest_Play(uint32 Requests, uint8 MaxDelay);
+
+/**
+ *	\brief		Restarts the register model, the outputs, the controller and the stream.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioStreamTest_Restart(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Image number Index of the stream.
+ *	\param[in] 	Index: 		Index of the image since the start.
+ *	\return		Dio_PortLevelType: 	Image, every bit changes within a few images.
+ */
+static Dio_PortLevelType DioStreamTest_Image(uint32 Index)
+{
+	return (Dio_PortLevelType)((Index * 0x9D) ^ (Index >> 3));
+}
+
+/**
+ *	\brief		Fills a buffer with the next images and queues it.
+ *	\param[in] 	Buffer: 	Buffer, 0 or 1.
+ *	\return		Std_ReturnType: 	Result of Dio_StreamQueue().
+ */
+static Std_ReturnType DioStreamTest_Queue(uint8 Buffer)
+{
+	/* Needed Variables */
+	Std_ReturnType DIO_RetData;
+	uint8 DIO_Image;
+	
+	for(DIO_Image = 0; DIO_Image < DIO_STREAM_TEST_LENGTH; DIO_Image++)
+	{
+		DioStreamTest_Buffers[Buffer][DIO_Image] = DioStreamTest_Image(DioStreamTest_Queued + DIO_Image);
+	}
+	DIO_RetData = Dio_StreamQueue(DioStreamTest_Buffers[Buffer], DIO_STREAM_TEST_LENGTH);
+	if(E_OK == DIO_RetData)
+	{
+		DioStreamTest_Queued += DIO_STREAM_TEST_LENGTH;
+	}
+	else
+	{
+		/* Nothing queued */
+	}
+	
+	return DIO_RetData;
+}
+
+/**
+ *	\brief		Notification of a played buffer, checks the buffers come back in order and
+ *				refills the played one while the limit isn't reached.
+ *	\param[in] 	ImagesPtr: 	Played buffer.
+ *	\return		None.
+ */
+static void DioStreamTest_Notification(const Dio_PortLevelType* ImagesPtr)
+{
+	/* Needed Variables */
+	uint8 DIO_Buffer = (uint8)(DioStreamTest_Returned & 0x01);
+	
+	if(ImagesPtr != DioStreamTest_Buffers[DIO_Buffer])
+	{
+		DioStreamTest_InOrder = FALSE;
+	}
+	else
+	{
+		/* Buffers alternate */
+	}
+	DioStreamTest_Returned++;
+	
+	if((TRUE == DioStreamTest_Refill) && (DioStreamTest_Queued < DioStreamTest_Limit))
+	{
+		if(E_OK != DioStreamTest_Queue(DIO_Buffer))
+		{
+			DioStreamTest_InOrder = FALSE;
+		}
+		else
+		{
+			/* Queued from the notification */
+		}
+	}
+	else
+	{
+		/* The task refills it or the stream ends */
+	}
+}
+
+/**
+ *	\brief		Raises timer requests, compares the pins after every moved image and calls the
+ *				completion handler after a random number of requests.
+ *	\param[in] 	Requests: 	Number of requests.
+ *	\param[in] 	MaxDelay: 	Most requests between two calls of the completion handler, 1 to call it every request.
+ *	\return		None.
+ */
+static void DioStreamTest_Play(uint32 Requests, uint8 MaxDelay)
+{
+	/* Needed Variables */
+	uint8 DIO_Delay = 1;
+	uint8 DIO_Pins;
+	
+	while(0 != Requests--)
+	{
+		if(0 != HW_UdmaModelRequest(DioStreamDmaChannel))
+		{
+			DIO_Pins = HW_RegsModelGetPins(DIO_PORTB);
+			if((DIO_Pins & DIO_STREAM_TEST_MASK) != (DioStreamTest_Image(DioStreamTest_Played) & DIO_STREAM_TEST_MASK))
+			{
+				DioStreamTest_InOrder = FALSE;
+			}
+			else
+			{
+				/* Next image */
+			}
+			DioStreamTest_Kept = (0x80 == (DIO_Pins & 0xC0)) ? DioStreamTest_Kept : FALSE;
+			DioStreamTest_Played++;
+		}
+		else
+		{
+			DioStreamTest_Idle++;
+		}
+	
+		if(0 == --DIO_Delay)
+		{
+			Dio_StreamIsr();
+			DioStreamTest_Seed = (DioStreamTest_Seed * 1103515245u + 12345u) & 0x7FFFFFFFu;
+			DIO_Delay = (uint8)(1 + ((DioStreamTest_Seed >> 16) % MaxDelay));
+		}
+		else
+		{
+			/* Completion interrupt not taken yet */
+		}
+	}
+}
+
+/**
+ *	\brief		Restarts the register model, the outputs, the controller and the stream.
+ *	\param		None.
+ *	\return		None.
+ */
+static void DioStreamTest_Restart(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&DioStreamTest_Config);
+	Dio_WriteChannel(DIO_CHANNEL_B7, STD_HIGH);
+	(void)Dio_StreamInit();
+	(void)Dio_StreamStart(&DioStreamTest_Stream);
+	DioStreamTest_Queued = 0;
+	DioStreamTest_Played = 0;
+	DioStreamTest_Returned = 0;
+	DioStreamTest_Idle = 0;
+	DioStreamTest_Refill = TRUE;
+	DioStreamTest_InOrder = TRUE;
+	DioStreamTest_Kept = TRUE;
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	/* Needed Variables */
+	Dio_StreamConfigType DIO_Bad = DioStreamTest_Stream;
+	uint8 DIO_Pins;
+	
+	/* Rejections */
+	HW_RegsModelReset();
+	Port_Init(&DioStreamTest_Config);
+	Test_Check((E_OK == Dio_StreamInit()) ? TRUE : FALSE, "controller ready");
+	Test_Check((E_NOT_OK == Dio_StreamQueue(DioStreamTest_Buffers[0], 1)) ? TRUE : FALSE, "queue before the start rejected");
+	Test_Check((E_NOT_OK == Dio_StreamStart(NULL_PTR)) ? TRUE : FALSE, "NULL configuration rejected");
+	DIO_Bad.Dio_Mask = 0;
+	Test_Check((E_NOT_OK == Dio_StreamStart(&DIO_Bad)) ? TRUE : FALSE, "empty mask rejected");
+	DIO_Bad.Dio_Mask = DIO_STREAM_TEST_MASK;
+	DIO_Bad.Dio_Port = (Dio_PortType)HW_NO_OF_PORTS;
+	Test_Check((E_NOT_OK == Dio_StreamStart(&DIO_Bad)) ? TRUE : FALSE, "missing port rejected");
+	Test_Check((DIO_STREAM_IDLE == Dio_StreamGetState()) ? TRUE : FALSE, "idle before the start");
+	
+	DioStreamTest_Restart();
+	Test_Check((DIO_STREAM_READY == Dio_StreamGetState()) ? TRUE : FALSE, "ready once started");
+	Test_Check(((E_NOT_OK == Dio_StreamQueue(NULL_PTR, 1)) &&
+				(E_NOT_OK == Dio_StreamQueue(DioStreamTest_Buffers[0], 0)) &&
+				(E_NOT_OK == Dio_StreamQueue(DioStreamTest_Buffers[0], HW_UDMA_XFERSIZE_MAX + 1))) ? TRUE : FALSE,
+			   "NULL images and bad lengths rejected");
+	Test_Check(((E_OK == DioStreamTest_Queue(0)) && (E_OK == DioStreamTest_Queue(1)) &&
+				(E_NOT_OK == Dio_StreamQueue(DioStreamTest_Buffers[0], 1))) ? TRUE : FALSE,
+			   "two buffers queued, a third rejected");
+	Test_Check((DIO_STREAM_RUNNING == Dio_StreamGetState()) ? TRUE : FALSE, "running with queued buffers");
+	
+	/* Ping-pong refill, the completion handler called after every request */
+	DioStreamTest_Limit = DIO_STREAM_TEST_BUFFERS * DIO_STREAM_TEST_LENGTH;
+	DioStreamTest_Play(DioStreamTest_Limit, 1);
+	Test_Check(((TRUE == DioStreamTest_InOrder) && (DioStreamTest_Limit == DioStreamTest_Played)) ? TRUE : FALSE,
+			   "ping-pong: every image played in order");
+	Test_Check((0 == DioStreamTest_Idle) ? TRUE : FALSE, "ping-pong: no request missed");
+	Test_Check(DioStreamTest_Kept, "ping-pong: pins out of the mask kept");
+	
+	/* Ping-pong refill, the completion handler delayed by less than a buffer */
+	DioStreamTest_Restart();
+	(void)DioStreamTest_Queue(0);
+	(void)DioStreamTest_Queue(1);
+	DioStreamTest_Play(DioStreamTest_Limit, DIO_STREAM_TEST_LENGTH - 2);
+	Test_Check(((TRUE == DioStreamTest_InOrder) && (DioStreamTest_Limit == DioStreamTest_Played) &&
+				(0 == DioStreamTest_Idle)) ? TRUE : FALSE, "delayed handler: every image played in order");
+	
+	/* Underrun: the task requeues the buffers late, the second one while the first one is played */
+	DioStreamTest_Restart();
+	(void)DioStreamTest_Queue(0);
+	(void)DioStreamTest_Queue(1);
+	DioStreamTest_Refill = FALSE;
+	DioStreamTest_Play(3 * DIO_STREAM_TEST_LENGTH, 1);
+	DIO_Pins = HW_RegsModelGetPins(DIO_PORTB);
+	Test_Check(((TRUE == DioStreamTest_InOrder) && ((2 * DIO_STREAM_TEST_LENGTH) == DioStreamTest_Played) &&
+				(DIO_STREAM_TEST_LENGTH == DioStreamTest_Idle) && (2 == DioStreamTest_Returned)) ? TRUE : FALSE,
+			   "underrun: both buffers played and given back, then no image");
+	Test_Check(((DIO_Pins & DIO_STREAM_TEST_MASK) == (DioStreamTest_Buffers[1][DIO_STREAM_TEST_LENGTH - 1] & DIO_STREAM_TEST_MASK)) ?
+			   TRUE : FALSE, "underrun: the pins hold the last image");
+	Test_Check((DIO_STREAM_READY == Dio_StreamGetState()) ? TRUE : FALSE, "underrun: ready");
+	DioStreamTest_Idle = 0;
+	DioStreamTest_Limit = 10 * DIO_STREAM_TEST_LENGTH;
+	(void)DioStreamTest_Queue(0);
+	DioStreamTest_Play(2, 1);
+	(void)DioStreamTest_Queue(1);
+	DioStreamTest_Refill = TRUE;
+	DioStreamTest_Play(DioStreamTest_Limit - DioStreamTest_Played, 1);
+	Test_Check(((TRUE == DioStreamTest_InOrder) && (DioStreamTest_Limit == DioStreamTest_Played) &&
+				(0 == DioStreamTest_Idle)) ? TRUE : FALSE, "underrun: resumed with the next image, none lost or repeated");
+	
+	/* End of stream: the limit is reached, the last buffers are given back */
+	DioStreamTest_Play(DIO_STREAM_TEST_LENGTH, 1);
+	DIO_Pins = HW_RegsModelGetPins(DIO_PORTB);
+	Test_Check(((TRUE == DioStreamTest_InOrder) && (DioStreamTest_Limit == DioStreamTest_Played) &&
+				(DIO_STREAM_TEST_LENGTH == DioStreamTest_Idle) && (10 == DioStreamTest_Returned)) ? TRUE : FALSE,
+			   "end of stream: every buffer given back once, in order");
+	Test_Check(((DIO_STREAM_READY == Dio_StreamGetState()) &&
+				((DIO_Pins & DIO_STREAM_TEST_MASK) == (DioStreamTest_Image(DioStreamTest_Limit - 1) & DIO_STREAM_TEST_MASK))) ?
+			   TRUE : FALSE, "end of stream: ready, the pins hold the last image");
+	
+	/* Stop in the middle of a buffer */
+	DioStreamTest_Restart();
+	(void)DioStreamTest_Queue(0);
+	(void)DioStreamTest_Queue(1);
+	DioStreamTest_Play(3, 1);
+	Dio_StreamStop();
+	DIO_Pins = HW_RegsModelGetPins(DIO_PORTB);
+	DioStreamTest_Play(DIO_STREAM_TEST_LENGTH, 1);
+	Test_Check(((DIO_STREAM_IDLE == Dio_StreamGetState()) && (3 == DioStreamTest_Played) &&
+				(0 == DioStreamTest_Returned) && (DIO_Pins == HW_RegsModelGetPins(DIO_PORTB))) ? TRUE : FALSE,
+			   "stop: nothing played or given back, the pins keep their levels");
+	
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "no faulty access");
+	
+	return Test_Summary();
+}
@@ -0,0 +1,328 @@
+/**
+ *  \file	HwAccessReport.c
+ *  \brief 	Host tool printing the registers accesses of every Dio_* / Port_* service,
+ *  		counted by the registers access accounting (TivaAccounting.h) while the
+ *  		services run on the host register model (TivaRegsModel.h).
+ *  		Every service is called HW_ACCESS_REPORT_CALLS times on a sample configuration,
+ *  		the table gives the reads, writes and read-modify-writes per call and the bus
+ *  		transactions they make (a read-modify-write is 2 of them).
+ *  		Usage: HwAccessReport [-r]		-r adds the accesses per register.
+ *  		Build (from the repository root):
+ *  		gcc -DHW_ACCESS_ACCOUNTING=1 -I"common files" -IIO/DIO -IIO/PortDriver -IServices/Det
+ *  			Tools/HwAccessReport/HwAccessReport.c IO/DIO/DIO.c IO/DIO/DioShadow.c
+ *  			IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o HwAccessReport
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include <string.h>
+#include "DIO.h"			/* Before Port.h, it defines Dio_PortType */
+#include "Port.h"
+#include "TivaRegsModel.h"
+#include "TivaAccounting.h"
+
+#if(HW_ACCESS_ACCOUNTING != 1)
+#error "HwAccessReport has to be built with -DHW_ACCESS_ACCOUNTING=1"
+#endif
+
+/* Macros */
+#define HW_ACCESS_REPORT_CALLS	100		/*!< Calls of every service */
+
+/* Calls a service HW_ACCESS_REPORT_CALLS times under its name */
+#define HW_ACCESS_REPORT(API, ARGS)	\
+	do{	\
+		uint16 HW_Call;	\
+		for(HW_Call = 0; HW_Call < HW_ACCESS_REPORT_CALLS; HW_Call++)	\
+		{	\
+			HW_ACCOUNTING_CALL(API, ARGS);	\
+		}	\
+	}while(0)
+
+/* Private Variables */
+static const Port_PinConfigType HW_ReportPins[] = {
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_D7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_A2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_C4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_E0, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Sample pins: LEDs and switches of the launchpad, D7 (locked) and a pin of every
+		 other port so Dio_ReadAllPorts() finds all clocks on */
+
+static const Port_ConfigType HW_ReportConfig = {
+	HW_ReportPins, sizeof(HW_ReportPins) / sizeof(HW_ReportPins[0]), NULL_PTR
+};	/*!< Sample configuration set, folded at runtime */
+
+static const Port_PinConfigType HW_ReportOwnedPins[] = {
+	{PORT_PIN_B0, PORT_PIN_UART, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_UART, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B5, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< All the pins of PORTB */
+
+static const Port_ConfigType HW_ReportOwnedConfig = {
+	HW_ReportOwnedPins, sizeof(HW_ReportOwnedPins) / sizeof(HW_ReportOwnedPins[0]), NULL_PTR
+};	/*!< Configuration set owning PORTB, whose registers are stored without being read */
+
+static const Dio_ChannelGroupType HW_ReportGroup = {0x0E, 1, DIO_PORTF};	/*!< F1 .. F3 */
+
+static const Dio_ChannelType HW_ReportChannels[] = {
+	DIO_CHANNEL_F1, DIO_CHANNEL_F2, DIO_CHANNEL_A2
+};	/*!< Channels of the lists, on two ports */
+
+static const Dio_LevelType HW_ReportLevels[] = {STD_HIGH, STD_LOW, STD_HIGH};	/*!< Levels of the lists */
+
+static const char* const HW_ReportGpioNames[] = {
+	"GPIODIR", "GPIOIS", "GPIOIBE", "GPIOIEV", "GPIOIM", "GPIORIS", "GPIOMIS", "GPIOICR", "GPIOAFSEL"
+};	/*!< Names of the GPIO registers 0x400 .. 0x420 */
+
+static const char* const HW_ReportPadNames[] = {
+	"GPIODR2R", "GPIODR4R", "GPIODR8R", "GPIOODR", "GPIOPUR", "GPIOPDR", "GPIOSLR", "GPIODEN",
+	"GPIOLOCK", "GPIOCR", "GPIOAMSEL", "GPIOPCTL", "GPIOADCCTL", "GPIODMACTL"
+};	/*!< Names of the GPIO registers 0x500 .. 0x534 */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Writes the name of a register, PORTx.NAME for the GPIO registers,
+ *				SYSCTL+offset / DMA+offset for the other peripherals and the address otherwise.
+ *	\param[in] 	Register: 	Address of the register.
+ *	\param[out] NamePtr: 	Pointer to the name, 32 characters.
+ *	\return		None.
+ */
+static void HW_ReportRegisterName(HW_AddressBusSizeType Register, char* NamePtr);
+
+/**
+ *	\brief		Prints the accesses of an API.
+ *	\param[in] 	ApiName: 	Name of the API, NULL_PTR for the accesses outside of any API.
+ *	\return		None.
+ */
+static void HW_ReportApi(const char* ApiName);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Writes the name of a register, PORTx.NAME for the GPIO registers,
+ *				SYSCTL+offset / DMA+offset for the other peripherals and the address otherwise.
+ *	\param[in] 	Register: 	Address of the register.
+ *	\param[out] NamePtr: 	Pointer to the name, 32 characters.
+ *	\return		None.
+ */
+static void HW_ReportRegisterName(HW_AddressBusSizeType Register, char* NamePtr)
+{
+	/* Needed Variables */
+	static const HW_AddressBusSizeType HW_Bases[] = {
+		HW_GPIOPORTA_APB_BASE, HW_GPIOPORTB_APB_BASE, HW_GPIOPORTC_APB_BASE,
+		HW_GPIOPORTD_APB_BASE, HW_GPIOPORTE_APB_BASE, HW_GPIOPORTF_APB_BASE,
+		HW_GPIOPORTA_AHB_BASE, HW_GPIOPORTB_AHB_BASE, HW_GPIOPORTC_AHB_BASE,
+		HW_GPIOPORTD_AHB_BASE, HW_GPIOPORTE_AHB_BASE, HW_GPIOPORTF_AHB_BASE
+	};
+	HW_AddressBusSizeType HW_Offset = Register & 0xFFF;
+	const char* HW_Name = NULL_PTR;
+	uint8 HW_Index;
+	
+	(void)snprintf(NamePtr, 32, "0x%08lX", (unsigned long)Register);
+	for(HW_Index = 0; HW_Index < (2 * HW_NO_OF_PORTS); HW_Index++)
+	{
+		if((Register & ~(HW_AddressBusSizeType)0xFFF) == HW_Bases[HW_Index])
+		{
+			if(HW_GPIODATA_OFFSET == HW_Offset)
+			{
+				HW_Name = "GPIODATA";
+			}
+			else if((HW_Offset >= HW_GPIODIR_OFFSET) && (HW_Offset <= HW_GPIOAFSEL_OFFSET))
+			{
+				HW_Name = HW_ReportGpioNames[(HW_Offset - HW_GPIODIR_OFFSET) >> 2];
+			}
+			else if((HW_Offset >= HW_GPIODR2R_OFFSET) && (HW_Offset <= HW_GPIODMACTL_OFFSET))
+			{
+				HW_Name = HW_ReportPadNames[(HW_Offset - HW_GPIODR2R_OFFSET) >> 2];
+			}
+			else
+			{
+				HW_Name = "GPIO";
+			}
+			(void)snprintf(NamePtr, 32, "PORT%c%s.%s", 'A' + (HW_Index % HW_NO_OF_PORTS),
+						   (HW_Index < HW_NO_OF_PORTS) ? "" : "(AHB)", HW_Name);
+		}
+		else
+		{
+			/* Another port */
+		}
+	}
+	if((Register & ~(HW_AddressBusSizeType)0xFFF) == HW_SYSTEM_CONTROL_BA)
+	{
+		(void)snprintf(NamePtr, 32, "SYSCTL+0x%03lX", (unsigned long)HW_Offset);
+	}
+	else if((Register & ~(HW_AddressBusSizeType)0xFFF) == HW_UDMA_BA)
+	{
+		(void)snprintf(NamePtr, 32, "DMA+0x%03lX", (unsigned long)HW_Offset);
+	}
+	else
+	{
+		/* Named above or by its address */
+	}
+}
+
+/**
+ *	\brief		Prints the accesses of an API.
+ *	\param[in] 	ApiName: 	Name of the API, NULL_PTR for the accesses outside of any API.
+ *	\return		None.
+ */
+static void HW_ReportApi(const char* ApiName)
+{
+	/* Needed Variables */
+	HW_AccountingCountsType HW_Counts;
+	uint32 HW_Calls = HW_AccountingGetApi(ApiName, &HW_Counts);
+	uint32 HW_Transactions = HW_ACCOUNTING_TRANSACTIONS(HW_Counts);
+	
+	if(0 != HW_Calls)
+	{
+		printf("%-28s %6lu %8.2f %8.2f %8.2f %12.2f\n", ApiName, (unsigned long)HW_Calls,
+			   (double)HW_Counts.HW_Reads / HW_Calls, (double)HW_Counts.HW_Writes / HW_Calls,
+			   (double)HW_Counts.HW_Modifies / HW_Calls, (double)HW_Transactions / HW_Calls);
+	}
+	else
+	{
+		/* Service not called (switched off) */
+	}
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Calls every service and prints its accesses.
+ *	\param[in] 	argc: 	Number of arguments.
+ *	\param[in] 	argv: 	Arguments, "-r" adds the accesses per register.
+ *	\return		int: 	0 if no access faulted in the register model, 1 otherwise.
+ */
+int main(int argc, char* argv[])
+{
+	/* Needed Variables */
+	boolean HW_PerRegister = ((argc > 1) && (0 == strcmp(argv[1], "-r"))) ? TRUE : FALSE;
+	const HW_AccountingEntryType* HW_EntriesPtr;
+	HW_AccountingCountsType HW_Counts;
+	uint32 HW_Calls;
+	const char* HW_LastApi = NULL_PTR;
+	uint16 HW_NoOfEntries;
+	uint32 HW_Dropped;
+	uint16 HW_Index;
+	char HW_Name[32];
+#if(DioChannelListApi == STD_ON)
+	Dio_ChannelSetType HW_Set;
+	Dio_LevelType HW_Levels[3];
+#endif /* DioChannelListApi check */
+#if(DioFlipChannelApi == STD_ON)
+	Dio_PortLevelType HW_FlipMasks[HW_NO_OF_PORTS] = {0x04, 0, 0, 0, 0, 0x06};
+#endif /* DioFlipChannelApi check */
+	
+	HW_RegsModelReset();
+	HW_AccountingReset();
+	
+	/* Port_Init runs once, the calls count would be a reset of the model */
+	HW_ACCOUNTING_CALL(Port_Init, (&HW_ReportConfig));
+	HW_ACCESS_REPORT(Port_SetPinDirection, (PORT_PIN_F3, PORT_PIN_IN));
+	HW_ACCESS_REPORT(Port_RefreshPortDirection, ());
+	HW_ACCESS_REPORT(Port_SetPinMode, (PORT_PIN_F2, PORT_PIN_DIO));
+	for(HW_Index = 0; HW_Index < HW_ACCESS_REPORT_CALLS; HW_Index++)
+	{
+		/* A session is opened once, it has to be closed before the next call */
+		HW_ACCOUNTING_CALL(Port_CommitSessionOpen, (DIO_PORTD, 0x80));
+		HW_ACCOUNTING_CALL(Port_CommitSessionClose, (DIO_PORTD));
+	}
+	
+	HW_ACCESS_REPORT(Dio_ReadChannel, (DIO_CHANNEL_F4));
+	HW_ACCESS_REPORT(Dio_WriteChannel, (DIO_CHANNEL_F1, STD_HIGH));
+	HW_ACCESS_REPORT(Dio_ReadPort, (DIO_PORTF));
+	HW_ACCESS_REPORT(Dio_WritePort, (DIO_PORTF, 0x0A));
+	HW_ACCESS_REPORT(Dio_ReadChannelGroup, (&HW_ReportGroup));
+	HW_ACCESS_REPORT(Dio_WriteChannelGroup, (&HW_ReportGroup, 0x05));
+#if(DioFlipChannelApi == STD_ON)
+	HW_ACCESS_REPORT(Dio_FlipChannel, (DIO_CHANNEL_F2));
+	HW_ACCESS_REPORT(Dio_FlipChannels, (HW_FlipMasks));
+#endif /* DioFlipChannelApi check */
+#if(DioMaskedWritePortApi == STD_ON)
+	HW_ACCESS_REPORT(Dio_MaskedWritePort, (DIO_PORTF, 0x0A, 0x0E));
+#endif /* DioMaskedWritePortApi check */
+#if(DioChannelListApi == STD_ON)
+	HW_ACCESS_REPORT(Dio_WriteChannelList, (HW_ReportChannels, HW_ReportLevels, 3));
+	HW_ACCESS_REPORT(Dio_ReadChannelList, (HW_ReportChannels, HW_Levels, 3));
+	HW_ACCESS_REPORT(Dio_CreateChannelSet, (&HW_Set, HW_ReportChannels, 3));
+	HW_ACCESS_REPORT(Dio_WriteChannelSet, (&HW_Set, HW_ReportLevels));
+	HW_ACCESS_REPORT(Dio_ReadChannelSet, (&HW_Set, HW_Levels));
+#endif /* DioChannelListApi check */
+#if(DioReadAllPortsApi == STD_ON)
+	HW_ACCESS_REPORT(Dio_ReadAllPorts, ());
+#endif /* DioReadAllPortsApi check */
+	
+	/* Last, it replaces the sample configuration */
+	HW_AccountingBegin("Port_Init owned PORTB");
+	Port_Init(&HW_ReportOwnedConfig);
+	HW_AccountingEnd();
+	
+	printf("%-28s %6s %8s %8s %8s %12s\n", "API", "calls", "reads", "writes", "RMW", "transactions");
+	HW_ReportApi("Port_Init");
+	HW_ReportApi("Port_Init owned PORTB");
+	HW_ReportApi("Port_SetPinDirection");
+	HW_ReportApi("Port_RefreshPortDirection");
+	HW_ReportApi("Port_SetPinMode");
+	HW_ReportApi("Port_CommitSessionOpen");
+	HW_ReportApi("Port_CommitSessionClose");
+	HW_ReportApi("Dio_ReadChannel");
+	HW_ReportApi("Dio_WriteChannel");
+	HW_ReportApi("Dio_ReadPort");
+	HW_ReportApi("Dio_WritePort");
+	HW_ReportApi("Dio_ReadChannelGroup");
+	HW_ReportApi("Dio_WriteChannelGroup");
+	HW_ReportApi("Dio_FlipChannel");
+	HW_ReportApi("Dio_FlipChannels");
+	HW_ReportApi("Dio_MaskedWritePort");
+	HW_ReportApi("Dio_WriteChannelList");
+	HW_ReportApi("Dio_ReadChannelList");
+	HW_ReportApi("Dio_CreateChannelSet");
+	HW_ReportApi("Dio_WriteChannelSet");
+	HW_ReportApi("Dio_ReadChannelSet");
+	HW_ReportApi("Dio_ReadAllPorts");
+	
+	HW_EntriesPtr = HW_AccountingGetEntries(&HW_NoOfEntries, &HW_Dropped);
+	if(TRUE == HW_PerRegister)
+	{
+		printf("\n%-28s %-24s %8s %8s %8s\n", "API", "register", "reads", "writes", "RMW");
+		for(HW_Index = 0; HW_Index < HW_NoOfEntries; HW_Index++)
+		{
+			/* Accesses per call, the total for the accesses outside of any API */
+			HW_Calls = HW_AccountingGetApi(HW_EntriesPtr[HW_Index].HW_Api, &HW_Counts);
+			HW_Calls = (0 != HW_Calls) ? HW_Calls : 1;
+			HW_ReportRegisterName(HW_EntriesPtr[HW_Index].HW_Register, HW_Name);
+			printf("%-28s %-24s %8.2f %8.2f %8.2f\n",
+				   (HW_EntriesPtr[HW_Index].HW_Api == HW_LastApi) ? "" :
+				   ((NULL_PTR != HW_EntriesPtr[HW_Index].HW_Api) ? HW_EntriesPtr[HW_Index].HW_Api : "(none)"),
+				   HW_Name,
+				   (double)HW_EntriesPtr[HW_Index].HW_Counts.HW_Reads / HW_Calls,
+				   (double)HW_EntriesPtr[HW_Index].HW_Counts.HW_Writes / HW_Calls,
+				   (double)HW_EntriesPtr[HW_Index].HW_Counts.HW_Modifies / HW_Calls);
+			HW_LastApi = HW_EntriesPtr[HW_Index].HW_Api;
+		}
+	}
+	else
+	{
+		/* Table per API only */
+	}
+	if(0 != HW_Dropped)
+	{
+		printf("\n%lu accesses not counted, raise HW_ACCOUNTING_ENTRIES\n", (unsigned long)HW_Dropped);
+	}
+	else
+	{
+		/* Every access counted */
+	}
+	
+	return (0 == HW_RegsModelGetFaults(NULL_PTR)) ? 0 : 1;
+}
@@ -0,0 +1,424 @@
+#!/usr/bin/env python3
+"""
+ \\file		PortCfgGen.py
+ \\brief		Offline configuration generator of the PORT driver.
+ 			Compiles a pin table into Port_Cfg.c / Port_Cfg.h which hold the
+ 			pins configurations and the precomputed registers images of every
+ 			port, so Port_Init only has to store them.
+ 			All validation is done here:
+ 			-	The pin exists on the TM4C123GH6PM.
+ 			-	The mode is legal on the pin (checked against the alternate
+ 				functions of the pin, the same aliases of Port_PinType).
+ 			-	A pin is configured only once.
+ 			-	Pull-up and pull-down aren't enabled together.
+ 			-	ADC pins are inputs.
+
+ 			The encodings of every pin and mode are checked against Port_PctlTable
+ 			(Port.c) before anything is generated, so the folded Port_Init and the
+ 			images can't route a pin differently.
+
+ Usage:		PortCfgGen.py <pin table> [output directory]
+ 			PortCfgGen.py --check	(only checks Port_PctlTable, 0 if it agrees)
+
+ Pin table:	One pin per line, '#' starts a comment:
+ 			<Pin> <Mode> <Direction> <Level> <Current> <PullUp> <PullDown> <OpenDrain> [<Changeable> [<Interrupt>]]
+ 			-	Pin:		Any non numeric Port_PinType name (PORT_PIN_F1, PORT_PIN_U0RX ...).
+ 						An alternate function alias also selects its PCTL encoding.
+ 			-	Mode:		DIO, ADC, UART, SSI, SPI, I2C, CAN, USB, AC, PWM or QEI.
+ 			-	Direction:	IN or OUT.
+ 			-	Level:		HIGH or LOW.
+ 			-	Current:	DEFAULT, 2mA, 4mA or 8mA.
+ 			-	PullUp, PullDown, OpenDrain: ON or OFF.
+ 			-	Changeable:	YES if the direction may change at runtime, NO (default)
+ 						if it is restored by Port_RefreshPortDirection().
+ 			-	Interrupt:	NONE (default), RISING, FALLING, BOTH (edges), LOW or HIGH (levels).
+ 						The interrupt stays masked until DIO enables the notification.
+
+ \\author	Ahmed Wageh.
+"""
+
+import os
+import re
+import sys
+
+# Ports of the micro controller and their number of pins
+PORTS = "ABCDEF"
+PINS_PER_PORT = {"A": 8, "B": 8, "C": 8, "D": 8, "E": 6, "F": 5}
+
+# Port_PinModeType values (Port.h)
+MODES = {
+    "DIO": 0x00, "ADC": 0x01, "UART": 0x02, "SSI": 0x03, "SPI": 0x03, "I2C": 0x04,
+    "CAN": 0x05, "USB": 0x06, "AC": 0x07, "PWM": 0x08, "QEI": 0x09,
+}
+MODE_MACROS = {
+    0x00: "PORT_PIN_DIO", 0x01: "PORT_PIN_ADC", 0x02: "PORT_PIN_UART", 0x03: "PORT_PIN_SSI",
+    0x04: "PORT_PIN_I2C", 0x05: "PORT_PIN_CAN", 0x06: "PORT_PIN_USB", 0x07: "PORT_PIN_AC",
+    0x08: "PORT_PIN_PWM", 0x09: "PORT_PIN_QEI",
+}
+
+# Signal name patterns of every pin mode
+MODE_SIGNALS = [
+    ("ADC", re.compile(r"^AIN\d+$")),
+    ("UART", re.compile(r"^U\d(RX|TX|RTS|CTS)$")),
+    ("SSI", re.compile(r"^SSI\d(CLK|FSS|RX|TX)$")),
+    ("I2C", re.compile(r"^I2C\dS(CL|DA)$")),
+    ("CAN", re.compile(r"^CAN\d(RX|TX)$")),
+    ("USB", re.compile(r"^USB0")),
+    ("AC", re.compile(r"^C\d(_POS|_NEG|O)$")),
+    ("PWM", re.compile(r"^M\d(PWM\d|FAULT\d)$")),
+    ("QEI", re.compile(r"^(IDX\d|PHA\d|PHB\d)$")),
+]
+
+# Alternate functions of every pin and their GPIOPCTL encodings
+# (TM4C123GH6PM datasheet, GPIO pins and alternate functions table).
+# Analog functions have no PCTL encoding and are listed with 0.
+ALTERNATE_FUNCTIONS = {
+    "A0": {"U0RX": 1, "CAN1RX": 8},
+    "A1": {"U0TX": 1, "CAN1TX": 8},
+    "A2": {"SSI0CLK": 2},
+    "A3": {"SSI0FSS": 2},
+    "A4": {"SSI0RX": 2},
+    "A5": {"SSI0TX": 2},
+    "A6": {"I2C1SCL": 3, "M1PWM2": 5},
+    "A7": {"I2C1SDA": 3, "M1PWM3": 5},
+    "B0": {"USB0ID": 0, "U1RX": 1, "T2CCP0": 7},
+    "B1": {"USB0VBUS": 0, "U1TX": 1, "T2CCP1": 7},
+    "B2": {"I2C0SCL": 3, "T3CCP0": 7},
+    "B3": {"I2C0SDA": 3, "T3CCP1": 7},
+    "B4": {"AIN10": 0, "SSI2CLK": 2, "M0PWM2": 4, "T1CCP0": 7, "CAN0RX": 8},
+    "B5": {"AIN11": 0, "SSI2FSS": 2, "M0PWM3": 4, "T1CCP1": 7, "CAN0TX": 8},
+    "B6": {"SSI2RX": 2, "M0PWM0": 4, "T0CCP0": 7},
+    "B7": {"SSI2TX": 2, "M0PWM1": 4, "T0CCP1": 7},
+    "C0": {"TCK": 1, "SWCLK": 1, "T4CCP0": 7},
+    "C1": {"TMS": 1, "SWDIO": 1, "T4CCP1": 7},
+    "C2": {"TDI": 1, "T5CCP0": 7},
+    "C3": {"TDO": 1, "SWO": 1, "T5CCP1": 7},
+    "C4": {"C1_NEG": 0, "U4RX": 1, "U1RX": 2, "M0PWM6": 4, "IDX1": 6, "WT0CCP0": 7, "U1RTS": 8},
+    "C5": {"C1_POS": 0, "U4TX": 1, "U1TX": 2, "M0PWM7": 4, "PHA1": 6, "WT0CCP1": 7, "U1CTS": 8},
+    "C6": {"C0_POS": 0, "U3RX": 1, "PHB1": 6, "WT1CCP0": 7, "USB0EPEN": 8},
+    "C7": {"C0_NEG": 0, "U3TX": 1, "WT1CCP1": 7, "USB0PFLT": 8},
+    "D0": {"AIN7": 0, "SSI3CLK": 1, "SSI1CLK": 2, "I2C3SCL": 3, "M0PWM6": 4, "M1PWM0": 5, "WT2CCP0": 7},
+    "D1": {"AIN6": 0, "SSI3FSS": 1, "SSI1FSS": 2, "I2C3SDA": 3, "M0PWM7": 4, "M1PWM1": 5, "WT2CCP1": 7},
+    "D2": {"AIN5": 0, "SSI3RX": 1, "SSI1RX": 2, "M0FAULT0": 4, "WT3CCP0": 7, "USB0EPEN": 8},
+    "D3": {"AIN4": 0, "SSI3TX": 1, "SSI1TX": 2, "IDX0": 6, "WT3CCP1": 7, "USB0PFLT": 8},
+    "D4": {"USB0DM": 0, "U6RX": 1, "WT4CCP0": 7},
+    "D5": {"USB0DP": 0, "U6TX": 1, "WT4CCP1": 7},
+    "D6": {"U2RX": 1, "M0FAULT0": 4, "PHA0": 6, "WT5CCP0": 7},
+    "D7": {"U2TX": 1, "PHB0": 6, "WT5CCP1": 7, "NMI": 8},
+    "E0": {"AIN3": 0, "U7RX": 1},
+    "E1": {"AIN2": 0, "U7TX": 1},
+    "E2": {"AIN1": 0},
+    "E3": {"AIN0": 0},
+    "E4": {"AIN9": 0, "U5RX": 1, "I2C2SCL": 3, "M0PWM4": 4, "M1PWM2": 5, "CAN0RX": 8},
+    "E5": {"AIN8": 0, "U5TX": 1, "I2C2SDA": 3, "M0PWM5": 4, "M1PWM3": 5, "CAN0TX": 8},
+    "F0": {"U1RTS": 1, "SSI1RX": 2, "CAN0RX": 3, "M1PWM4": 5, "PHA0": 6, "T0CCP0": 7, "NMI": 8, "C0O": 9},
+    "F1": {"U1CTS": 1, "SSI1TX": 2, "M1PWM5": 5, "PHB0": 6, "T0CCP1": 7, "C1O": 9, "TRD1": 14},
+    "F2": {"SSI1CLK": 2, "M0FAULT0": 4, "M1PWM6": 5, "T1CCP0": 7, "TRD0": 14},
+    "F3": {"SSI1FSS": 2, "CAN0TX": 3, "M1PWM7": 5, "T1CCP1": 7, "TRCLK": 14},
+    "F4": {"M1FAULT0": 5, "IDX0": 6, "T2CCP0": 7, "USB0EPEN": 8},
+}
+
+# Analog functions, their pins keep GPIOPCTL at 0
+ANALOG_SIGNALS = re.compile(r"^(AIN\d+|C\d_(POS|NEG)|USB0(ID|VBUS|DM|DP))$")
+
+# Reset values of the registers that aren't zero after reset (JTAG pins PC0-PC3)
+RESET_VALUES = {
+    "Afsel": {"C": 0x0F}, "Pur": {"C": 0x0F}, "Den": {"C": 0x0F},
+    "Pctl": {"C": 0x00001111}, "Dr2r": {p: 0xFF for p in PORTS},
+}
+
+# Members of Port_PortImageType in order, DirRefresh isn't a register but the
+# pins whose direction is restored by Port_RefreshPortDirection(), IntPins are
+# the pins whose interrupt sense (Is, Ibe, Iev) is configured
+REGISTERS = ["Pctl", "Commit", "Data", "Dir", "Afsel", "Pur", "Pdr", "Odr", "Den",
+             "Dr2r", "Dr4r", "Dr8r", "DirRefresh", "IntPins", "Is", "Ibe", "Iev"]
+
+# Port_PinInterruptType values (Port.h) and their (GPIOIS, GPIOIBE, GPIOIEV) bits
+INTERRUPTS = {"NONE": 0, "RISING": 1, "FALLING": 2, "BOTH": 3, "LOW": 4, "HIGH": 5}
+INTERRUPT_MACROS = ["PORT_INTERRUPT_NONE", "PORT_INTERRUPT_RISING", "PORT_INTERRUPT_FALLING",
+                    "PORT_INTERRUPT_BOTH", "PORT_INTERRUPT_LOW", "PORT_INTERRUPT_HIGH"]
+INTERRUPT_SENSE = [(0, 0, 0), (0, 0, 1), (0, 0, 0), (0, 1, 0), (1, 0, 0), (1, 0, 1)]
+
+
+class ConfigError(Exception):
+    """A pin table line that can't be compiled."""
+
+
+def signal_mode(signal):
+    """Returns the pin mode of an alternate function signal, None if it has no mode."""
+    for mode, pattern in MODE_SIGNALS:
+        if pattern.match(signal):
+            return mode
+    return None
+
+
+def parse_pin_aliases(port_header):
+    """Parses the symbolic names of Port_PinType. The commented out aliases are
+    skipped, they can't be used in the generated C code."""
+    text = open(port_header, encoding="latin-1").read()
+    body = text[text.index("typedef enum{\n\t/* PORT A Pins */"):text.index("}Port_PinType;")]
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    body = re.sub(r"//[^\n]*", "", body)
+    aliases = {}
+    for name, value in re.findall(r"(PORT_PIN_\w+)\s*=\s*(0x[0-9A-Fa-f]+)", body):
+        aliases[name.upper()] = (name, int(value, 16))
+    return aliases
+
+
+def resolve_pin(name, aliases):
+    """Returns (C name, pin id, port letter, pin number, alternate function or None) of a pin name."""
+    key = name.upper()
+    if key not in aliases:
+        raise ConfigError("unknown pin '%s'" % name)
+    if re.match(r"^PORT_PIN_\d+$", key):
+        raise ConfigError("'%s' is a package pin number, use the port pin name" % name)
+    c_name, pin_id = aliases[key]
+    port, number = pin_id >> 4, pin_id & 0x0F
+    if port >= len(PORTS) or number >= PINS_PER_PORT[PORTS[port]]:
+        raise ConfigError("pin '%s' doesn't exist on the board" % name)
+    letter = PORTS[port]
+    signal = key[len("PORT_PIN_"):]
+    if re.match(r"^[A-F]\d$", signal):
+        signal = None
+    elif signal not in ALTERNATE_FUNCTIONS[letter + str(number)]:
+        raise ConfigError("'%s' isn't an alternate function of P%s%d" % (name, letter, number))
+    return c_name, pin_id, letter, number, signal
+
+
+def pctl_encoding(letter, number, mode, signal):
+    """Returns the GPIOPCTL encoding of a pin in a mode, raises if the mode is illegal."""
+    functions = ALTERNATE_FUNCTIONS[letter + str(number)]
+    if mode == "DIO":
+        if signal is not None:
+            raise ConfigError("alternate function %s used in DIO mode" % signal)
+        return 0
+    mode = "SSI" if mode == "SPI" else mode
+    if signal is not None:
+        if signal_mode(signal) != mode:
+            raise ConfigError("%s isn't a %s function" % (signal, mode))
+        candidates = [signal]
+    else:
+        candidates = sorted((s for s in functions if signal_mode(s) == mode),
+                            key=lambda s: functions[s])
+    if not candidates:
+        raise ConfigError("mode %s is illegal on P%s%d" % (mode, letter, number))
+    return 0 if ANALOG_SIGNALS.match(candidates[0]) else functions[candidates[0]]
+
+
+def parse_pctl_table(port_source):
+    """Parses Port_PctlTable of the driver, returns {pin name: [encoding or None per mode]}."""
+    text = open(port_source, encoding="latin-1").read()
+    body = text[text.index("Port_PctlTable[HW_NO_OF_PORTS << 3][PORT_NO_OF_PIN_MODES] = {"):]
+    body = body[:body.index("};")]
+    table = {}
+    for row, pin in re.findall(r"\{([^{}]*)\},?\s*/\*\s*P([A-F]\d)\s*\*/", body):
+        table[pin] = [None if cell.strip() == "PORT_PCTL_NA" else int(cell, 16)
+                      for cell in row.split(",")]
+    return table
+
+
+def check_pctl_table(port_source):
+    """Returns the disagreements between Port_PctlTable and the encodings of the generator."""
+    table = parse_pctl_table(port_source)
+    errors = []
+    for letter in PORTS:
+        for number in range(8):
+            pin = letter + str(number)
+            if pin not in table or len(table[pin]) != len(MODE_MACROS):
+                errors.append("P%s: no row of %d modes in Port_PctlTable" % (pin, len(MODE_MACROS)))
+                continue
+            for mode, macro in sorted(MODE_MACROS.items()):
+                if number >= PINS_PER_PORT[letter]:
+                    expected = None
+                else:
+                    try:
+                        expected = pctl_encoding(letter, number, macro[len("PORT_PIN_"):], None)
+                    except ConfigError:
+                        expected = None
+                if table[pin][mode] != expected:
+                    errors.append("P%s %s: Port_PctlTable has %s, the generator %s" % (
+                        pin, macro, table[pin][mode], expected))
+    return errors
+
+
+def choice(value, options, what):
+    key = value.upper()
+    if key not in options:
+        raise ConfigError("invalid %s '%s'" % (what, value))
+    return options[key]
+
+
+def parse_table(table_path, aliases):
+    """Parses and validates the pin table, returns the list of pins configurations."""
+    pins = []
+    used = {}
+    errors = []
+    for line_number, line in enumerate(open(table_path), 1):
+        fields = line.split("#", 1)[0].split()
+        if not fields:
+            continue
+        try:
+            if len(fields) not in (8, 9, 10):
+                raise ConfigError("expected 8 to 10 fields, found %d" % len(fields))
+            c_name, pin_id, letter, number, signal = resolve_pin(fields[0], aliases)
+            if pin_id in used:
+                raise ConfigError("P%s%d already configured on line %d" % (letter, number, used[pin_id]))
+            mode = choice(fields[1], MODES, "mode")
+            mode_name = fields[1].upper()
+            pin = {
+                "name": c_name, "id": pin_id, "port": letter, "number": number,
+                "mode": mode, "pctl": pctl_encoding(letter, number, mode_name, signal),
+                "dir": choice(fields[2], {"IN": 0, "OUT": 1}, "direction"),
+                "level": choice(fields[3], {"LOW": 0, "HIGH": 1}, "level"),
+                "current": choice(fields[4], {"DEFAULT": 0, "2MA": 1, "4MA": 2, "8MA": 3}, "current"),
+                "pur": choice(fields[5], {"OFF": 0, "ON": 1}, "pull up"),
+                "pdr": choice(fields[6], {"OFF": 0, "ON": 1}, "pull down"),
+                "odr": choice(fields[7], {"OFF": 0, "ON": 1}, "open drain"),
+                "changeable": choice(fields[8] if len(fields) >= 9 else "NO",
+                                     {"NO": 0, "YES": 1}, "direction changeable"),
+                "interrupt": choice(fields[9] if len(fields) == 10 else "NONE",
+                                    INTERRUPTS, "interrupt"),
+            }
+            if pin["pur"] and pin["pdr"]:
+                raise ConfigError("pull-up and pull-down are both enabled")
+            if mode_name == "ADC" and pin["dir"]:
+                raise ConfigError("ADC pin configured as output")
+            used[pin_id] = line_number
+            pins.append(pin)
+        except ConfigError as error:
+            errors.append("%s:%d: %s" % (table_path, line_number, error))
+    if errors:
+        raise ConfigError("\n".join(errors))
+    return pins
+
+
+def build_images(pins):
+    """Computes the final registers image of every port."""
+    images = {}
+    for letter in PORTS:
+        images[letter] = {reg: RESET_VALUES.get(reg, {}).get(letter, 0) for reg in REGISTERS}
+    clock_mask = 0
+    for pin in pins:
+        image = images[pin["port"]]
+        bit = 1 << pin["number"]
+        clock_mask |= 1 << PORTS.index(pin["port"])
+
+        def put(reg, value):
+            image[reg] = (image[reg] | bit) if value else (image[reg] & ~bit)
+
+        put("Commit", 1)
+        put("Dir", pin["dir"])
+        put("DirRefresh", not pin["changeable"])
+        put("Data", pin["dir"] and pin["level"])
+        # PORT_CURRENT_DEFAULT keeps the reset drive strength (2-mA)
+        put("Dr2r", pin["current"] in (0, 1))
+        put("Dr4r", pin["current"] == 2)
+        put("Dr8r", pin["current"] == 3)
+        put("Pur", pin["pur"])
+        put("Pdr", pin["pdr"])
+        put("Odr", pin["odr"])
+        put("Den", pin["mode"] != MODES["ADC"])
+        put("Afsel", pin["mode"] not in (MODES["ADC"], MODES["DIO"]))
+        if pin["interrupt"]:
+            sense = INTERRUPT_SENSE[pin["interrupt"]]
+            put("IntPins", 1)
+            put("Is", sense[0])
+            put("Ibe", sense[1])
+            put("Iev", sense[2])
+        shift = 4 * pin["number"]
+        image["Pctl"] = (image["Pctl"] & ~(0xF << shift)) | (pin["pctl"] << shift)
+    return clock_mask, images
+
+
+def emit(pins, clock_mask, images, table_path, out_dir):
+    source = os.path.basename(table_path)
+    header = ("/**\n"
+              " *  \\file\t%s\n"
+              " *  \\brief \tGenerated by PortCfgGen.py from %s, don't edit.\n"
+              " */\n")
+    lines = [header % ("Port_Cfg.h", source),
+             "/* Header guard */",
+             "#ifndef PORT_CFG_H_",
+             "#define PORT_CFG_H_",
+             "",
+             "/* Inclusion */",
+             "#include \"Port.h\"",
+             "",
+             "/* Configuration set */",
+             "extern const Port_ConfigType Port_Configuration;\t/*!< Generated configuration set */",
+             "",
+             "#endif /* PORT_CFG_H_ */",
+             ""]
+    open(os.path.join(out_dir, "Port_Cfg.h"), "w").write("\n".join(lines))
+
+    lines = [header % ("Port_Cfg.c", source),
+             "/* Inclusion */",
+             "#include \"Port_Cfg.h\"",
+             "",
+             "/* Pins configurations */",
+             "static const Port_PinConfigType Port_PinsConfig[%d] = {" % len(pins)]
+    entries = []
+    for pin in pins:
+        entries.append("\t{%s, %s, %s, %s, %s, %s, %s, %s, %s, %s}" % (
+            pin["name"], MODE_MACROS[pin["mode"]],
+            ["PORT_CURRENT_DEFAULT", "PORT_CURRENT_2mA", "PORT_CURRENT_4mA", "PORT_CURRENT_8mA"][pin["current"]],
+            ["PORT_PIN_IN", "PORT_PIN_OUT"][pin["dir"]],
+            ["STD_LOW", "STD_HIGH"][pin["level"]],
+            ["PORT_PULL_UP_DISABLE", "PORT_PULL_UP_ENABLE"][pin["pur"]],
+            ["PORT_PULL_DOWN_DISABLE", "PORT_PULL_DOWN_ENABLE"][pin["pdr"]],
+            ["PORT_OPEN_DRAIN_DISABLE", "PORT_OPEN_DRAIN_ENABLE"][pin["odr"]],
+            ["PORT_PIN_DIRECTION_UNCHANGEABLE", "PORT_PIN_DIRECTION_CHANGEABLE"][pin["changeable"]],
+            INTERRUPT_MACROS[pin["interrupt"]]))
+    lines.append(",\n".join(entries))
+    lines += ["};", "",
+              "/* Registers images */",
+              "static const Port_ImageSetType Port_ImageSet = {",
+              "\t0x%02X,\t/* Port_ClockGateMask */" % clock_mask,
+              "\t{"]
+    for index, letter in enumerate(PORTS):
+        image = images[letter]
+        separator = "," if index < len(PORTS) - 1 else ""
+        if not clock_mask & (1 << index):
+            lines.append("\t\t{0}%s\t/* PORT %s: unused */" % (separator, letter))
+            continue
+        lines.append("\t\t{0x%08X, " % image["Pctl"] +
+                     ", ".join("0x%02X" % (image[reg] & 0xFF) for reg in REGISTERS[1:]) +
+                     "}%s\t/* PORT %s */" % (separator, letter))
+    lines += ["\t}", "};", "",
+              "/* Configuration set */",
+              "const Port_ConfigType Port_Configuration = {",
+              "\tPort_PinsConfig,",
+              "\t%d," % len(pins),
+              "\t&Port_ImageSet",
+              "};",
+              ""]
+    open(os.path.join(out_dir, "Port_Cfg.c"), "w").write("\n".join(lines))
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        sys.stderr.write("usage: %s <pin table> [output directory] | --check\n" % argv[0])
+        return 2
+    driver_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "..", "..", "IO", "PortDriver")
+    port_header = os.path.join(driver_dir, "Port.h")
+    errors = check_pctl_table(os.path.join(driver_dir, "Port.c"))
+    if errors:
+        sys.stderr.write("Port_PctlTable and the alternate functions disagree:\n%s\n" % "\n".join(errors))
+        return 1
+    if argv[1] == "--check":
+        return 0
+    table_path = argv[1]
+    out_dir = argv[2] if len(argv) == 3 else "."
+    try:
+        pins = parse_table(table_path, parse_pin_aliases(port_header))
+    except ConfigError as error:
+        sys.stderr.write("%s\n" % error)
+        return 1
+    clock_mask, images = build_images(pins)
+    emit(pins, clock_mask, images, table_path, out_dir)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,416 @@
+/**
+ *  \file	PortTest.c
+ *  \brief 	Host unit tests of the PORT driver on the register model (TivaRegsModel.h):
+ *  		-	Commit sessions nest: Port_SetPinMode() and Port_Init() called inside an
+ *  			open session leave the port unlocked until the outermost session is closed,
+ *  			and sessions of ports which don't exist are ignored.
+ *  		-	Port_Init() leaves a port whose clock isn't ready unconfigured, without faults.
+ *  		-	Port_SetPinMode() ignores pins which don't exist, also without PortDevErrorDetect,
+ *  			and routes PF4 PWM to M1FAULT0 (PMC 5).
+ *  		-	Port_Init() skips pins whose mode isn't available or doesn't exist, also without
+ *  			PortDevErrorDetect, and configures the other pins.
+ *  		-	Port_Init() skips pins of ports which don't exist, also without PortDevErrorDetect,
+ *  			their port ID isn't used as an index (build with -fsanitize=address to see it).
+ *  		-	Port_Init() stores every register of a port whose pins are all configured.
+ *  		-	Port_SetPinDirection() leaves the unchangeable pins, also without PortDevErrorDetect,
+ *  			and changes the changeable ones.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det Tools/PortTest/PortTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c IO/PortDriver/Port.c "common files/"Tiva*.c Services/Det/Det.c -o PortTest
+ *  		./PortTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+#include "TivaRegsModel.h"
+#include "Port.h"
+#include "TestHarness.h"
+
+/* Macros */
+/* Register of a port through the aperture used by the drivers */
+#define PORT_TEST_REG(PORT_ID, OFFSET)	(HW_PortsAddresses[PORT_ID] + (OFFSET))
+
+/* PF0 is a protected pin, its GPIOPUR bit is written only while GPIOCR enables it */
+#define PORT_TEST_PF0	0x01
+
+/* Private Variables */
+extern HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS];	/*!< Contains the base addresses for all GPIO PORTs */
+
+static const Port_PinConfigType PortTest_Pins[] = {
+	{PORT_PIN_F0, PORT_PIN_DIO, PORT_CURRENT_DEFAULT, PORT_PIN_IN, STD_LOW, PORT_PULL_UP_ENABLE, PORT_PULL_DOWN_DISABLE, PORT_OPEN_DRAIN_DISABLE, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< SW2 (locked pin) and the red LED */
+
+static const Port_ConfigType PortTest_Config = {
+	PortTest_Pins,
+	(uint8)(sizeof(PortTest_Pins) / sizeof(PortTest_Pins[0])),
+	NULL_PTR
+};	/*!< Configuration folded by Port_Init */
+
+static const Port_PinConfigType PortTest_ClockPins[] = {
+	{PORT_PIN_D6, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Outputs on two ports */
+
+static const Port_ConfigType PortTest_ClockConfig = {
+	PortTest_ClockPins,
+	(uint8)(sizeof(PortTest_ClockPins) / sizeof(PortTest_ClockPins[0])),
+	NULL_PTR
+};	/*!< Configuration whose PORTD clock is kept not ready */
+
+static const Port_PinConfigType PortTest_DirectionPins[] = {
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Unchangeable and changeable outputs */
+
+static const Port_ConfigType PortTest_DirectionConfig = {
+	PortTest_DirectionPins,
+	(uint8)(sizeof(PortTest_DirectionPins) / sizeof(PortTest_DirectionPins[0])),
+	NULL_PTR
+};	/*!< Configuration of the direction checks */
+
+static const Port_PinConfigType PortTest_ModePins[] = {
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F2, PORT_PIN_ADC, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F3, (Port_PinModeType)PORT_NO_OF_PIN_MODES, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Output, ADC on a pin without ADC and a mode which doesn't exist */
+
+static const Port_ConfigType PortTest_ModeConfig = {
+	PortTest_ModePins,
+	(uint8)(sizeof(PortTest_ModePins) / sizeof(PortTest_ModePins[0])),
+	NULL_PTR
+};	/*!< Configuration whose PF2 and PF3 are skipped */
+
+static const Port_PinConfigType PortTest_PortPins[] = {
+	{(Port_PinType)0x71, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_F1, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{(Port_PinType)0xF2, PORT_PIN_DIO, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_UNCHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< Output between pins of ports H and P, which don't exist */
+
+static const Port_ConfigType PortTest_PortConfig = {
+	PortTest_PortPins,
+	(uint8)(sizeof(PortTest_PortPins) / sizeof(PortTest_PortPins[0])),
+	NULL_PTR
+};	/*!< Configuration whose pins of missing ports are skipped */
+
+static const Port_PinConfigType PortTest_OwnedPins[] = {
+	{PORT_PIN_B0, PORT_PIN_UART, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B1, PORT_PIN_UART, PORT_PIN_DIO_OUT_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B2, PORT_PIN_DIO, PORT_CURRENT_8mA, PORT_PIN_OUT, STD_LOW, PORT_PULL_UP_DISABLE, PORT_PULL_DOWN_DISABLE, PORT_OPEN_DRAIN_DISABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B3, PORT_PIN_DIO, PORT_CURRENT_8mA, PORT_PIN_OUT, STD_LOW, PORT_PULL_UP_DISABLE, PORT_PULL_DOWN_DISABLE, PORT_OPEN_DRAIN_DISABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B4, PORT_PIN_DIO, PORT_CURRENT_8mA, PORT_PIN_OUT, STD_LOW, PORT_PULL_UP_DISABLE, PORT_PULL_DOWN_DISABLE, PORT_OPEN_DRAIN_DISABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B5, PORT_PIN_DIO, PORT_CURRENT_8mA, PORT_PIN_OUT, STD_LOW, PORT_PULL_UP_DISABLE, PORT_PULL_DOWN_DISABLE, PORT_OPEN_DRAIN_DISABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B6, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE},
+	{PORT_PIN_B7, PORT_PIN_DIO, PORT_PIN_DIO_IN_DEFAULT, PORT_PIN_DIRECTION_CHANGEABLE, PORT_INTERRUPT_NONE}
+};	/*!< All the pins of PORTB: UART, 8mA outputs and pulled up inputs */
+
+static const Port_ConfigType PortTest_OwnedConfig = {
+	PortTest_OwnedPins,
+	(uint8)(sizeof(PortTest_OwnedPins) / sizeof(PortTest_OwnedPins[0])),
+	NULL_PTR
+};	/*!< Configuration owning PORTB, whose registers are stored without being read */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Checks that PORTF is locked and PF0 isn't committed.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void PortTest_CheckLocked(const char* Name);
+
+/**
+ *	\brief		Writes GPIOPUR of PF0 and checks that the write took effect.
+ *	\param[in] 	Level: 		Value of the PF0 bit to be written.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void PortTest_CheckCommitted(uint8 Level, const char* Name);
+
+/**
+ *	\brief		Commit sessions nested in an open session.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_Sessions(void);
+
+/**
+ *	\brief		Port_Init() with a port whose clock doesn't get ready.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_Clocks(void);
+
+/**
+ *	\brief		Port_SetPinMode() with pins which don't exist.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_PinModeRange(void);
+
+/**
+ *	\brief		Port_Init() with modes which aren't available or don't exist.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_InitModes(void);
+
+/**
+ *	\brief		Port_Init() with pins of ports which don't exist.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_InitPorts(void);
+
+/**
+ *	\brief		Port_Init() of a port whose pins are all in the configuration set.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_InitOwned(void);
+
+/**
+ *	\brief		Port_SetPinDirection() on changeable and unchangeable pins.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_Direction(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Checks that PORTF is locked and PF0 isn't committed.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void PortTest_CheckLocked(const char* Name)
+{
+	Test_Check(((1 == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOLOCK_OFFSET))) &&
+				(0 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOCR_OFFSET)) & PORT_TEST_PF0))) ? TRUE : FALSE,
+			   Name);
+}
+
+/**
+ *	\brief		Writes GPIOPUR of PF0 and checks that the write took effect.
+ *	\param[in] 	Level: 		Value of the PF0 bit to be written.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void PortTest_CheckCommitted(uint8 Level, const char* Name)
+{
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET),
+			  (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET)) & ~(uint32)PORT_TEST_PF0) | Level);
+	Test_Check((Level == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET)) & PORT_TEST_PF0)) ? TRUE : FALSE,
+			   Name);
+}
+
+/**
+ *	\brief		Commit sessions nested in an open session.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_Sessions(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&PortTest_Config);
+	Test_Check((PORT_TEST_PF0 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET)) & PORT_TEST_PF0)) ? TRUE : FALSE,
+			   "Port_Init writes the protected pin");
+	PortTest_CheckLocked("Port_Init relocks the port");
+	
+	/* Port_SetPinMode() opens and closes its own session inside the caller's one */
+	Port_CommitSessionOpen(PORT_DIO_PORTF, PORT_TEST_PF0);
+	Port_SetPinMode(PORT_PIN_F0, PORT_PIN_DIO);
+	PortTest_CheckCommitted(0, "Port_SetPinMode keeps the outer session unlocked");
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	PortTest_CheckLocked("closing the outer session relocks the port");
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET), 0xFF);
+	Test_Check((0 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPUR_OFFSET)) & PORT_TEST_PF0)) ? TRUE : FALSE,
+			   "protected pin unchanged after the session");
+	
+	/* Port_Init() inside a session */
+	Port_CommitSessionOpen(PORT_DIO_PORTF, PORT_TEST_PF0);
+	Port_Init(&PortTest_Config);
+	PortTest_CheckCommitted(0, "Port_Init keeps the outer session unlocked");
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	PortTest_CheckLocked("closing the outer session after Port_Init relocks the port");
+	
+	/* Sessions nested by the caller itself */
+	Port_CommitSessionOpen(PORT_DIO_PORTF, 0);
+	Port_CommitSessionOpen(PORT_DIO_PORTF, PORT_TEST_PF0);
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	PortTest_CheckCommitted(PORT_TEST_PF0, "inner session adds its pins to the outer one");
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	PortTest_CheckLocked("outer session restores GPIOCR");
+	
+	/* Extra close without an open session */
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	Port_CommitSessionOpen(PORT_DIO_PORTF, PORT_TEST_PF0);
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	PortTest_CheckLocked("close without a session is ignored");
+	
+	/* Ports which don't exist aren't used as an index, also without PortDevErrorDetect */
+	Port_CommitSessionOpen(PORT_DIO_PORTF, PORT_TEST_PF0);
+	Port_CommitSessionOpen((Port_PortType)HW_NO_OF_PORTS, 0xFF);
+	Port_CommitSessionClose((Port_PortType)HW_NO_OF_PORTS);
+	Port_CommitSessionClose((Port_PortType)0xFF);
+	PortTest_CheckCommitted(PORT_TEST_PF0, "session of a missing port leaves the open one");
+	Port_CommitSessionClose(PORT_DIO_PORTF);
+	PortTest_CheckLocked("open session is relocked by its own close");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "session of a missing port writes nothing");
+}
+
+/**
+ *	\brief		Port_Init() with a port whose clock doesn't get ready.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_Clocks(void)
+{
+	HW_RegsModelReset();
+	HW_RegsModelHoldPorts((uint8)(1 << PORT_DIO_PORTD));
+	Port_Init(&PortTest_ClockConfig);
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "port not ready isn't accessed");
+	Test_Check((0x02 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) & 0x02)) ? TRUE : FALSE,
+			   "ready port is configured");
+	PortTest_CheckLocked("ready port is relocked");
+}
+
+/**
+ *	\brief		Port_SetPinMode() with pins which don't exist.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_PinModeRange(void)
+{
+	/* Needed Variables */
+	uint32 PortTest_Pctl;
+	
+	HW_RegsModelReset();
+	Port_Init(&PortTest_ClockConfig);
+	PortTest_Pctl = HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPCTL_OFFSET));
+	
+	/* PA10 shares its table row with PB2 (I2C0SCL), PF13 and 0xFF index past the table */
+	Port_SetPinMode((Port_PinType)0x0A, PORT_PIN_I2C);
+	Port_SetPinMode((Port_PinType)0x5D, PORT_PIN_DIO);
+	Port_SetPinMode((Port_PinType)0xFF, PORT_PIN_DIO);
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "pins out of the table aren't written");
+	
+	/* PF5 is in the table but doesn't exist */
+	Port_SetPinMode((Port_PinType)0x55, PORT_PIN_DIO);
+	Test_Check((PortTest_Pctl == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPCTL_OFFSET))) ? TRUE : FALSE,
+			   "missing pin isn't written");
+	PortTest_CheckLocked("port of a missing pin stays locked");
+	
+	/* M1FAULT0 is the PWM function of PF4, on PMC 5 as the other PWM module 1 signals */
+	Port_SetPinMode(PORT_PIN_F4, PORT_PIN_PWM);
+	Test_Check((0x00050000 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPCTL_OFFSET)) & 0x000F0000)) ? TRUE : FALSE,
+			   "PF4 PWM routed to M1FAULT0");
+}
+
+/**
+ *	\brief		Port_Init() with modes which aren't available or don't exist.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_InitModes(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&PortTest_ModeConfig);
+	Test_Check((0x02 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) & 0x0E)) ? TRUE : FALSE,
+			   "only the pin with an available mode is configured");
+	Test_Check((0 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIOPCTL_OFFSET)) & 0xFFF0)) ? TRUE : FALSE,
+			   "no PCTL encoding written for the skipped pins");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "skipped pins cause no faults");
+}
+
+/**
+ *	\brief		Port_Init() with pins of ports which don't exist.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_InitPorts(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&PortTest_PortConfig);
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "pins of missing ports aren't written");
+	Test_Check((0x02 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) & 0x06)) ? TRUE : FALSE,
+			   "pin of an existing port is configured");
+	
+	/* The skipped unchangeable pins record no direction to be refreshed */
+	Port_SetPinDirection(PORT_PIN_F1, PORT_PIN_IN);
+	Port_RefreshPortDirection();
+	Test_Check((0 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) & 0x06)) ? TRUE : FALSE,
+			   "no direction refreshed for the skipped pins");
+}
+
+/**
+ *	\brief		Port_Init() of a port whose pins are all in the configuration set.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_InitOwned(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&PortTest_OwnedConfig);
+	
+	/* Values left by an earlier configuration, the stores replace every bit */
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODIR_OFFSET), 0xC0);
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODR2R_OFFSET), 0x3C);
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIOPUR_OFFSET), 0x3F);
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODEN_OFFSET), 0x00);
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIOAFSEL_OFFSET), 0xFC);
+	HW_W_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIOPCTL_OFFSET), 0xFFFF0000);
+	Port_Init(&PortTest_OwnedConfig);
+	
+	Test_Check((0x3F == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODIR_OFFSET))) ? TRUE : FALSE,
+			   "owned port direction stored");
+	Test_Check((0x3C == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODR8R_OFFSET))) &&
+			   (0 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODR2R_OFFSET)) & 0x3C)) ? TRUE : FALSE,
+			   "owned port drive strength stored");
+	Test_Check((0xC0 == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIOPUR_OFFSET))) ? TRUE : FALSE,
+			   "owned port pull-ups stored");
+	Test_Check((0xFF == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIODEN_OFFSET))) &&
+			   (0x03 == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIOAFSEL_OFFSET))) ? TRUE : FALSE,
+			   "owned port digital enable and alternate functions stored");
+	Test_Check((0x11 == HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTB, HW_GPIOPCTL_OFFSET))) ? TRUE : FALSE,
+			   "owned port signals routed");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "owned port causes no faults");
+}
+
+/**
+ *	\brief		Port_SetPinDirection() on changeable and unchangeable pins.
+ *	\param		None.
+ *	\return		None.
+ */
+static void PortTest_Direction(void)
+{
+	HW_RegsModelReset();
+	Port_Init(&PortTest_DirectionConfig);
+	Port_SetPinDirection(PORT_PIN_F1, PORT_PIN_IN);
+	Port_SetPinDirection(PORT_PIN_F2, PORT_PIN_IN);
+	Test_Check((0x02 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) & 0x06)) ? TRUE : FALSE,
+			   "only the changeable pin is an input");
+	Port_RefreshPortDirection();
+	Test_Check((0x02 == (HW_R_8RIG(PORT_TEST_REG(PORT_DIO_PORTF, HW_GPIODIR_OFFSET)) & 0x06)) ? TRUE : FALSE,
+			   "refresh keeps the changed direction");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	PortTest_Sessions();
+	PortTest_Clocks();
+	PortTest_PinModeRange();
+	PortTest_InitModes();
+	PortTest_InitPorts();
+	PortTest_InitOwned();
+	PortTest_Direction();
+	
+	return Test_Summary();
+}
@@ -0,0 +1,360 @@
+/**
+ *  \file	RegsModelTest.c
+ *  \brief 	Host unit tests of the register model (TivaRegsModel.h) against the GPIO
+ *  		behaviour of the datasheet the drivers rely on:
+ *  		-	GPIODATA address masking on writes and reads, reads gated by GPIODEN.
+ *  		-	GPIOLOCK / GPIOCR commit gating of the protected pins (PC0-3, PD7, PF0).
+ *  		-	Write-1-to-clear GPIOICR and read only GPIORIS / GPIOMIS.
+ *  		-	Faults on an access to a port whose clock is off or which is kept not ready.
+ *  		-	The pins hook: called after the GPIODATA accesses only, a device modelled by the
+ *  			hook answering the stores on the pins.
+ *  		Build and run (from the repository root):
+ *  		gcc -I"common files" -ITools Tools/RegsModelTest/RegsModelTest.c "common files/"Tiva*.c -o RegsModelTest
+ *  		./RegsModelTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+/* Macros */
+/* Port ID of PORT B in the model */
+#define REGS_MODEL_TEST_PORTB	1
+
+/* Register of a port of the APB aperture */
+#define REGS_MODEL_TEST_REG(PORT_BASE, OFFSET)	((PORT_BASE) + (OFFSET))
+
+/* GPIODATA address of a port masked to some of its pins */
+#define REGS_MODEL_TEST_DATA(PORT_BASE, MASK)	((PORT_BASE) + HW_GPIODATA_OFFSET + ((HW_AddressBusSizeType)(MASK) << 2))
+
+/* Private Variables */
+static uint16 RegsModelTest_Reads = 0;	/*!< GPIODATA reads seen by the hook */
+static uint16 RegsModelTest_Writes = 0;	/*!< GPIODATA writes seen by the hook */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Resets the model and turns the clocks of every port on.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Reset(void);
+
+/**
+ *	\brief		GPIODATA masked writes and reads.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Data(void);
+
+/**
+ *	\brief		GPIOLOCK / GPIOCR commit gating.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Commit(void);
+
+/**
+ *	\brief		Interrupt status registers: GPIORIS, GPIOMIS and GPIOICR.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Interrupts(void);
+
+/**
+ *	\brief		Faults of the accesses to a port whose clock is off.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Clocks(void);
+
+/**
+ *	\brief		Pins hook of the test, counts the accesses and drives B7 with the level of B0.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Written: 	TRUE for a write.
+ *	\return		None.
+ */
+static void RegsModelTest_Echo(uint8 PortId, boolean Written);
+
+/**
+ *	\brief		Pins hook called after the GPIODATA accesses.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Hook(void);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Resets the model and turns the clocks of every port on.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Reset(void)
+{
+	HW_RegsModelReset();
+	HW_RegsModelWrite(HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET, 0x3F);
+}
+
+/**
+ *	\brief		GPIODATA masked writes and reads.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Data(void)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType RegsModelTest_Base = HW_GPIOPORTB_APB_BASE;
+	
+	RegsModelTest_Reset();
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODIR_OFFSET), 0xFF);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0xFF);
+	
+	/* Address bits 9:2 select the pins written, the other pins keep their levels */
+	HW_RegsModelWrite(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x0F), 0xFF);
+	Test_Check((0x0F == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0xFF))) ? TRUE : FALSE,
+			   "masked write sets the masked pins only");
+	HW_RegsModelWrite(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x81), 0x00);
+	Test_Check((0x0E == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0xFF))) ? TRUE : FALSE,
+			   "masked write clears the masked pins only");
+	HW_RegsModelWrite(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x00), 0xFF);
+	Test_Check((0x0E == HW_RegsModelGetPins(REGS_MODEL_TEST_PORTB)) ? TRUE : FALSE,
+			   "write without mask changes nothing");
+	
+	/* Reads return 0 for the pins outside of the mask */
+	Test_Check((0x06 == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x07))) ? TRUE : FALSE,
+			   "masked read");
+	Test_Check((0x00 == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0xF1))) ? TRUE : FALSE,
+			   "masked read of low pins");
+	
+	/* Inputs read the driven levels, pins without digital function read 0 */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODIR_OFFSET), 0x0F);
+	HW_RegsModelDrivePins(REGS_MODEL_TEST_PORTB, 0xF0, 0xA0);
+	Test_Check((0xAE == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0xFF))) ? TRUE : FALSE,
+			   "inputs read the driven levels");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0x7D);
+	Test_Check((0x2C == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0xFF))) ? TRUE : FALSE,
+			   "reads gated by GPIODEN");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "data accesses without faults");
+}
+
+/**
+ *	\brief		GPIOLOCK / GPIOCR commit gating.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Commit(void)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType RegsModelTest_Base = HW_GPIOPORTF_APB_BASE;
+	
+	RegsModelTest_Reset();
+	
+	/* Reset values of the commit of the protected pins */
+	Test_Check((0xF0 == HW_RegsModelRead(REGS_MODEL_TEST_REG(HW_GPIOPORTC_APB_BASE, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "PC0-3 not committed at reset");
+	Test_Check((0x7F == HW_RegsModelRead(REGS_MODEL_TEST_REG(HW_GPIOPORTD_APB_BASE, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "PD7 not committed at reset");
+	Test_Check((0xFE == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "PF0 not committed at reset");
+	Test_Check((1 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOLOCK_OFFSET))) ? TRUE : FALSE,
+			   "locked at reset");
+	
+	/* Locked: GPIOCR can't be written and the protected pin keeps its settings */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET), 0xFF);
+	Test_Check((0xFE == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "GPIOCR write ignored while locked");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0xFF);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOPUR_OFFSET), 0x11);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOAFSEL_OFFSET), 0x03);
+	Test_Check((0xFE == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET))) ? TRUE : FALSE,
+			   "GPIODEN of PF0 gated");
+	Test_Check((0x10 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOPUR_OFFSET))) ? TRUE : FALSE,
+			   "GPIOPUR of PF0 gated");
+	Test_Check((0x02 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOAFSEL_OFFSET))) ? TRUE : FALSE,
+			   "GPIOAFSEL of PF0 gated");
+	
+	/* A wrong key keeps the port locked */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOLOCK_OFFSET), 0x12345678);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET), 0xFF);
+	Test_Check((0xFE == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "wrong key keeps the port locked");
+	
+	/* Unlocked: only the bit of the protected pin is writable */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOLOCK_OFFSET), HW_GPIO_UNLOCK_PATTERN);
+	Test_Check((0 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOLOCK_OFFSET))) ? TRUE : FALSE,
+			   "unlocked by the key");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET), 0x01);
+	Test_Check((0xFF == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "PF0 committed, other bits read only");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0xFF);
+	Test_Check((0xFF == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET))) ? TRUE : FALSE,
+			   "GPIODEN of PF0 written once committed");
+	
+	/* The commit stays after the port is locked again, until GPIOCR is cleared while unlocked */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOLOCK_OFFSET), 0);
+	Test_Check((1 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOLOCK_OFFSET))) ? TRUE : FALSE,
+			   "locked again");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0x00);
+	Test_Check((0x00 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET))) ? TRUE : FALSE,
+			   "commit kept after locking");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET), 0x00);
+	Test_Check((0xFF == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOCR_OFFSET))) ? TRUE : FALSE,
+			   "GPIOCR not cleared while locked");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "commit accesses without faults");
+}
+
+/**
+ *	\brief		Interrupt status registers: GPIORIS, GPIOMIS and GPIOICR.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Interrupts(void)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType RegsModelTest_Base = HW_GPIOPORTB_APB_BASE;
+	
+	RegsModelTest_Reset();
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0xFF);
+	
+	/* PB0 falling edge, PB1 high level, PB2 both edges */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOIS_OFFSET), 0x02);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOIBE_OFFSET), 0x04);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOIEV_OFFSET), 0x02);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOICR_OFFSET), 0xFF);
+	
+	HW_RegsModelDrivePins(REGS_MODEL_TEST_PORTB, 0x07, 0x01);
+	HW_RegsModelDrivePins(REGS_MODEL_TEST_PORTB, 0x07, 0x06);
+	Test_Check((0x07 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIORIS_OFFSET))) ? TRUE : FALSE,
+			   "edges and level latched in GPIORIS");
+	Test_Check((0x00 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOMIS_OFFSET))) ? TRUE : FALSE,
+			   "GPIOMIS masked by GPIOIM");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOIM_OFFSET), 0x05);
+	Test_Check((0x05 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOMIS_OFFSET))) ? TRUE : FALSE,
+			   "GPIOMIS is GPIORIS and GPIOIM");
+	
+	/* GPIORIS and GPIOMIS are read only */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIORIS_OFFSET), 0x00);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOMIS_OFFSET), 0x00);
+	Test_Check((0x07 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIORIS_OFFSET))) ? TRUE : FALSE,
+			   "GPIORIS / GPIOMIS writes ignored");
+	
+	/* GPIOICR clears the bits written 1 and reads 0 */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOICR_OFFSET), 0x04);
+	Test_Check((0x03 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIORIS_OFFSET))) ? TRUE : FALSE,
+			   "GPIOICR clears the bits written 1 only");
+	Test_Check((0x00 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOICR_OFFSET))) ? TRUE : FALSE,
+			   "GPIOICR reads 0");
+	
+	/* A level interrupt stays while the level is active */
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOICR_OFFSET), 0x03);
+	Test_Check((0x02 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIORIS_OFFSET))) ? TRUE : FALSE,
+			   "level interrupt not cleared while active");
+	HW_RegsModelDrivePins(REGS_MODEL_TEST_PORTB, 0x07, 0x04);
+	Test_Check((0x00 == HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIORIS_OFFSET))) ? TRUE : FALSE,
+			   "level interrupt follows the level");
+	Test_Check((0 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "interrupt accesses without faults");
+}
+
+/**
+ *	\brief		Faults of the accesses to a port whose clock is off.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Clocks(void)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType RegsModelTest_Fault = 0;
+	
+	HW_RegsModelReset();
+	HW_RegsModelWrite(HW_SYSTEM_CONTROL_BA + HW_RCGCGPIO_OFFSET, 0x20);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(HW_GPIOPORTB_APB_BASE, HW_GPIODIR_OFFSET), 0xFF);
+	Test_Check((0 == HW_RegsModelRead(REGS_MODEL_TEST_REG(HW_GPIOPORTB_APB_BASE, HW_GPIODIR_OFFSET))) ? TRUE : FALSE,
+			   "write dropped with the clock off");
+	Test_Check(((2 == HW_RegsModelGetFaults(&RegsModelTest_Fault)) &&
+				(REGS_MODEL_TEST_REG(HW_GPIOPORTB_APB_BASE, HW_GPIODIR_OFFSET) == RegsModelTest_Fault)) ? TRUE : FALSE,
+			   "accesses with the clock off fault");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(HW_GPIOPORTF_AHB_BASE, HW_GPIODIR_OFFSET), 0xFF);
+	Test_Check((3 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "access through the other aperture faults");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(HW_GPIOPORTF_APB_BASE, HW_GPIODIR_OFFSET), 0xFF);
+	Test_Check((3 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "access with the clock on");
+	
+	/* A port kept not ready faults with its clock on */
+	HW_RegsModelHoldPorts(0x20);
+	Test_Check((0 == (HW_RegsModelRead(HW_SYSTEM_CONTROL_BA + HW_PRGPIO_OFFSET) & 0x20)) ? TRUE : FALSE,
+			   "port kept not ready reads not ready");
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(HW_GPIOPORTF_APB_BASE, HW_GPIODIR_OFFSET), 0xFF);
+	Test_Check((4 == HW_RegsModelGetFaults(NULL_PTR)) ? TRUE : FALSE, "access to a port kept not ready faults");
+}
+
+/**
+ *	\brief		Pins hook of the test, counts the accesses and drives B7 with the level of B0.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Written: 	TRUE for a write.
+ *	\return		None.
+ */
+static void RegsModelTest_Echo(uint8 PortId, boolean Written)
+{
+	if(TRUE == Written)
+	{
+		RegsModelTest_Writes++;
+	}
+	else
+	{
+		RegsModelTest_Reads++;
+	}
+	HW_RegsModelDrivePins(PortId, 0x80, (uint8)(HW_RegsModelGetPins(PortId) << 7));
+}
+
+/**
+ *	\brief		Pins hook called after the GPIODATA accesses.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RegsModelTest_Hook(void)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType RegsModelTest_Base = HW_GPIOPORTB_APB_BASE;
+	
+	RegsModelTest_Reset();
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODIR_OFFSET), 0x01);
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODEN_OFFSET), 0xFF);
+	HW_RegsModelSetPinsHook(RegsModelTest_Echo);
+	
+	/* B0 is an output, the device drives the input B7 with its level */
+	HW_RegsModelWrite(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x01), 0x01);
+	Test_Check((0x81 == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x81))) ? TRUE : FALSE,
+			   "hook answers a store on the pins");
+	HW_RegsModelWrite(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x01), 0x00);
+	Test_Check((0x00 == HW_RegsModelRead(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x81))) ? TRUE : FALSE,
+			   "hook sees the updated pins");
+	
+	/* Other registers don't call it, the reset clears it */
+	(void)HW_RegsModelRead(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIODIR_OFFSET));
+	HW_RegsModelWrite(REGS_MODEL_TEST_REG(RegsModelTest_Base, HW_GPIOIM_OFFSET), 0x00);
+	Test_Check(((2 == RegsModelTest_Reads) && (2 == RegsModelTest_Writes)) ? TRUE : FALSE,
+			   "hook called after the GPIODATA accesses only");
+	RegsModelTest_Reset();
+	HW_RegsModelWrite(REGS_MODEL_TEST_DATA(RegsModelTest_Base, 0x01), 0x01);
+	Test_Check((2 == RegsModelTest_Writes) ? TRUE : FALSE, "hook cleared by the reset");
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the checks.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(void)
+{
+	RegsModelTest_Data();
+	RegsModelTest_Commit();
+	RegsModelTest_Interrupts();
+	RegsModelTest_Clocks();
+	RegsModelTest_Hook();
+	
+	return Test_Summary();
+}
@@ -0,0 +1,303 @@
+/**
+ *  \file	RingStressTest.c
+ *  \brief 	Linux stress test of the ring buffers shared between the task and the interrupts,
+ *  		with threads standing for them on the host register model (TivaRegsModel.h):
+ *  		-	Det_ReportError() called by several producer threads at once: no report is
+ *  			lost, no entry of Det_ErrorBuffer is torn and the entries of a producer are
+ *  			kept in their reporting order.
+ *  		-	DioEventQueue pushed by a producer thread (the GPIO interrupts) while a
+ *  			consumer thread (the task) drains it: every event is drained once, in order
+ *  			and intact.
+ *  		Usage: RingStressTest [-q]		-q for a short run.
+ *  		Build and run (from the repository root):
+ *  		gcc -O2 -pthread -I"common files" -ITools -IIO/DIO -IIO/PortDriver -IServices/Det
+ *  			Tools/RingStressTest/RingStressTest.c IO/DIO/DIO.c IO/DIO/DioShadow.c
+ *  			IO/DIO/DioEventQueue.c "common files/"Tiva*.c Services/Det/Det.c -o RingStressTest
+ *  		./RingStressTest
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "DIO.h"
+#include "DioEventQueue.h"
+#include "Det.h"
+#include "TivaRegsModel.h"
+#include "TestHarness.h"
+
+/* Macros */
+#define RING_STRESS_DET_PRODUCERS	4			/*!< Threads reporting errors at once */
+#define RING_STRESS_DET_REPORTS		10000000	/*!< Errors reported by every thread */
+#define RING_STRESS_EVENTS			2000000		/*!< Events pushed through the queue */
+#define RING_STRESS_DRAIN_BATCH		8			/*!< Events drained at most per call */
+#define RING_STRESS_QUICK_DIVIDER	20			/*!< Reports and events divider of a short run */
+
+/* Check byte of a report, a torn entry mixes the fields of two reports and fails it */
+#define RING_STRESS_DET_CHECK(MODULE_ID, API_ID, ERROR_ID)	(uint8)(((MODULE_ID) * 31) ^ ((API_ID) * 7) ^ (ERROR_ID))
+
+/* Channel and edge of the event of a sequence number, every port and pin in turn */
+#define RING_STRESS_CHANNEL(SEQUENCE)	(Dio_ChannelType)(((((SEQUENCE) >> 3) % HW_NO_OF_PORTS) << 4) | ((SEQUENCE) & 0x07))
+#define RING_STRESS_EDGE(SEQUENCE)		(Dio_EdgeType)(((SEQUENCE) >> 1) & 0x01)
+
+/* Private Variables */
+static uint32 RingStressTest_Reports = RING_STRESS_DET_REPORTS;	/*!< Errors reported by every thread */
+static uint32 RingStressTest_Events = RING_STRESS_EVENTS;		/*!< Events pushed through the queue */
+static pthread_barrier_t RingStressTest_Start;	/*!< Releases the Det producers together */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Producer thread of the Det reports, reports sequence numbers 0, 1 .. under its
+ *				module ID: bits 7:0 in the error ID, bits 15:8 in the API ID and the check
+ *				byte in the instance ID.
+ *	\param[in] 	ArgPtr: 	Module ID of the thread.
+ *	\return		void*: 		NULL.
+ */
+static void* RingStressTest_DetProducer(void* ArgPtr);
+
+/**
+ *	\brief		Reports from several threads at once and checks the ring buffer.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RingStressTest_Det(void);
+
+#if(DioEventQueueApi == STD_ON)
+/**
+ *	\brief		Producer thread of the events, pushes sequence numbers as timestamps and
+ *				retries an event while the queue is full.
+ *	\param[in] 	ArgPtr: 	Not used.
+ *	\return		void*: 		NULL.
+ */
+static void* RingStressTest_EventProducer(void* ArgPtr);
+
+/**
+ *	\brief		Drains the queue while the producer thread pushes and checks the events.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RingStressTest_EventQueue(void);
+#endif /* DioEventQueueApi check */
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Producer thread of the Det reports, reports sequence numbers 0, 1 .. under its
+ *				module ID: bits 7:0 in the error ID, bits 15:8 in the API ID and the check
+ *				byte in the instance ID.
+ *	\param[in] 	ArgPtr: 	Module ID of the thread.
+ *	\return		void*: 		NULL.
+ */
+static void* RingStressTest_DetProducer(void* ArgPtr)
+{
+	/* Needed Variables */
+	uint16 RingStressTest_ModuleId = (uint16)(unsigned long)ArgPtr;
+	uint8 RingStressTest_ApiId;
+	uint8 RingStressTest_ErrorId;
+	uint32 RingStressTest_Sequence;
+	
+	(void)pthread_barrier_wait(&RingStressTest_Start);
+	for(RingStressTest_Sequence = 0; RingStressTest_Sequence < RingStressTest_Reports; RingStressTest_Sequence++)
+	{
+		RingStressTest_ErrorId = (uint8)RingStressTest_Sequence;
+		RingStressTest_ApiId = (uint8)(RingStressTest_Sequence >> 8);
+		(void)Det_ReportError(RingStressTest_ModuleId,
+							  RING_STRESS_DET_CHECK(RingStressTest_ModuleId, RingStressTest_ApiId, RingStressTest_ErrorId),
+							  RingStressTest_ApiId, RingStressTest_ErrorId);
+	}
+	
+	return NULL;
+}
+
+/**
+ *	\brief		Reports from several threads at once and checks the ring buffer.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RingStressTest_Det(void)
+{
+	/* Needed Variables */
+	pthread_t RingStressTest_Threads[RING_STRESS_DET_PRODUCERS];
+	uint16 RingStressTest_Last[RING_STRESS_DET_PRODUCERS];
+	boolean RingStressTest_Seen[RING_STRESS_DET_PRODUCERS];
+	const Det_ErrorType* RingStressTest_EntryPtr;
+	boolean RingStressTest_Intact = TRUE;
+	boolean RingStressTest_Ordered = TRUE;
+	uint16 RingStressTest_Sequence;
+	uint32 RingStressTest_Index;
+	uint8 RingStressTest_Thread;
+	
+	Det_Init();
+	(void)pthread_barrier_init(&RingStressTest_Start, NULL, RING_STRESS_DET_PRODUCERS);
+	for(RingStressTest_Thread = 0; RingStressTest_Thread < RING_STRESS_DET_PRODUCERS; RingStressTest_Thread++)
+	{
+		RingStressTest_Seen[RingStressTest_Thread] = FALSE;
+		RingStressTest_Last[RingStressTest_Thread] = 0;
+		(void)pthread_create(&RingStressTest_Threads[RingStressTest_Thread], NULL, RingStressTest_DetProducer,
+							 (void*)(unsigned long)RingStressTest_Thread);
+	}
+	for(RingStressTest_Thread = 0; RingStressTest_Thread < RING_STRESS_DET_PRODUCERS; RingStressTest_Thread++)
+	{
+		(void)pthread_join(RingStressTest_Threads[RingStressTest_Thread], NULL);
+	}
+	(void)pthread_barrier_destroy(&RingStressTest_Start);
+	
+	Test_Check((((uint32)RING_STRESS_DET_PRODUCERS * RingStressTest_Reports) == Det_ErrorCount) ? TRUE : FALSE,
+			   "Det: every report counted");
+	
+	/* The buffer holds the last reports, oldest first from the next slot to be written */
+	for(RingStressTest_Index = 0; RingStressTest_Index < DetErrorBufferSize; RingStressTest_Index++)
+	{
+		RingStressTest_EntryPtr = &Det_ErrorBuffer[(Det_ErrorCount + RingStressTest_Index) % DetErrorBufferSize];
+		if((RingStressTest_EntryPtr->Det_ModuleId >= RING_STRESS_DET_PRODUCERS) ||
+		   (RingStressTest_EntryPtr->Det_InstanceId != RING_STRESS_DET_CHECK(RingStressTest_EntryPtr->Det_ModuleId,
+																			   RingStressTest_EntryPtr->Det_ApiId,
+																			   RingStressTest_EntryPtr->Det_ErrorId)))
+		{
+			RingStressTest_Intact = FALSE;
+		}
+		else
+		{
+			RingStressTest_Thread = (uint8)RingStressTest_EntryPtr->Det_ModuleId;
+			RingStressTest_Sequence = (uint16)((RingStressTest_EntryPtr->Det_ApiId << 8) | RingStressTest_EntryPtr->Det_ErrorId);
+			if((TRUE == RingStressTest_Seen[RingStressTest_Thread]) &&
+			   ((uint16)(RingStressTest_Sequence - RingStressTest_Last[RingStressTest_Thread]) > 0x8000))
+			{
+				RingStressTest_Ordered = FALSE;
+			}
+			else
+			{
+				/* First report of the thread or a later one */
+			}
+			RingStressTest_Seen[RingStressTest_Thread] = TRUE;
+			RingStressTest_Last[RingStressTest_Thread] = RingStressTest_Sequence;
+		}
+	}
+	Test_Check(RingStressTest_Intact, "Det: no torn entry");
+	Test_Check(RingStressTest_Ordered, "Det: entries of a thread in reporting order");
+}
+
+#if(DioEventQueueApi == STD_ON)
+/**
+ *	\brief		Producer thread of the events, pushes sequence numbers as timestamps and
+ *				retries an event while the queue is full.
+ *	\param[in] 	ArgPtr: 	Not used.
+ *	\return		void*: 		NULL.
+ */
+static void* RingStressTest_EventProducer(void* ArgPtr)
+{
+	/* Needed Variables */
+	uint32 RingStressTest_Sequence;
+	
+	(void)ArgPtr;
+	for(RingStressTest_Sequence = 0; RingStressTest_Sequence < RingStressTest_Events; RingStressTest_Sequence++)
+	{
+		while(E_OK != Dio_EventQueuePush(RING_STRESS_CHANNEL(RingStressTest_Sequence), RING_STRESS_EDGE(RingStressTest_Sequence),
+										 RingStressTest_Sequence))
+		{
+			/* Queue full, the consumer frees it */
+			(void)sched_yield();
+		}
+	}
+	
+	return NULL;
+}
+
+/**
+ *	\brief		Drains the queue while the producer thread pushes and checks the events.
+ *	\param		None.
+ *	\return		None.
+ */
+static void RingStressTest_EventQueue(void)
+{
+	/* Needed Variables */
+	pthread_t RingStressTest_Producer;
+	Dio_EventType RingStressTest_Batch[RING_STRESS_DRAIN_BATCH];
+	Dio_EventQueueStatsType RingStressTest_Stats;
+	boolean RingStressTest_InOrder = TRUE;
+	boolean RingStressTest_Intact = TRUE;
+	uint32 RingStressTest_Expected = 0;
+	uint8 RingStressTest_Count;
+	uint8 RingStressTest_Index;
+	
+	Dio_EventQueueInit();
+	(void)pthread_create(&RingStressTest_Producer, NULL, RingStressTest_EventProducer, NULL);
+	
+	while((RingStressTest_Expected < RingStressTest_Events) && (TRUE == RingStressTest_InOrder))
+	{
+		RingStressTest_Count = Dio_EventQueueDrain(RingStressTest_Batch, RING_STRESS_DRAIN_BATCH);
+		if(0 == RingStressTest_Count)
+		{
+			/* Queue empty, the producer fills it */
+			(void)sched_yield();
+		}
+		else
+		{
+			/* Events to be checked */
+		}
+		for(RingStressTest_Index = 0; RingStressTest_Index < RingStressTest_Count; RingStressTest_Index++)
+		{
+			if(RingStressTest_Batch[RingStressTest_Index].Dio_Timestamp != RingStressTest_Expected)
+			{
+				RingStressTest_InOrder = FALSE;
+			}
+			else if((RingStressTest_Batch[RingStressTest_Index].Dio_ChannelId != RING_STRESS_CHANNEL(RingStressTest_Expected)) ||
+					(RingStressTest_Batch[RingStressTest_Index].Dio_Edge != RING_STRESS_EDGE(RingStressTest_Expected)))
+			{
+				RingStressTest_Intact = FALSE;
+			}
+			else
+			{
+				/* Expected event */
+			}
+			RingStressTest_Expected++;
+		}
+	}
+	(void)pthread_join(RingStressTest_Producer, NULL);
+	
+	Dio_EventQueueGetStats(&RingStressTest_Stats);
+	Test_Check(RingStressTest_InOrder, "EventQueue: every event drained once in order");
+	Test_Check(RingStressTest_Intact, "EventQueue: no torn event");
+	Test_Check((0 == Dio_EventQueueDrain(RingStressTest_Batch, RING_STRESS_DRAIN_BATCH)) ? TRUE : FALSE,
+			   "EventQueue: empty after the last event");
+	Test_Check((RingStressTest_Stats.Dio_HighWater <= DioEventQueueSize) ? TRUE : FALSE,
+			   "EventQueue: high water mark within the queue");
+	printf("EventQueue: %lu events, %lu pushes found the queue full, high water mark %u\n",
+		   (unsigned long)RingStressTest_Events, (unsigned long)RingStressTest_Stats.Dio_Overflows,
+		   RingStressTest_Stats.Dio_HighWater);
+}
+#endif /* DioEventQueueApi check */
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Runs the stress tests.
+ *	\param[in] 	argc: 	Number of arguments.
+ *	\param[in] 	argv: 	Arguments, "-q" for a short run.
+ *	\return		int: 	0 if every check passed, 1 otherwise.
+ */
+int main(int argc, char* argv[])
+{
+	if((argc > 1) && (0 == strcmp(argv[1], "-q")))
+	{
+		RingStressTest_Reports /= RING_STRESS_QUICK_DIVIDER;
+		RingStressTest_Events /= RING_STRESS_QUICK_DIVIDER;
+	}
+	else
+	{
+		/* Full run */
+	}
+	
+	HW_RegsModelReset();
+	RingStressTest_Det();
+#if(DioEventQueueApi == STD_ON)
+#if(DioEventQueueCoalesce == STD_ON)
+	printf("EventQueue: skipped, DioEventQueueCoalesce merges the events of a channel\n");
+#else
+	RingStressTest_EventQueue();
+#endif /* DioEventQueueCoalesce check */
+#endif /* DioEventQueueApi check */
+	
+	return Test_Summary();
+}
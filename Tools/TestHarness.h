@@ -0,0 +1,58 @@
+/**
+ *  \file	TestHarness.h
+ *  \brief 	Checks counting shared by the host tests of Tools, included once by every test
+ *  		(built with -ITools): Test_Check() counts a check and prints it if it failed,
+ *  		Test_Summary() prints "<checks> checks, <failed> failed" and gives the exit
+ *  		status of the test.
+ *  		Not compiled for the target.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef TEST_HARNESS_H_
+#define TEST_HARNESS_H_
+
+/* Inclusion */
+#include <stdio.h>
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+
+/* Private Variables */
+static uint16 Test_Checks = 0;	/*!< Checks run */
+static uint16 Test_Failed = 0;	/*!< Checks failed */
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Counts a check and prints it if it failed.
+ *	\param[in] 	Passed: 	TRUE if the check passed.
+ *	\param[in] 	Name: 		Name of the check.
+ *	\return		None.
+ */
+static void Test_Check(boolean Passed, const char* Name)
+{
+	Test_Checks++;
+	if(TRUE != Passed)
+	{
+		Test_Failed++;
+		printf("FAIL: %s\n", Name);
+	}
+	else
+	{
+		/* Passed */
+	}
+}
+
+/**
+ *	\brief		Prints the number of checks run and failed.
+ *	\param		None.
+ *	\return		int: 	0 if every check passed, 1 otherwise, the exit status of the test.
+ */
+static int Test_Summary(void)
+{
+	printf("%u checks, %u failed\n", Test_Checks, Test_Failed);
+
+	return (0 == Test_Failed) ? 0 : 1;
+}
+
+#endif /* TEST_HARNESS_H_ */
@@ -0,0 +1,490 @@
+/**
+ *  \file	TivaAccounting.c
+ *  \brief 	Registers access accounting.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "TivaAccounting.h"
+
+#if(HW_ACCESS_ACCOUNTING == 1)
+/* Macros */
+/* Bit-band alias of the peripherals region */
+#define HW_ACCOUNTING_BITBAND_SIZE	0x02000000
+
+/* Check that an address is in the bit-band alias of the peripherals */
+#define HW_ACCOUNTING_IS_ALIAS(ADDRESS)	\
+	(((ADDRESS) >= HW_PERIPH_BITBAND_BA) && ((ADDRESS) < (HW_PERIPH_BITBAND_BA + HW_ACCOUNTING_BITBAND_SIZE)))
+
+/* Number of GPIO ports base addresses, APB and AHB */
+#define HW_ACCOUNTING_GPIO_BASES	(2 * HW_NO_OF_PORTS)
+
+/* Private Variables */
+static const HW_AddressBusSizeType HW_AccountingGpioBases[HW_ACCOUNTING_GPIO_BASES] = {
+	HW_GPIOPORTA_APB_BASE, HW_GPIOPORTB_APB_BASE, HW_GPIOPORTC_APB_BASE,
+	HW_GPIOPORTD_APB_BASE, HW_GPIOPORTE_APB_BASE, HW_GPIOPORTF_APB_BASE,
+	HW_GPIOPORTA_AHB_BASE, HW_GPIOPORTB_AHB_BASE, HW_GPIOPORTC_AHB_BASE,
+	HW_GPIOPORTD_AHB_BASE, HW_GPIOPORTE_AHB_BASE, HW_GPIOPORTF_AHB_BASE
+};	/*!< Base addresses of the GPIO ports */
+
+static const char* HW_AccountingApis[HW_ACCOUNTING_APIS];		/*!< Names of the counted APIs */
+static uint32 HW_AccountingCalls[HW_ACCOUNTING_APIS];			/*!< Calls of every counted API */
+static uint8 HW_AccountingNoOfApis;								/*!< Number of counted APIs */
+static const char* HW_AccountingApi;							/*!< API the accesses are counted under */
+static HW_AccountingEntryType HW_AccountingEntries[HW_ACCOUNTING_ENTRIES];	/*!< Counted (API, register) pairs */
+static uint16 HW_AccountingNoOfEntries;							/*!< Number of counted pairs */
+static uint32 HW_AccountingDropped;								/*!< Accesses not counted, the tables are full */
+static HW_AccountingEntryType* HW_AccountingLastRead;			/*!< Pair of the last access if it is a read */
+static boolean HW_AccountingSuspended;							/*!< TRUE while the accesses aren't counted */
+static const char* HW_AccountingSampleNames[HW_ACCOUNTING_SAMPLES];	/*!< Names of the recorded measurements */
+static HW_AccountingSampleType HW_AccountingSamples[HW_ACCOUNTING_SAMPLES];	/*!< Samples of every measurement */
+static uint8 HW_AccountingNoOfSamples;							/*!< Number of recorded measurements */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Compares two API names.
+ *	\param[in] 	Name1: 	First name, may be NULL_PTR.
+ *	\param[in] 	Name2: 	Second name, may be NULL_PTR.
+ *	\return		boolean:	TRUE if both are NULL_PTR or hold the same string.
+ */
+static boolean HW_AccountingSameName(const char* Name1, const char* Name2);
+
+/**
+ *	\brief		Returns the register counted for an accessed address: the GPIODATA aliases
+ *				are GPIODATA and a bit-band alias is its aliased register.
+ *	\param[in] 	Address: 	Accessed address.
+ *	\return		HW_AddressBusSizeType: 	Counted register.
+ */
+static HW_AddressBusSizeType HW_AccountingRegister(HW_AddressBusSizeType Address);
+
+/**
+ *	\brief		Finds the pair of the current API and of a register, a new pair is taken if
+ *				it isn't counted yet.
+ *	\param[in] 	Address: 	Accessed address.
+ *	\return		HW_AccountingEntryType*:	Pointer to the pair, NULL_PTR if the table is full.
+ */
+static HW_AccountingEntryType* HW_AccountingFindEntry(HW_AddressBusSizeType Address);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Compares two API names.
+ *	\param[in] 	Name1: 	First name, may be NULL_PTR.
+ *	\param[in] 	Name2: 	Second name, may be NULL_PTR.
+ *	\return		boolean:	TRUE if both are NULL_PTR or hold the same string.
+ */
+static boolean HW_AccountingSameName(const char* Name1, const char* Name2)
+{
+	/* Needed Variables */
+	boolean HW_Same = (Name1 == Name2) ? TRUE : FALSE;
+	
+	if((FALSE == HW_Same) && (NULL_PTR != Name1) && (NULL_PTR != Name2))
+	{
+		while(((*Name1) == (*Name2)) && ('\0' != (*Name1)))
+		{
+			Name1++;
+			Name2++;
+		}
+		HW_Same = ((*Name1) == (*Name2)) ? TRUE : FALSE;
+	}
+	else
+	{
+		/* Same pointer or a single NULL_PTR */
+	}
+	
+	return HW_Same;
+}
+
+/**
+ *	\brief		Returns the register counted for an accessed address: the GPIODATA aliases
+ *				are GPIODATA and a bit-band alias is its aliased register.
+ *	\param[in] 	Address: 	Accessed address.
+ *	\return		HW_AddressBusSizeType: 	Counted register.
+ */
+static HW_AddressBusSizeType HW_AccountingRegister(HW_AddressBusSizeType Address)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType HW_Register = Address;
+	uint8 HW_Index;
+	
+	if(HW_ACCOUNTING_IS_ALIAS(Address))
+	{
+		HW_Register = HW_PERIPH_BA + (((Address - HW_PERIPH_BITBAND_BA) >> 5) & ~(HW_AddressBusSizeType)0x03);
+	}
+	else
+	{
+		/* Not an alias */
+	}
+	
+	if((HW_Register & 0xFFF) < HW_GPIODIR_OFFSET)
+	{
+		for(HW_Index = 0; HW_Index < HW_ACCOUNTING_GPIO_BASES; HW_Index++)
+		{
+			if((HW_Register & ~(HW_AddressBusSizeType)0xFFF) == HW_AccountingGpioBases[HW_Index])
+			{
+				HW_Register = HW_AccountingGpioBases[HW_Index] + HW_GPIODATA_OFFSET;
+			}
+			else
+			{
+				/* Another port */
+			}
+		}
+	}
+	else
+	{
+		/* Not a GPIODATA alias */
+	}
+	
+	return HW_Register;
+}
+
+/**
+ *	\brief		Finds the pair of the current API and of a register, a new pair is taken if
+ *				it isn't counted yet.
+ *	\param[in] 	Address: 	Accessed address.
+ *	\return		HW_AccountingEntryType*:	Pointer to the pair, NULL_PTR if the table is full.
+ */
+static HW_AccountingEntryType* HW_AccountingFindEntry(HW_AddressBusSizeType Address)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType HW_Register = HW_AccountingRegister(Address);
+	HW_AccountingEntryType* HW_EntryPtr = NULL_PTR;
+	uint16 HW_Index;
+	
+	/* API names are interned by HW_AccountingBegin(), pointers can be compared */
+	for(HW_Index = 0; (HW_Index < HW_AccountingNoOfEntries) && (NULL_PTR == HW_EntryPtr); HW_Index++)
+	{
+		if((HW_AccountingEntries[HW_Index].HW_Api == HW_AccountingApi) &&
+		   (HW_AccountingEntries[HW_Index].HW_Register == HW_Register))
+		{
+			HW_EntryPtr = &HW_AccountingEntries[HW_Index];
+		}
+		else
+		{
+			/* Another pair */
+		}
+	}
+	
+	if((NULL_PTR == HW_EntryPtr) && (HW_AccountingNoOfEntries < HW_ACCOUNTING_ENTRIES))
+	{
+		HW_EntryPtr = &HW_AccountingEntries[HW_AccountingNoOfEntries];
+		HW_EntryPtr->HW_Api = HW_AccountingApi;
+		HW_EntryPtr->HW_Register = HW_Register;
+		HW_EntryPtr->HW_Counts.HW_Reads = 0;
+		HW_EntryPtr->HW_Counts.HW_Writes = 0;
+		HW_EntryPtr->HW_Counts.HW_Modifies = 0;
+		HW_AccountingNoOfEntries++;
+	}
+	else if(NULL_PTR == HW_EntryPtr)
+	{
+		HW_AccountingDropped++;
+	}
+	else
+	{
+		/* Pair already counted */
+	}
+	
+	return HW_EntryPtr;
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Clears all the counts and the APIs.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_AccountingReset(void)
+{
+	HW_AccountingNoOfApis = 0;
+	HW_AccountingApi = NULL_PTR;
+	HW_AccountingNoOfEntries = 0;
+	HW_AccountingDropped = 0;
+	HW_AccountingLastRead = NULL_PTR;
+	HW_AccountingSuspended = FALSE;
+	HW_AccountingNoOfSamples = 0;
+}
+
+/**
+ *	\brief		Suspends or resumes the counting, e.g. while timing the services.
+ *	\param[in] 	Suspend: 	TRUE: the following accesses aren't counted, FALSE: they are.
+ *	\return		None.
+ */
+void HW_AccountingSuspend(boolean Suspend)
+{
+	HW_AccountingSuspended = Suspend;
+	HW_AccountingLastRead = NULL_PTR;
+}
+
+/**
+ *	\brief		Counts the following accesses under an API and counts a call of it.
+ *	\param[in] 	ApiName: 	Name of the API, it has to stay valid until the reset.
+ *	\return		None.
+ */
+void HW_AccountingBegin(const char* ApiName)
+{
+	/* Needed Variables */
+	uint8 HW_Index;
+	
+	for(HW_Index = 0; (HW_Index < HW_AccountingNoOfApis) &&
+					  (FALSE == HW_AccountingSameName(HW_AccountingApis[HW_Index], ApiName)); HW_Index++)
+	{
+		/* Look for the API */
+	}
+	
+	if((HW_Index == HW_AccountingNoOfApis) && (HW_AccountingNoOfApis < HW_ACCOUNTING_APIS))
+	{
+		HW_AccountingApis[HW_Index] = ApiName;
+		HW_AccountingCalls[HW_Index] = 0;
+		HW_AccountingNoOfApis++;
+	}
+	else
+	{
+		/* Known API, or no room for a new one */
+	}
+	
+	if(HW_Index < HW_AccountingNoOfApis)
+	{
+		HW_AccountingCalls[HW_Index]++;
+		HW_AccountingApi = HW_AccountingApis[HW_Index];
+	}
+	else
+	{
+		HW_AccountingApi = NULL_PTR;
+	}
+	HW_AccountingLastRead = NULL_PTR;
+}
+
+/**
+ *	\brief		Counts the following accesses under no API.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_AccountingEnd(void)
+{
+	HW_AccountingApi = NULL_PTR;
+	HW_AccountingLastRead = NULL_PTR;
+}
+
+/**
+ *	\brief		Counts a read, called by HW_R_8RIG.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		None.
+ */
+void HW_AccountingRead(uint32 Address)
+{
+	/* Needed Variables */
+	HW_AccountingEntryType* HW_EntryPtr = (FALSE == HW_AccountingSuspended) ? HW_AccountingFindEntry(Address) : NULL_PTR;
+	
+	if(NULL_PTR != HW_EntryPtr)
+	{
+		HW_EntryPtr->HW_Counts.HW_Reads++;
+	}
+	else
+	{
+		/* Dropped or suspended */
+	}
+	HW_AccountingLastRead = HW_EntryPtr;
+}
+
+/**
+ *	\brief		Counts a write, a read-modify-write if the last access read the same register.
+ *				Called by HW_W_8RIG.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		None.
+ */
+void HW_AccountingWrite(uint32 Address)
+{
+	/* Needed Variables */
+	HW_AccountingEntryType* HW_EntryPtr = (FALSE == HW_AccountingSuspended) ? HW_AccountingFindEntry(Address) : NULL_PTR;
+	
+	if(NULL_PTR == HW_EntryPtr)
+	{
+		/* Dropped or suspended */
+	}
+	else if((HW_EntryPtr == HW_AccountingLastRead) || HW_ACCOUNTING_IS_ALIAS(Address))
+	{
+		/* The read is part of the read-modify-write, a bit-band write is one on the bus */
+		HW_EntryPtr->HW_Counts.HW_Reads -= (HW_EntryPtr == HW_AccountingLastRead) ? 1 : 0;
+		HW_EntryPtr->HW_Counts.HW_Modifies++;
+	}
+	else
+	{
+		HW_EntryPtr->HW_Counts.HW_Writes++;
+	}
+	HW_AccountingLastRead = NULL_PTR;
+}
+
+/**
+ *	\brief		Counts a read-modify-write, called by HW_S_BIT / HW_C_BIT.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		None.
+ */
+void HW_AccountingModify(uint32 Address)
+{
+	/* Needed Variables */
+	HW_AccountingEntryType* HW_EntryPtr = (FALSE == HW_AccountingSuspended) ? HW_AccountingFindEntry(Address) : NULL_PTR;
+	
+	if(NULL_PTR != HW_EntryPtr)
+	{
+		HW_EntryPtr->HW_Counts.HW_Modifies++;
+	}
+	else
+	{
+		/* Dropped or suspended */
+	}
+	HW_AccountingLastRead = NULL_PTR;
+}
+
+/**
+ *	\brief		Records a measurement sample, called by HW_ACCOUNTING_SAMPLE.
+ *				Samples are recorded even while the counting is suspended.
+ *	\param[in] 	SampleName: 	Name of the measurement, it has to stay valid until the reset.
+ *	\param[in] 	Value: 			Measured value.
+ *	\return		None.
+ */
+void HW_AccountingSample(const char* SampleName, uint32 Value)
+{
+	/* Needed Variables */
+	HW_AccountingSampleType* HW_SamplePtr;
+	uint8 HW_Index;
+	
+	for(HW_Index = 0; (HW_Index < HW_AccountingNoOfSamples) &&
+					  (FALSE == HW_AccountingSameName(HW_AccountingSampleNames[HW_Index], SampleName)); HW_Index++)
+	{
+		/* Look for the measurement */
+	}
+	
+	if((HW_Index == HW_AccountingNoOfSamples) && (HW_AccountingNoOfSamples < HW_ACCOUNTING_SAMPLES))
+	{
+		HW_AccountingSampleNames[HW_Index] = SampleName;
+		HW_AccountingSamples[HW_Index].HW_Count = 0;
+		HW_AccountingNoOfSamples++;
+	}
+	else
+	{
+		/* Known measurement, or no room for a new one */
+	}
+	
+	if(HW_Index < HW_AccountingNoOfSamples)
+	{
+		HW_SamplePtr = &HW_AccountingSamples[HW_Index];
+		if((0 == HW_SamplePtr->HW_Count) || (Value < HW_SamplePtr->HW_Min))
+		{
+			HW_SamplePtr->HW_Min = Value;
+		}
+		else
+		{
+			/* Not a new minimum */
+		}
+		if((0 == HW_SamplePtr->HW_Count) || (Value > HW_SamplePtr->HW_Max))
+		{
+			HW_SamplePtr->HW_Max = Value;
+		}
+		else
+		{
+			/* Not a new maximum */
+		}
+		HW_SamplePtr->HW_Last = Value;
+		HW_SamplePtr->HW_Count++;
+	}
+	else
+	{
+		/* Dropped, the table is full */
+	}
+}
+
+/**
+ *	\brief		Returns the samples of a measurement.
+ *	\param[in] 	SampleName: 	Name of the measurement.
+ *	\param[out] SamplePtr: 		Pointer to the samples, all 0 if none was recorded.
+ *	\return		uint32: 		Number of samples.
+ */
+uint32 HW_AccountingGetSample(const char* SampleName, HW_AccountingSampleType* SamplePtr)
+{
+	/* Needed Variables */
+	uint8 HW_Index;
+	
+	SamplePtr->HW_Count = 0;
+	SamplePtr->HW_Last = 0;
+	SamplePtr->HW_Min = 0;
+	SamplePtr->HW_Max = 0;
+	for(HW_Index = 0; HW_Index < HW_AccountingNoOfSamples; HW_Index++)
+	{
+		if(TRUE == HW_AccountingSameName(HW_AccountingSampleNames[HW_Index], SampleName))
+		{
+			*SamplePtr = HW_AccountingSamples[HW_Index];
+		}
+		else
+		{
+			/* Another measurement */
+		}
+	}
+	
+	return SamplePtr->HW_Count;
+}
+
+/**
+ *	\brief		Returns the accesses of an API.
+ *	\param[in] 	ApiName: 	Name of the API, NULL_PTR for the accesses outside of any API.
+ *	\param[out] CountsPtr: 	Pointer to the accesses of all calls of the API.
+ *	\return		uint32: 	Number of calls of the API.
+ */
+uint32 HW_AccountingGetApi(const char* ApiName, HW_AccountingCountsType* CountsPtr)
+{
+	/* Needed Variables */
+	uint32 HW_Calls = 0;
+	uint16 HW_Index;
+	
+	CountsPtr->HW_Reads = 0;
+	CountsPtr->HW_Writes = 0;
+	CountsPtr->HW_Modifies = 0;
+	for(HW_Index = 0; HW_Index < HW_AccountingNoOfApis; HW_Index++)
+	{
+		if(TRUE == HW_AccountingSameName(HW_AccountingApis[HW_Index], ApiName))
+		{
+			HW_Calls = HW_AccountingCalls[HW_Index];
+		}
+		else
+		{
+			/* Another API */
+		}
+	}
+	for(HW_Index = 0; HW_Index < HW_AccountingNoOfEntries; HW_Index++)
+	{
+		if(TRUE == HW_AccountingSameName(HW_AccountingEntries[HW_Index].HW_Api, ApiName))
+		{
+			CountsPtr->HW_Reads += HW_AccountingEntries[HW_Index].HW_Counts.HW_Reads;
+			CountsPtr->HW_Writes += HW_AccountingEntries[HW_Index].HW_Counts.HW_Writes;
+			CountsPtr->HW_Modifies += HW_AccountingEntries[HW_Index].HW_Counts.HW_Modifies;
+		}
+		else
+		{
+			/* Another API */
+		}
+	}
+	
+	return HW_Calls;
+}
+
+/**
+ *	\brief		Returns the counted (API, register) pairs.
+ *	\param[out] NoOfEntriesPtr: 	Pointer to the number of pairs.
+ *	\param[out] DroppedPtr: 		Pointer to the number of accesses not counted because the
+ *									tables are full, NULL_PTR if not needed.
+ *	\return		const HW_AccountingEntryType*:	Pointer to the pairs, in order of first access.
+ */
+const HW_AccountingEntryType* HW_AccountingGetEntries(uint16* NoOfEntriesPtr, uint32* DroppedPtr)
+{
+	*NoOfEntriesPtr = HW_AccountingNoOfEntries;
+	if(NULL_PTR != DroppedPtr)
+	{
+		*DroppedPtr = HW_AccountingDropped;
+	}
+	else
+	{
+		/* Dropped count not needed */
+	}
+	
+	return HW_AccountingEntries;
+}
+#endif /* HW_ACCESS_ACCOUNTING check */
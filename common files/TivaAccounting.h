@@ -0,0 +1,155 @@
+/**
+ *  \file	TivaAccounting.h
+ *  \brief 	Registers access accounting, compiled in when HW_ACCESS_ACCOUNTING is 1 (TivaHW.h).
+ *  		Every HW_W_8RIG / HW_R_8RIG / HW_S_BIT / HW_C_BIT access is counted per register
+ *  		and per calling API:
+ *  		-	A read followed by a write of the same register is a read-modify-write,
+ *  			as are HW_S_BIT / HW_C_BIT and the writes to a bit-band alias.
+ *  		-	The GPIODATA aliases of a port are counted as its GPIODATA register and a
+ *  			bit-band alias as its aliased register.
+ *  		-	The calling API is named by HW_AccountingBegin() / HW_AccountingEnd() around
+ *  			the call, or by HW_ACCOUNTING_CALL(). Accesses outside of them are counted
+ *  			under no API (NULL_PTR).
+ *  		A read-modify-write is a read and a write on the bus, HW_ACCOUNTING_TRANSACTIONS()
+ *  		gives the bus transactions of the counts.
+ *  		The drivers also record measurements (e.g. cycle counts) with HW_ACCOUNTING_SAMPLE(),
+ *  		kept per sample name as count, last, minimum and maximum.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef TIVA_ACCOUNTING_H_
+#define TIVA_ACCOUNTING_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+
+#if(HW_ACCESS_ACCOUNTING == 1)
+/* Macros */
+#define HW_ACCOUNTING_APIS		32		/*!< Number of APIs counted */
+#define HW_ACCOUNTING_ENTRIES	128		/*!< Number of (API, register) pairs counted */
+#define HW_ACCOUNTING_SAMPLES	8		/*!< Number of sample names recorded */
+
+/* Counts the accesses of a call to API with the arguments list ARGS, e.g.
+   HW_ACCOUNTING_CALL(Dio_WriteChannel, (DIO_CHANNEL_F1, STD_HIGH)); */
+#define HW_ACCOUNTING_CALL(API, ARGS)	\
+	do{	\
+		HW_AccountingBegin(#API);	\
+		(void)API ARGS;	\
+		HW_AccountingEnd();	\
+	}while(0)
+
+/* Bus transactions of an HW_AccountingCountsType, a read-modify-write is a read and a write */
+#define HW_ACCOUNTING_TRANSACTIONS(COUNTS)	\
+	((COUNTS).HW_Reads + (COUNTS).HW_Writes + (2 * (COUNTS).HW_Modifies))
+
+/* Defined data types */
+typedef struct{
+	uint32	HW_Reads;		/*!< Reads */
+	uint32	HW_Writes;		/*!< Writes */
+	uint32	HW_Modifies;	/*!< Read-modify-writes */
+}HW_AccountingCountsType;	/*!< Accesses counts */
+
+typedef struct{
+	const char*				HW_Api;			/*!< Calling API, NULL_PTR outside of any API */
+	HW_AddressBusSizeType	HW_Register;	/*!< Accessed register */
+	HW_AccountingCountsType	HW_Counts;		/*!< Accesses of the API to the register */
+}HW_AccountingEntryType;	/*!< Accesses of an API to a register */
+
+typedef struct{
+	uint32	HW_Count;	/*!< Samples recorded */
+	uint32	HW_Last;	/*!< Last sample */
+	uint32	HW_Min;		/*!< Smallest sample */
+	uint32	HW_Max;		/*!< Largest sample */
+}HW_AccountingSampleType;	/*!< Samples of a measurement */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Clears all the counts and the APIs.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_AccountingReset(void);
+
+/**
+ *	\brief		Suspends or resumes the counting, e.g. while timing the services.
+ *	\param[in] 	Suspend: 	TRUE: the following accesses aren't counted, FALSE: they are.
+ *	\return		None.
+ */
+void HW_AccountingSuspend(boolean Suspend);
+
+/**
+ *	\brief		Counts the following accesses under an API and counts a call of it.
+ *	\param[in] 	ApiName: 	Name of the API, it has to stay valid until the reset.
+ *	\return		None.
+ */
+void HW_AccountingBegin(const char* ApiName);
+
+/**
+ *	\brief		Counts the following accesses under no API.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_AccountingEnd(void);
+
+/**
+ *	\brief		Counts a read, called by HW_R_8RIG.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		None.
+ */
+void HW_AccountingRead(uint32 Address);
+
+/**
+ *	\brief		Counts a write, a read-modify-write if the last access read the same register.
+ *				Called by HW_W_8RIG.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		None.
+ */
+void HW_AccountingWrite(uint32 Address);
+
+/**
+ *	\brief		Counts a read-modify-write, called by HW_S_BIT / HW_C_BIT.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		None.
+ */
+void HW_AccountingModify(uint32 Address);
+
+/**
+ *	\brief		Records a measurement sample, called by HW_ACCOUNTING_SAMPLE.
+ *				Samples are recorded even while the counting is suspended.
+ *	\param[in] 	SampleName: 	Name of the measurement, it has to stay valid until the reset.
+ *	\param[in] 	Value: 			Measured value.
+ *	\return		None.
+ */
+void HW_AccountingSample(const char* SampleName, uint32 Value);
+
+/**
+ *	\brief		Returns the samples of a measurement.
+ *	\param[in] 	SampleName: 	Name of the measurement.
+ *	\param[out] SamplePtr: 		Pointer to the samples, all 0 if none was recorded.
+ *	\return		uint32: 		Number of samples.
+ */
+uint32 HW_AccountingGetSample(const char* SampleName, HW_AccountingSampleType* SamplePtr);
+
+/**
+ *	\brief		Returns the accesses of an API.
+ *	\param[in] 	ApiName: 	Name of the API, NULL_PTR for the accesses outside of any API.
+ *	\param[out] CountsPtr: 	Pointer to the accesses of all calls of the API.
+ *	\return		uint32: 	Number of calls of the API.
+ */
+uint32 HW_AccountingGetApi(const char* ApiName, HW_AccountingCountsType* CountsPtr);
+
+/**
+ *	\brief		Returns the counted (API, register) pairs.
+ *	\param[out] NoOfEntriesPtr: 	Pointer to the number of pairs.
+ *	\param[out] DroppedPtr: 		Pointer to the number of accesses not counted because the
+ *									tables are full, NULL_PTR if not needed.
+ *	\return		const HW_AccountingEntryType*:	Pointer to the pairs, in order of first access.
+ */
+const HW_AccountingEntryType* HW_AccountingGetEntries(uint16* NoOfEntriesPtr, uint32* DroppedPtr);
+#endif /* HW_ACCESS_ACCOUNTING check */
+
+#endif /* TIVA_ACCOUNTING_H_ */
@@ -9,10 +9,10 @@
 #include "TivaHW.h"
 
 HW_AddressBusSizeType HW_PortsAddresses[HW_NO_OF_PORTS] = {
-	0x40004000,	/*!< Base address for PORT A */
-	0x40005000,	/*!< Base address for PORT B */
-	0x40006000,	/*!< Base address for PORT C */
-	0x40007000,	/*!< Base address for PORT D */
-	0x40024000,	/*!< Base address for PORT E */
-	0x40025000	/*!< Base address for PORT F */
+	HW_GPIOPORTA_BASE,	/*!< Base address for PORT A */
+	HW_GPIOPORTB_BASE,	/*!< Base address for PORT B */
+	HW_GPIOPORTC_BASE,	/*!< Base address for PORT C */
+	HW_GPIOPORTD_BASE,	/*!< Base address for PORT D */
+	HW_GPIOPORTE_BASE,	/*!< Base address for PORT E */
+	HW_GPIOPORTF_BASE	/*!< Base address for PORT F */
 };	/*!< Contains the base addresses for all GPIO PORTs */
\ No newline at end of file
@@ -14,9 +14,57 @@
 /* Definitions */
 #define HW_NO_OF_PORTS	6	/*!< Number of GPIO Ports for the uc */
 
+/* Registers access backend */
+#define HW_BACKEND_TARGET	0	/*!< Volatile accesses to the registers addresses */
+#define HW_BACKEND_HOST		1	/*!< Accesses served by the host register model (TivaRegsModel.c) */
+#ifndef HW_REGS_BACKEND
+#if defined(__arm__)
+#define HW_REGS_BACKEND		HW_BACKEND_TARGET	/*!< Backend of HW_W_8RIG / HW_R_8RIG / HW_S_BIT / HW_C_BIT,
+													 can be given on the compiler command line */
+#else
+#define HW_REGS_BACKEND		HW_BACKEND_HOST
+#endif
+#endif
+
+/* Registers access accounting (TivaAccounting.c), 0 in production builds: the accesses aren't counted */
+#ifndef HW_ACCESS_ACCOUNTING
+#define HW_ACCESS_ACCOUNTING	0
+#endif
+
 /* GPIO */
+/* Bus aperture of the ports */
+#ifndef HW_GPIO_AHB_PORTS
+#define HW_GPIO_AHB_PORTS	0x00	/*!< Ports accessed through the AHB aperture, bit per port (bit 0 is PORT A).
+										 PORT enables them in GPIOHBCTL, DIO and PORT use their AHB base addresses.
+										 A build setting, not a PORT configuration set member: the DIO channels
+										 table holds the data addresses as constants */
+#endif
+/* Ports Base Addresses (APB) */
+#define HW_GPIOPORTA_APB_BASE	0x40004000	/*!< APB base address for PORT A */
+#define HW_GPIOPORTB_APB_BASE	0x40005000	/*!< APB base address for PORT B */
+#define HW_GPIOPORTC_APB_BASE	0x40006000	/*!< APB base address for PORT C */
+#define HW_GPIOPORTD_APB_BASE	0x40007000	/*!< APB base address for PORT D */
+#define HW_GPIOPORTE_APB_BASE	0x40024000	/*!< APB base address for PORT E */
+#define HW_GPIOPORTF_APB_BASE	0x40025000	/*!< APB base address for PORT F */
+/* Ports Base Addresses (AHB) */
+#define HW_GPIOPORTA_AHB_BASE	0x40058000	/*!< AHB base address for PORT A */
+#define HW_GPIOPORTB_AHB_BASE	0x40059000	/*!< AHB base address for PORT B */
+#define HW_GPIOPORTC_AHB_BASE	0x4005A000	/*!< AHB base address for PORT C */
+#define HW_GPIOPORTD_AHB_BASE	0x4005B000	/*!< AHB base address for PORT D */
+#define HW_GPIOPORTE_AHB_BASE	0x4005C000	/*!< AHB base address for PORT E */
+#define HW_GPIOPORTF_AHB_BASE	0x4005D000	/*!< AHB base address for PORT F */
+/* Ports Base Addresses used by the drivers, selected by HW_GPIO_AHB_PORTS */
+#define HW_GPIO_PORT_BASE(PORT,APB,AHB)	((0 != (HW_GPIO_AHB_PORTS & (1 << (PORT)))) ? (AHB) : (APB))
+#define HW_GPIOPORTA_BASE	HW_GPIO_PORT_BASE(0, HW_GPIOPORTA_APB_BASE, HW_GPIOPORTA_AHB_BASE)	/*!< Base address for PORT A */
+#define HW_GPIOPORTB_BASE	HW_GPIO_PORT_BASE(1, HW_GPIOPORTB_APB_BASE, HW_GPIOPORTB_AHB_BASE)	/*!< Base address for PORT B */
+#define HW_GPIOPORTC_BASE	HW_GPIO_PORT_BASE(2, HW_GPIOPORTC_APB_BASE, HW_GPIOPORTC_AHB_BASE)	/*!< Base address for PORT C */
+#define HW_GPIOPORTD_BASE	HW_GPIO_PORT_BASE(3, HW_GPIOPORTD_APB_BASE, HW_GPIOPORTD_AHB_BASE)	/*!< Base address for PORT D */
+#define HW_GPIOPORTE_BASE	HW_GPIO_PORT_BASE(4, HW_GPIOPORTE_APB_BASE, HW_GPIOPORTE_AHB_BASE)	/*!< Base address for PORT E */
+#define HW_GPIOPORTF_BASE	HW_GPIO_PORT_BASE(5, HW_GPIOPORTF_APB_BASE, HW_GPIOPORTF_AHB_BASE)	/*!< Base address for PORT F */
 /* Unlock Pattern */
 #define HW_GPIO_UNLOCK_PATTERN	0x4C4F434B 
+/* Lock Pattern, any value other than the unlock pattern */
+#define HW_GPIO_LOCK_PATTERN	0x00000000
 /* Registers Offsets */
 #define HW_GPIODATA_OFFSET			0x000
 #define HW_GPIODIR_OFFSET			0x400
@@ -39,9 +87,9 @@
 #define HW_GPIOLOCK_OFFSET			0x520
 #define HW_GPIOCR_OFFSET			0x524
 #define HW_GPIOAMSEL_OFFSET			0x528
-#define HW_GPIOCTL_OFFSET			0x52C
+#define HW_GPIOPCTL_OFFSET			0x52C
 #define HW_GPIOADCCTL_OFFSET		0x530
-#define HW_GPIODMACTL_OFFSET		0xFF0
+#define HW_GPIODMACTL_OFFSET		0x534
 #define HW_GPIOPeriphID4_OFFSET		0x5D0
 #define HW_GPIOPeriphID5_OFFSET		0x5D4
 #define HW_GPIOPeriphID6_OFFSET		0x5D8
@@ -61,12 +109,150 @@
 /* Offsets*/
 #define HW_RCGCGPIO_OFFSET	 0x608
 #define HW_RCGC2_OFFSET 0x108
+#define HW_PRGPIO_OFFSET	0xA08	/*!< GPIO peripheral ready */
+#define HW_GPIOHBCTL_OFFSET	0x06C	/*!< GPIO high-performance bus control, bit per port selects AHB */
+#define HW_RCGCDMA_OFFSET	0x60C	/*!< uDMA run mode clock gating */
+#define HW_PRDMA_OFFSET		0xA0C	/*!< uDMA peripheral ready */
+
+/* uDMA */
+/* Base Address */
+#define HW_UDMA_BA	0x400FF000
+/* Registers Offsets */
+#define HW_DMASTAT_OFFSET			0x000
+#define HW_DMACFG_OFFSET			0x004	/*!< Bit 0 (MASTEN) enables the controller */
+#define HW_DMACTLBASE_OFFSET		0x008	/*!< Channel control table base, 1024 bytes aligned */
+#define HW_DMAALTBASE_OFFSET		0x00C
+#define HW_DMAWAITSTAT_OFFSET		0x010
+#define HW_DMASWREQ_OFFSET			0x014
+#define HW_DMAUSEBURSTSET_OFFSET	0x018
+#define HW_DMAUSEBURSTCLR_OFFSET	0x01C
+#define HW_DMAREQMASKSET_OFFSET		0x020
+#define HW_DMAREQMASKCLR_OFFSET		0x024
+#define HW_DMAENASET_OFFSET			0x028
+#define HW_DMAENACLR_OFFSET			0x02C
+#define HW_DMAALTSET_OFFSET			0x030
+#define HW_DMAALTCLR_OFFSET			0x034
+#define HW_DMAPRIOSET_OFFSET		0x038
+#define HW_DMAPRIOCLR_OFFSET		0x03C
+#define HW_DMAERRCLR_OFFSET			0x04C
+#define HW_DMACHASGN_OFFSET			0x500
+#define HW_DMACHIS_OFFSET			0x504	/*!< Channel completion status, write 1 to clear */
+#define HW_DMACHMAP0_OFFSET			0x510	/*!< Encoding of channels 0 to 7, 4 bits each, CHMAP1 to CHMAP3 follow */
+/* Channel control table */
+#define HW_UDMA_NO_OF_CHANNELS		32
+#define HW_UDMA_TABLE_WORDS			256		/*!< Primary then alternate structures of all channels, 4 words each */
+#define HW_UDMA_ALT_WORDS			128		/*!< Offset of the alternate structures in words */
+#define HW_UDMA_SRCENDP				0		/*!< Word of a structure holding the source end pointer */
+#define HW_UDMA_DSTENDP				1		/*!< Word of a structure holding the destination end pointer */
+#define HW_UDMA_CHCTL				2		/*!< Word of a structure holding the control word */
+/* Control word fields */
+#define HW_UDMA_DSTINC_NONE			0xC0000000
+#define HW_UDMA_DSTSIZE_8			0x00000000
+#define HW_UDMA_SRCINC_8			0x00000000
+#define HW_UDMA_SRCINC_NONE			0x0C000000
+#define HW_UDMA_SRCSIZE_8			0x00000000
+#define HW_UDMA_ARBSIZE_1			0x00000000
+#define HW_UDMA_XFERSIZE_SHIFT		4		/*!< Items minus one, 10 bits */
+#define HW_UDMA_XFERSIZE_MAX		1024
+#define HW_UDMA_XFERMODE_MASK		0x00000007
+#define HW_UDMA_XFERMODE_STOP		0x00000000
+#define HW_UDMA_XFERMODE_BASIC		0x00000001
+#define HW_UDMA_XFERMODE_PINGPONG	0x00000003
+
+/* Peripherals bit-band region */
+#define HW_PERIPH_BA			0x40000000	/*!< Start of the peripherals bit-band region (1 MB) */
+#define HW_PERIPH_BITBAND_BA	0x42000000	/*!< Start of the peripherals bit-band alias region */
+/* Core debug registers */
+#define HW_DEMCR_ADDRESS		0xE000EDFC	/*!< Debug exception and monitor control, bit 24 (TRCENA) enables the DWT */
+#define HW_DWT_CTRL_ADDRESS		0xE0001000	/*!< DWT control, bit 0 (CYCCNTENA) enables the cycle counter */
+#define HW_DWT_CYCCNT_ADDRESS	0xE0001004	/*!< DWT cycle counter */
+/* NVIC registers */
+#define HW_NVIC_EN0_ADDRESS		0xE000E100	/*!< Interrupt set enable of IRQs 0 to 31, writing 0 has no effect */
+#define HW_NVIC_DIS0_ADDRESS	0xE000E180	/*!< Interrupt clear enable of IRQs 0 to 31, writing 0 has no effect */
+/* GPIO ports interrupt numbers */
+#define HW_GPIOA_IRQ	0
+#define HW_GPIOB_IRQ	1
+#define HW_GPIOC_IRQ	2
+#define HW_GPIOD_IRQ	3
+#define HW_GPIOE_IRQ	4
+#define HW_GPIOF_IRQ	30
 /* Macro functions */
 
-#define HW_W_8RIG(ADDRESS,DATA)	*((volatile uint32 *)(ADDRESS)) = DATA	/*!< Write Data to 8-bits Register */
-#define HW_R_8RIG(ADDRESS)			(*((volatile uint32 *)(ADDRESS))) 	/*!< Read Data from 8-bits Register */
-#define HW_S_BIT(ADDRESS,BIT)		*((volatile uint32 *)(ADDRESS)) |= (1<<BIT)		/*!< Set specific bit in a register */
-#define HW_C_BIT(ADDRESS,BIT)		*((volatile uint32 *)(ADDRESS)) &=~ (1<<BIT)	/*!< Clear specific bit in a register */
+/* Bus accesses of the selected backend */
+#if(HW_REGS_BACKEND == HW_BACKEND_TARGET)
+#define HW_BUS_W(ADDRESS,DATA)		*((volatile uint32 *)(ADDRESS)) = DATA
+#define HW_BUS_R(ADDRESS)			(*((volatile uint32 *)(ADDRESS)))
+#define HW_BUS_S(ADDRESS,BIT)		*((volatile uint32 *)(ADDRESS)) |= (1<<BIT)
+#define HW_BUS_C(ADDRESS,BIT)		*((volatile uint32 *)(ADDRESS)) &=~ (1<<BIT)
+#else
+/* Accesses served by the host register model (TivaRegsModel.c) */
+uint32 HW_RegsModelRead(uint32 Address);
+void HW_RegsModelWrite(uint32 Address, uint32 Value);
+void HW_RegsModelModify(uint32 Address, uint32 ClearMask, uint32 SetMask);
+#define HW_BUS_W(ADDRESS,DATA)		HW_RegsModelWrite((uint32)(ADDRESS), (uint32)(DATA))
+#define HW_BUS_R(ADDRESS)			HW_RegsModelRead((uint32)(ADDRESS))
+#define HW_BUS_S(ADDRESS,BIT)		HW_RegsModelModify((uint32)(ADDRESS), 0, ((uint32)1 << (BIT)))
+#define HW_BUS_C(ADDRESS,BIT)		HW_RegsModelModify((uint32)(ADDRESS), ((uint32)1 << (BIT)), 0)
+#endif
+
+#if(HW_ACCESS_ACCOUNTING == 0)
+#define HW_ACCOUNTING_SAMPLE(NAME,VALUE)	((void)0)	/*!< Measurement samples aren't recorded */
+#define HW_W_8RIG(ADDRESS,DATA)	HW_BUS_W(ADDRESS,DATA)	/*!< Write Data to 8-bits Register */
+#define HW_R_8RIG(ADDRESS)			HW_BUS_R(ADDRESS) 		/*!< Read Data from 8-bits Register */
+#define HW_S_BIT(ADDRESS,BIT)		HW_BUS_S(ADDRESS,BIT)	/*!< Set specific bit in a register */
+#define HW_C_BIT(ADDRESS,BIT)		HW_BUS_C(ADDRESS,BIT)	/*!< Clear specific bit in a register */
+#else
+/* Every access is counted by TivaAccounting.c, a write after its data is read so a
+   read-modify-write is seen as a read then a write of the same register */
+void HW_AccountingRead(uint32 Address);
+void HW_AccountingWrite(uint32 Address);
+void HW_AccountingModify(uint32 Address);
+void HW_AccountingSample(const char* SampleName, uint32 Value);
+#define HW_ACCOUNTING_SAMPLE(NAME,VALUE)	HW_AccountingSample((NAME), (uint32)(VALUE))	/*!< Records a measurement sample */
+#define HW_W_8RIG(ADDRESS,DATA)	(HW_BUS_W(ADDRESS,DATA), HW_AccountingWrite((uint32)(ADDRESS)))	/*!< Write Data to 8-bits Register */
+#define HW_R_8RIG(ADDRESS)			(HW_AccountingRead((uint32)(ADDRESS)), HW_BUS_R(ADDRESS))		/*!< Read Data from 8-bits Register */
+#define HW_S_BIT(ADDRESS,BIT)		(HW_BUS_S(ADDRESS,BIT), HW_AccountingModify((uint32)(ADDRESS)))	/*!< Set specific bit in a register */
+#define HW_C_BIT(ADDRESS,BIT)		(HW_BUS_C(ADDRESS,BIT), HW_AccountingModify((uint32)(ADDRESS)))	/*!< Clear specific bit in a register */
+#endif
+/*!< Bit-band alias word of a bit of a peripheral register, a word access to it reads or writes the bit alone */
+#define HW_BITBAND_ALIAS(ADDRESS,BIT)	(HW_PERIPH_BITBAND_BA + (((ADDRESS) - HW_PERIPH_BA) << 5) + ((BIT) << 2))
+/*!< Count leading zeros of a non zero word, a single CLZ instruction on Cortex-M4 */
+#define HW_CLZ(VALUE)	((uint8)__builtin_clz((uint32)(VALUE)))
+/*!< Aligns a variable to a power of two number of bytes */
+#define HW_ALIGNED(BYTES)	__attribute__((aligned(BYTES)))
+
+/* Critical sections: PRIMASK is saved to STATE then interrupts are disabled,
+   exiting restores the saved PRIMASK so critical sections can be nested */
+#if defined(__arm__)
+#define HW_ENTER_CRITICAL(STATE)	__asm volatile("mrs %0, primask\n\tcpsid i" : "=r"(STATE) : : "memory")
+#define HW_EXIT_CRITICAL(STATE)		__asm volatile("msr primask, %0" : : "r"(STATE) : "memory")
+#elif(HW_REGS_BACKEND == HW_BACKEND_HOST)
+/* Interrupts mask of the host register model (TivaRegsModel.c): the critical sections of
+   the threads standing for the task and the interrupts exclude each other */
+uint32 HW_RegsModelEnterCritical(void);
+void HW_RegsModelExitCritical(uint32 State);
+#define HW_ENTER_CRITICAL(STATE)	((STATE) = HW_RegsModelEnterCritical())
+#define HW_EXIT_CRITICAL(STATE)		HW_RegsModelExitCritical(STATE)
+#else
+#define HW_ENTER_CRITICAL(STATE)	((STATE) = 0)	/*!< No interrupts to lock off target */
+#define HW_EXIT_CRITICAL(STATE)		((void)(STATE))
+#endif
+
+/* Memory barrier, orders the memory accesses before it against the ones after it */
+#if defined(__arm__)
+#define HW_MEMORY_BARRIER()			__asm volatile("dmb" : : : "memory")
+#else
+#define HW_MEMORY_BARRIER()			__sync_synchronize()
+#endif
+
+/* Cycle counter, counts core clock cycles once it is enabled */
+#if defined(__arm__)
+#define HW_CYCLE_COUNTER_ENABLE()	do{ HW_S_BIT(HW_DEMCR_ADDRESS, 24); HW_S_BIT(HW_DWT_CTRL_ADDRESS, 0); }while(0)
+#define HW_CYCLE_COUNT()			((uint32)HW_R_8RIG(HW_DWT_CYCCNT_ADDRESS))
+#else
+#define HW_CYCLE_COUNTER_ENABLE()	do{ }while(0)	/*!< No cycle counter off target */
+#define HW_CYCLE_COUNT()			((uint32)0)
+#endif
 
 /* Defined data types */
 typedef uint32 HW_AddressBusSizeType;	/*!< The size of address bus */
@@ -0,0 +1,719 @@
+/**
+ *  \file	TivaRegsModel.c
+ *  \brief 	Host register model of the Tiva C.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "TivaRegsModel.h"
+#include "TivaUdmaModel.h"	/* Serves the uDMA registers */
+
+#if !defined(__arm__)
+#include <sched.h>			/* Lets the thread holding the interrupts lock run */
+
+/* Macros */
+/* Register files */
+#define HW_REGS_MODEL_PORT_WORDS	((0x1000 - HW_GPIODIR_OFFSET) >> 2)	/*!< Port registers after the GPIODATA aliases */
+#define HW_REGS_MODEL_BLOCK_WORDS	(0x1000 >> 2)							/*!< System control block registers */
+#define HW_REGS_MODEL_OTHERS		32										/*!< Other registers (core) held by the model */
+
+/* Word of a port register file from the register offset */
+#define HW_REGS_MODEL_PORT_REG(PORT_PTR, OFFSET)	((PORT_PTR)->HW_Regs[((OFFSET) - HW_GPIODIR_OFFSET) >> 2])
+
+/* Legacy clock gating in RCGC2 */
+#define HW_REGS_MODEL_RCGC2_GPIO		0x0000003F	/*!< Ports A to F */
+#define HW_REGS_MODEL_RCGC2_UDMA		0x00002000	/*!< uDMA */
+
+/* Peripheral ready registers mirror the run mode clock gating registers */
+#define HW_REGS_MODEL_PR_FIRST			0xA00
+#define HW_REGS_MODEL_PR_LAST			0xA7C
+#define HW_REGS_MODEL_PR_TO_RCGC		0x400
+
+/* Pins whose GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN bits are protected by GPIOCR */
+#define HW_REGS_MODEL_PROTECTED_PC		0x0F	/*!< JTAG / SWD */
+#define HW_REGS_MODEL_PROTECTED_PD		0x80	/*!< NMI */
+#define HW_REGS_MODEL_PROTECTED_PF		0x01	/*!< NMI */
+
+/* Bit-band alias of the peripherals region */
+#define HW_REGS_MODEL_BITBAND_SIZE		0x02000000
+
+/* Result of a port search for a faulty access */
+#define HW_REGS_MODEL_PORT_FAULT		0xFF
+
+/* Defined data types */
+typedef struct{
+	uint32	HW_Regs[HW_REGS_MODEL_PORT_WORDS];	/*!< Registers from GPIODIR */
+	uint8	HW_Data;		/*!< Output data latch written through GPIODATA */
+	uint8	HW_Pins;		/*!< Levels of the pins */
+	uint8	HW_Drive;		/*!< Pins driven from outside */
+	uint8	HW_DriveLevels;	/*!< Levels of the pins driven from outside */
+	uint8	HW_Protected;	/*!< Pins protected by GPIOCR */
+	boolean	HW_Unlocked;	/*!< GPIOCR can be written */
+}HW_RegsModelPortType;	/*!< Register file of a port */
+
+typedef struct{
+	HW_AddressBusSizeType	HW_Address;	/*!< Address of the register, 0 if the entry is free */
+	uint32					HW_Value;	/*!< Value of the register */
+}HW_RegsModelOtherType;	/*!< Register outside of the modelled blocks */
+
+/* Private Variables */
+static HW_RegsModelPortType HW_RegsModelPorts[HW_NO_OF_PORTS];			/*!< Register files of the ports */
+static uint32 HW_RegsModelSysCtl[HW_REGS_MODEL_BLOCK_WORDS];			/*!< System control block */
+static HW_RegsModelOtherType HW_RegsModelOthers[HW_REGS_MODEL_OTHERS];	/*!< Other registers */
+static uint32 HW_RegsModelFaults;										/*!< Faulty accesses since the reset */
+static HW_AddressBusSizeType HW_RegsModelFaultAddress;					/*!< Address of the last fault */
+static uint8 HW_RegsModelHeldPorts;										/*!< GPIO ports kept not ready */
+static HW_RegsModelPinsHookType HW_RegsModelPinsHook = NULL_PTR;		/*!< Called after every GPIODATA access */
+static volatile uint8 HW_RegsModelIntLock = 0;							/*!< Set while a thread has the interrupts locked */
+static __thread uint8 HW_RegsModelIntMasked = 0;						/*!< Interrupts mask of the calling thread */
+
+static const HW_AddressBusSizeType HW_RegsModelApbBases[HW_NO_OF_PORTS] = {
+	HW_GPIOPORTA_APB_BASE,
+	HW_GPIOPORTB_APB_BASE,
+	HW_GPIOPORTC_APB_BASE,
+	HW_GPIOPORTD_APB_BASE,
+	HW_GPIOPORTE_APB_BASE,
+	HW_GPIOPORTF_APB_BASE
+};	/*!< APB base addresses of the ports */
+
+static const HW_AddressBusSizeType HW_RegsModelAhbBases[HW_NO_OF_PORTS] = {
+	HW_GPIOPORTA_AHB_BASE,
+	HW_GPIOPORTB_AHB_BASE,
+	HW_GPIOPORTC_AHB_BASE,
+	HW_GPIOPORTD_AHB_BASE,
+	HW_GPIOPORTE_AHB_BASE,
+	HW_GPIOPORTF_AHB_BASE
+};	/*!< AHB base addresses of the ports */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Counts a faulty access.
+ *	\param[in] 	Address: 	Address of the access.
+ *	\return		None.
+ */
+static void HW_RegsModelFault(HW_AddressBusSizeType Address);
+
+/**
+ *	\brief		Finds the port of an address and checks that it can be accessed.
+ *	\param[in] 	Address: 	Address of the access.
+ *	\param[out] OffsetPtr: 	Pointer to the offset of the register in the port.
+ *	\return		uint8: 		ID of the port, HW_NO_OF_PORTS if the address isn't in a port or
+ *							HW_REGS_MODEL_PORT_FAULT if the access is a fault.
+ */
+static uint8 HW_RegsModelFindPort(HW_AddressBusSizeType Address, HW_AddressBusSizeType* OffsetPtr);
+
+/**
+ *	\brief		Computes the levels of the pins of a port and latches the interrupts they raise.
+ *	\param[in] 	PortPtr: 	Pointer to the register file of the port.
+ *	\return		None.
+ */
+static void HW_RegsModelUpdatePins(HW_RegsModelPortType* PortPtr);
+
+/**
+ *	\brief		Reads a port register.
+ *	\param[in] 	PortPtr: 	Pointer to the register file of the port.
+ *	\param[in] 	Offset: 	Offset of the register.
+ *	\return		uint32: 	Value of the register.
+ */
+static uint32 HW_RegsModelReadPort(const HW_RegsModelPortType* PortPtr, HW_AddressBusSizeType Offset);
+
+/**
+ *	\brief		Writes a port register.
+ *	\param[in] 	PortPtr: 	Pointer to the register file of the port.
+ *	\param[in] 	Offset: 	Offset of the register.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+static void HW_RegsModelWritePort(HW_RegsModelPortType* PortPtr, HW_AddressBusSizeType Offset, uint32 Value);
+
+/**
+ *	\brief		Finds the entry of a register outside of the modelled blocks, a free entry
+ *				is taken for a new register.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		HW_RegsModelOtherType*:	Pointer to the entry, NULL_PTR if the table is full.
+ */
+static HW_RegsModelOtherType* HW_RegsModelFindOther(HW_AddressBusSizeType Address);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Counts a faulty access.
+ *	\param[in] 	Address: 	Address of the access.
+ *	\return		None.
+ */
+static void HW_RegsModelFault(HW_AddressBusSizeType Address)
+{
+	HW_RegsModelFaults++;
+	HW_RegsModelFaultAddress = Address;
+}
+
+/**
+ *	\brief		Finds the port of an address and checks that it can be accessed.
+ *	\param[in] 	Address: 	Address of the access.
+ *	\param[out] OffsetPtr: 	Pointer to the offset of the register in the port.
+ *	\return		uint8: 		ID of the port, HW_NO_OF_PORTS if the address isn't in a port or
+ *							HW_REGS_MODEL_PORT_FAULT if the access is a fault.
+ */
+static uint8 HW_RegsModelFindPort(HW_AddressBusSizeType Address, HW_AddressBusSizeType* OffsetPtr)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType HW_Base = Address & ~(HW_AddressBusSizeType)0xFFF;
+	uint32 HW_Clocks = (HW_RegsModelSysCtl[HW_RCGCGPIO_OFFSET >> 2] |
+						(HW_RegsModelSysCtl[HW_RCGC2_OFFSET >> 2] & HW_REGS_MODEL_RCGC2_GPIO)) &
+					   ~(uint32)HW_RegsModelHeldPorts;
+	uint32 HW_Ahb = HW_RegsModelSysCtl[HW_GPIOHBCTL_OFFSET >> 2];
+	uint8 HW_Port;
+	uint8 HW_Found = HW_NO_OF_PORTS;
+	
+	for(HW_Port = 0; (HW_Port < HW_NO_OF_PORTS) && (HW_NO_OF_PORTS == HW_Found); HW_Port++)
+	{
+		if(HW_Base == HW_RegsModelApbBases[HW_Port])
+		{
+			HW_Found = (0 == (HW_Ahb & (1 << HW_Port))) ? HW_Port : HW_REGS_MODEL_PORT_FAULT;
+		}
+		else if(HW_Base == HW_RegsModelAhbBases[HW_Port])
+		{
+			HW_Found = (0 != (HW_Ahb & (1 << HW_Port))) ? HW_Port : HW_REGS_MODEL_PORT_FAULT;
+		}
+		else
+		{
+			/* Another port */
+		}
+	}
+	
+	/* Wrong aperture or clock off */
+	if((HW_REGS_MODEL_PORT_FAULT == HW_Found) || ((HW_Found < HW_NO_OF_PORTS) && (0 == (HW_Clocks & (1 << HW_Found)))))
+	{
+		HW_RegsModelFault(Address);
+		HW_Found = HW_REGS_MODEL_PORT_FAULT;
+	}
+	else
+	{
+		*OffsetPtr = Address & 0xFFF;
+	}
+	
+	return HW_Found;
+}
+
+/**
+ *	\brief		Computes the levels of the pins of a port and latches the interrupts they raise.
+ *	\param[in] 	PortPtr: 	Pointer to the register file of the port.
+ *	\return		None.
+ */
+static void HW_RegsModelUpdatePins(HW_RegsModelPortType* PortPtr)
+{
+	/* Needed Variables */
+	uint8 HW_Dir = (uint8)HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIODIR_OFFSET);
+	uint8 HW_Odr = (uint8)HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOODR_OFFSET);
+	uint8 HW_Is = (uint8)HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOIS_OFFSET);
+	uint8 HW_Ibe = (uint8)HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOIBE_OFFSET);
+	uint8 HW_Iev = (uint8)HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOIEV_OFFSET);
+	uint8 HW_Outside;
+	uint8 HW_Pins;
+	uint8 HW_Changed;
+	
+	/* A released line is pulled up or reads low */
+	HW_Outside = (uint8)((PortPtr->HW_Drive & PortPtr->HW_DriveLevels) |
+						 (~PortPtr->HW_Drive & HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOPUR_OFFSET)));
+	
+	/* Push-pull outputs drive their latch, open-drain outputs can only pull low */
+	HW_Pins = (uint8)((HW_Dir & ~HW_Odr & PortPtr->HW_Data) | (HW_Dir & HW_Odr & PortPtr->HW_Data & HW_Outside) |
+					  (~HW_Dir & HW_Outside));
+	HW_Changed = (uint8)(HW_Pins ^ PortPtr->HW_Pins);
+	
+	/* Edges are latched on edge sensitive pins, level sensitive pins follow their level */
+	HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIORIS_OFFSET) =
+		(uint8)((HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIORIS_OFFSET) & ~HW_Is) | (HW_Is & ~(HW_Pins ^ HW_Iev)) |
+				(~HW_Is & HW_Changed & (HW_Ibe | ~(HW_Pins ^ HW_Iev))));
+	PortPtr->HW_Pins = HW_Pins;
+}
+
+/**
+ *	\brief		Reads a port register.
+ *	\param[in] 	PortPtr: 	Pointer to the register file of the port.
+ *	\param[in] 	Offset: 	Offset of the register.
+ *	\return		uint32: 	Value of the register.
+ */
+static uint32 HW_RegsModelReadPort(const HW_RegsModelPortType* PortPtr, HW_AddressBusSizeType Offset)
+{
+	/* Needed Variables */
+	uint32 HW_Value;
+	
+	if(Offset < HW_GPIODIR_OFFSET)
+	{
+		/* Address bits 9:2 mask the pins read, pins without digital function read 0 */
+		HW_Value = PortPtr->HW_Pins & HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIODEN_OFFSET) & (Offset >> 2);
+	}
+	else if(HW_GPIOMIS_OFFSET == Offset)
+	{
+		HW_Value = HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIORIS_OFFSET) & HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOIM_OFFSET);
+	}
+	else if(HW_GPIOLOCK_OFFSET == Offset)
+	{
+		HW_Value = (TRUE == PortPtr->HW_Unlocked) ? 0 : 1;
+	}
+	else
+	{
+		HW_Value = HW_REGS_MODEL_PORT_REG(PortPtr, Offset);
+	}
+	
+	return HW_Value;
+}
+
+/**
+ *	\brief		Writes a port register.
+ *	\param[in] 	PortPtr: 	Pointer to the register file of the port.
+ *	\param[in] 	Offset: 	Offset of the register.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+static void HW_RegsModelWritePort(HW_RegsModelPortType* PortPtr, HW_AddressBusSizeType Offset, uint32 Value)
+{
+	/* Needed Variables */
+	uint32 HW_Commit = HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOCR_OFFSET);
+	
+	switch(Offset)
+	{
+		case HW_GPIORIS_OFFSET:
+		case HW_GPIOMIS_OFFSET:
+			/* Read only */
+			break;
+		case HW_GPIOICR_OFFSET:
+			HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIORIS_OFFSET) &= ~Value;
+			break;
+		case HW_GPIOLOCK_OFFSET:
+			PortPtr->HW_Unlocked = (HW_GPIO_UNLOCK_PATTERN == Value) ? TRUE : FALSE;
+			break;
+		case HW_GPIOCR_OFFSET:
+			/* Only the protected pins have writable bits, and only while the port is unlocked */
+			if(TRUE == PortPtr->HW_Unlocked)
+			{
+				HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIOCR_OFFSET) = (HW_Commit & ~(uint32)PortPtr->HW_Protected) |
+																	(Value & PortPtr->HW_Protected);
+			}
+			else
+			{
+				/* Locked */
+			}
+			break;
+		case HW_GPIOAFSEL_OFFSET:
+		case HW_GPIODEN_OFFSET:
+			HW_REGS_MODEL_PORT_REG(PortPtr, Offset) = (HW_REGS_MODEL_PORT_REG(PortPtr, Offset) & ~HW_Commit) |
+													  (Value & HW_Commit & 0xFF);
+			break;
+		case HW_GPIOPUR_OFFSET:
+		case HW_GPIOPDR_OFFSET:
+			/* A pin has a pull-up or a pull-down, setting one clears the other */
+			Value = Value & HW_Commit & 0xFF;
+			HW_REGS_MODEL_PORT_REG(PortPtr, Offset) = (HW_REGS_MODEL_PORT_REG(PortPtr, Offset) & ~HW_Commit) | Value;
+			HW_REGS_MODEL_PORT_REG(PortPtr, (HW_GPIOPUR_OFFSET == Offset) ? HW_GPIOPDR_OFFSET : HW_GPIOPUR_OFFSET) &= ~Value;
+			break;
+		case HW_GPIODR2R_OFFSET:
+		case HW_GPIODR4R_OFFSET:
+		case HW_GPIODR8R_OFFSET:
+			/* A pin has a single drive strength, setting one clears the others */
+			HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIODR2R_OFFSET) &= ~Value;
+			HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIODR4R_OFFSET) &= ~Value;
+			HW_REGS_MODEL_PORT_REG(PortPtr, HW_GPIODR8R_OFFSET) &= ~Value;
+			HW_REGS_MODEL_PORT_REG(PortPtr, Offset) |= Value & 0xFF;
+			break;
+		default:
+			if(Offset < HW_GPIODIR_OFFSET)
+			{
+				/* Address bits 9:2 mask the pins written */
+				PortPtr->HW_Data = (uint8)((PortPtr->HW_Data & ~(Offset >> 2)) | (Value & (Offset >> 2)));
+			}
+			else
+			{
+				HW_REGS_MODEL_PORT_REG(PortPtr, Offset) = Value;
+			}
+			break;
+	}
+	HW_RegsModelUpdatePins(PortPtr);
+}
+
+/**
+ *	\brief		Finds the entry of a register outside of the modelled blocks, a free entry
+ *				is taken for a new register.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		HW_RegsModelOtherType*:	Pointer to the entry, NULL_PTR if the table is full.
+ */
+static HW_RegsModelOtherType* HW_RegsModelFindOther(HW_AddressBusSizeType Address)
+{
+	/* Needed Variables */
+	HW_RegsModelOtherType* HW_EntryPtr = NULL_PTR;
+	uint8 HW_Index;
+	
+	for(HW_Index = 0; (HW_Index < HW_REGS_MODEL_OTHERS) && (NULL_PTR == HW_EntryPtr); HW_Index++)
+	{
+		if((Address == HW_RegsModelOthers[HW_Index].HW_Address) || (0 == HW_RegsModelOthers[HW_Index].HW_Address))
+		{
+			HW_EntryPtr = &HW_RegsModelOthers[HW_Index];
+			HW_EntryPtr->HW_Address = Address;
+		}
+		else
+		{
+			/* Entry of another register */
+		}
+	}
+	
+	return HW_EntryPtr;
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Resets every register of the model (and of the uDMA model) to its reset value,
+ *				releases the pins driven from outside, clears the faults and the pins hook.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_RegsModelReset(void)
+{
+	/* Needed Variables */
+	HW_RegsModelPortType* HW_PortPtr;
+	uint16 HW_Index;
+	uint8 HW_Port;
+	
+	for(HW_Port = 0; HW_Port < HW_NO_OF_PORTS; HW_Port++)
+	{
+		HW_PortPtr = &HW_RegsModelPorts[HW_Port];
+		for(HW_Index = 0; HW_Index < HW_REGS_MODEL_PORT_WORDS; HW_Index++)
+		{
+			HW_PortPtr->HW_Regs[HW_Index] = 0;
+		}
+		HW_PortPtr->HW_Data = 0;
+		HW_PortPtr->HW_Pins = 0;
+		HW_PortPtr->HW_Drive = 0;
+		HW_PortPtr->HW_DriveLevels = 0;
+		HW_PortPtr->HW_Unlocked = FALSE;
+		HW_PortPtr->HW_Protected = (2 == HW_Port) ? HW_REGS_MODEL_PROTECTED_PC :
+								   (3 == HW_Port) ? HW_REGS_MODEL_PROTECTED_PD :
+								   (5 == HW_Port) ? HW_REGS_MODEL_PROTECTED_PF : 0x00;
+		HW_REGS_MODEL_PORT_REG(HW_PortPtr, HW_GPIODR2R_OFFSET) = 0xFF;
+		HW_REGS_MODEL_PORT_REG(HW_PortPtr, HW_GPIOCR_OFFSET) = (uint8)~HW_PortPtr->HW_Protected;
+	}
+	
+	/* PC0 to PC3 leave the reset as JTAG / SWD pins */
+	HW_PortPtr = &HW_RegsModelPorts[2];
+	HW_REGS_MODEL_PORT_REG(HW_PortPtr, HW_GPIOAFSEL_OFFSET) = HW_REGS_MODEL_PROTECTED_PC;
+	HW_REGS_MODEL_PORT_REG(HW_PortPtr, HW_GPIODEN_OFFSET) = HW_REGS_MODEL_PROTECTED_PC;
+	HW_REGS_MODEL_PORT_REG(HW_PortPtr, HW_GPIOPUR_OFFSET) = HW_REGS_MODEL_PROTECTED_PC;
+	HW_REGS_MODEL_PORT_REG(HW_PortPtr, HW_GPIOPCTL_OFFSET) = 0x00001111;
+	for(HW_Port = 0; HW_Port < HW_NO_OF_PORTS; HW_Port++)
+	{
+		HW_RegsModelUpdatePins(&HW_RegsModelPorts[HW_Port]);
+		HW_REGS_MODEL_PORT_REG(&HW_RegsModelPorts[HW_Port], HW_GPIORIS_OFFSET) = 0;
+	}
+	
+	for(HW_Index = 0; HW_Index < HW_REGS_MODEL_BLOCK_WORDS; HW_Index++)
+	{
+		HW_RegsModelSysCtl[HW_Index] = 0;
+	}
+	for(HW_Index = 0; HW_Index < HW_REGS_MODEL_OTHERS; HW_Index++)
+	{
+		HW_RegsModelOthers[HW_Index].HW_Address = 0;
+		HW_RegsModelOthers[HW_Index].HW_Value = 0;
+	}
+	HW_RegsModelFaults = 0;
+	HW_RegsModelFaultAddress = 0;
+	HW_RegsModelHeldPorts = 0;
+	HW_RegsModelPinsHook = NULL_PTR;
+	HW_UdmaModelReset();
+}
+
+/**
+ *	\brief		Reads a register.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		uint32: 	Value of the register, 0 on a fault.
+ */
+uint32 HW_RegsModelRead(HW_AddressBusSizeType Address)
+{
+	/* Needed Variables */
+	uint32 HW_Value = 0;
+	HW_AddressBusSizeType HW_Offset = 0;
+	HW_RegsModelOtherType* HW_EntryPtr;
+	uint8 HW_Port;
+	
+	if((Address >= HW_PERIPH_BITBAND_BA) && (Address < (HW_PERIPH_BITBAND_BA + HW_REGS_MODEL_BITBAND_SIZE)))
+	{
+		/* Word 4 * N of the alias is bit N % 32 of the peripherals word N / 32 */
+		HW_Offset = (Address - HW_PERIPH_BITBAND_BA) >> 2;
+		HW_Value = (HW_RegsModelRead(HW_PERIPH_BA + ((HW_Offset >> 5) << 2)) >> (HW_Offset & 0x1F)) & 0x01;
+	}
+	else if((Address & ~(HW_AddressBusSizeType)0xFFF) == HW_SYSTEM_CONTROL_BA)
+	{
+		HW_Offset = Address & 0xFFF;
+		if((HW_Offset >= HW_REGS_MODEL_PR_FIRST) && (HW_Offset <= HW_REGS_MODEL_PR_LAST))
+		{
+			/* The peripherals are ready as soon as their clock is on */
+			HW_Value = HW_RegsModelSysCtl[(HW_Offset - HW_REGS_MODEL_PR_TO_RCGC) >> 2];
+			HW_Value |= (HW_PRGPIO_OFFSET == HW_Offset) ?
+						(HW_RegsModelSysCtl[HW_RCGC2_OFFSET >> 2] & HW_REGS_MODEL_RCGC2_GPIO) : 0;
+			HW_Value &= (HW_PRGPIO_OFFSET == HW_Offset) ? ~(uint32)HW_RegsModelHeldPorts : ~(uint32)0;
+			HW_Value |= ((HW_PRDMA_OFFSET == HW_Offset) && (0 != (HW_RegsModelSysCtl[HW_RCGC2_OFFSET >> 2] & HW_REGS_MODEL_RCGC2_UDMA))) ?
+						0x01 : 0;
+		}
+		else
+		{
+			HW_Value = HW_RegsModelSysCtl[HW_Offset >> 2];
+		}
+	}
+	else if((Address & ~(HW_AddressBusSizeType)0xFFF) == HW_UDMA_BA)
+	{
+		if(0 != (HW_RegsModelRead(HW_SYSTEM_CONTROL_BA + HW_PRDMA_OFFSET) & 0x01))
+		{
+			HW_Value = HW_UdmaModelRead(Address & 0xFFF);
+		}
+		else
+		{
+			HW_RegsModelFault(Address);
+		}
+	}
+	else
+	{
+		HW_Port = HW_RegsModelFindPort(Address, &HW_Offset);
+		if(HW_Port < HW_NO_OF_PORTS)
+		{
+			HW_Value = HW_RegsModelReadPort(&HW_RegsModelPorts[HW_Port], HW_Offset);
+			if((HW_Offset < HW_GPIODIR_OFFSET) && (NULL_PTR != HW_RegsModelPinsHook))
+			{
+				HW_RegsModelPinsHook(HW_Port, FALSE);
+			}
+			else
+			{
+				/* Nobody watches the pins */
+			}
+		}
+		else if(HW_REGS_MODEL_PORT_FAULT == HW_Port)
+		{
+			/* Fault counted by the port search */
+		}
+		else if((Address >= HW_PERIPH_BA) && (Address < (HW_PERIPH_BA + 0x100000)))
+		{
+			/* Peripheral the model doesn't hold */
+			HW_RegsModelFault(Address);
+		}
+		else
+		{
+			HW_EntryPtr = HW_RegsModelFindOther(Address);
+			HW_Value = (NULL_PTR != HW_EntryPtr) ? HW_EntryPtr->HW_Value : 0;
+		}
+	}
+	
+	return HW_Value;
+}
+
+/**
+ *	\brief		Writes a register.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+void HW_RegsModelWrite(HW_AddressBusSizeType Address, uint32 Value)
+{
+	/* Needed Variables */
+	HW_AddressBusSizeType HW_Offset = 0;
+	HW_RegsModelOtherType* HW_EntryPtr;
+	uint8 HW_Port;
+	
+	if((Address >= HW_PERIPH_BITBAND_BA) && (Address < (HW_PERIPH_BITBAND_BA + HW_REGS_MODEL_BITBAND_SIZE)))
+	{
+		/* The bus reads the aliased word, changes the bit and writes the word back */
+		HW_Offset = (Address - HW_PERIPH_BITBAND_BA) >> 2;
+		HW_RegsModelModify(HW_PERIPH_BA + ((HW_Offset >> 5) << 2), (uint32)1 << (HW_Offset & 0x1F),
+						   (uint32)(Value & 0x01) << (HW_Offset & 0x1F));
+	}
+	else if((Address & ~(HW_AddressBusSizeType)0xFFF) == HW_SYSTEM_CONTROL_BA)
+	{
+		HW_Offset = Address & 0xFFF;
+		if((HW_Offset < HW_REGS_MODEL_PR_FIRST) || (HW_Offset > HW_REGS_MODEL_PR_LAST))
+		{
+			HW_RegsModelSysCtl[HW_Offset >> 2] = Value;
+		}
+		else
+		{
+			/* Peripheral ready registers are read only */
+		}
+	}
+	else if((Address & ~(HW_AddressBusSizeType)0xFFF) == HW_UDMA_BA)
+	{
+		if(0 != (HW_RegsModelRead(HW_SYSTEM_CONTROL_BA + HW_PRDMA_OFFSET) & 0x01))
+		{
+			HW_UdmaModelWrite(Address & 0xFFF, Value);
+		}
+		else
+		{
+			HW_RegsModelFault(Address);
+		}
+	}
+	else
+	{
+		HW_Port = HW_RegsModelFindPort(Address, &HW_Offset);
+		if(HW_Port < HW_NO_OF_PORTS)
+		{
+			HW_RegsModelWritePort(&HW_RegsModelPorts[HW_Port], HW_Offset, Value);
+			if((HW_Offset < HW_GPIODIR_OFFSET) && (NULL_PTR != HW_RegsModelPinsHook))
+			{
+				HW_RegsModelPinsHook(HW_Port, TRUE);
+			}
+			else
+			{
+				/* Nobody watches the pins */
+			}
+		}
+		else if(HW_REGS_MODEL_PORT_FAULT == HW_Port)
+		{
+			/* Fault counted by the port search */
+		}
+		else if((Address >= HW_PERIPH_BA) && (Address < (HW_PERIPH_BA + 0x100000)))
+		{
+			/* Peripheral the model doesn't hold */
+			HW_RegsModelFault(Address);
+		}
+		else
+		{
+			HW_EntryPtr = HW_RegsModelFindOther(Address);
+			if(NULL_PTR != HW_EntryPtr)
+			{
+				HW_EntryPtr->HW_Value = Value;
+			}
+			else
+			{
+				HW_RegsModelFault(Address);
+			}
+		}
+	}
+}
+
+/**
+ *	\brief		Reads a register, clears then sets some of its bits and writes it back.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\param[in] 	ClearMask: 	Bits to be cleared.
+ *	\param[in] 	SetMask: 	Bits to be set.
+ *	\return		None.
+ */
+void HW_RegsModelModify(HW_AddressBusSizeType Address, uint32 ClearMask, uint32 SetMask)
+{
+	HW_RegsModelWrite(Address, (HW_RegsModelRead(Address) & ~ClearMask) | SetMask);
+}
+
+/**
+ *	\brief		Drives pins of a port from outside, the other pins are released.
+ *				A released input reads high if it has a pull-up and low otherwise.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Pins driven from outside.
+ *	\param[in] 	Levels: 	Levels of the driven pins.
+ *	\return		None.
+ */
+void HW_RegsModelDrivePins(uint8 PortId, uint8 Mask, uint8 Levels)
+{
+	if(PortId < HW_NO_OF_PORTS)
+	{
+		HW_RegsModelPorts[PortId].HW_Drive = Mask;
+		HW_RegsModelPorts[PortId].HW_DriveLevels = Levels;
+		HW_RegsModelUpdatePins(&HW_RegsModelPorts[PortId]);
+	}
+	else
+	{
+		/* No such port */
+	}
+}
+
+/**
+ *	\brief		Returns the levels of the pins of a port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		uint8: 		Levels of the pins.
+ */
+uint8 HW_RegsModelGetPins(uint8 PortId)
+{
+	return (PortId < HW_NO_OF_PORTS) ? HW_RegsModelPorts[PortId].HW_Pins : 0;
+}
+
+/**
+ *	\brief		Returns the number of faulty accesses since the reset.
+ *	\param[out] AddressPtr: 	Pointer to the address of the last fault, NULL_PTR if not needed.
+ *	\return		uint32: 		Number of faults.
+ */
+uint32 HW_RegsModelGetFaults(HW_AddressBusSizeType* AddressPtr)
+{
+	if(NULL_PTR != AddressPtr)
+	{
+		*AddressPtr = HW_RegsModelFaultAddress;
+	}
+	else
+	{
+		/* Address not needed */
+	}
+	
+	return HW_RegsModelFaults;
+}
+
+/**
+ *	\brief		Keeps GPIO ports not ready until the next reset: their PRGPIO bits read 0
+ *				and their accesses are faults, even with their clocks on.
+ *	\param[in] 	PortsMask: 	Ports kept not ready (PRGPIO bits).
+ *	\return		None.
+ */
+void HW_RegsModelHoldPorts(uint8 PortsMask)
+{
+	HW_RegsModelHeldPorts = PortsMask;
+}
+
+/**
+ *	\brief		Sets the hook called after every GPIODATA access of a port, once the pins are
+ *				updated, until the next reset. The hook may drive the pins.
+ *	\param[in] 	Hook: 	Hook, NULL_PTR for none.
+ *	\return		None.
+ */
+void HW_RegsModelSetPinsHook(HW_RegsModelPinsHookType Hook)
+{
+	HW_RegsModelPinsHook = Hook;
+}
+
+/**
+ *	\brief		Locks the interrupts of the model, backend of HW_ENTER_CRITICAL.
+ *				Threads of a host test stand for the task and the interrupts: a critical
+ *				section of a thread waits for the critical section of another thread to end.
+ *	\param		None.
+ *	\return		uint32: 	Interrupts mask of the thread before the call, 1 if locked.
+ */
+uint32 HW_RegsModelEnterCritical(void)
+{
+	/* Needed Variables */
+	uint32 HW_State = HW_RegsModelIntMasked;
+	
+	if(0 == HW_State)
+	{
+		while(__atomic_test_and_set(&HW_RegsModelIntLock, __ATOMIC_ACQUIRE))
+		{
+			/* Another thread is in a critical section, let it run to its end */
+			(void)sched_yield();
+		}
+		HW_RegsModelIntMasked = 1;
+	}
+	else
+	{
+		/* Nested critical section, the thread holds the lock */
+	}
+	
+	return HW_State;
+}
+
+/**
+ *	\brief		Restores the interrupts mask of the calling thread, backend of HW_EXIT_CRITICAL.
+ *	\param[in] 	State: 	Interrupts mask returned by the matching HW_RegsModelEnterCritical().
+ *	\return		None.
+ */
+void HW_RegsModelExitCritical(uint32 State)
+{
+	if(0 == State)
+	{
+		HW_RegsModelIntMasked = 0;
+		__atomic_clear(&HW_RegsModelIntLock, __ATOMIC_RELEASE);
+	}
+	else
+	{
+		/* Leaving a nested critical section, the interrupts stay locked */
+	}
+}
+#endif /* Host check */
@@ -0,0 +1,128 @@
+/**
+ *  \file	TivaRegsModel.h
+ *  \brief 	Host register model of the Tiva C, the backend of HW_W_8RIG / HW_R_8RIG /
+ *  		HW_S_BIT / HW_C_BIT when HW_REGS_BACKEND is HW_BACKEND_HOST (TivaHW.h).
+ *  		Every GPIO port (APB and AHB apertures) and the system control block have a
+ *  		register file modelling:
+ *  		-	GPIODATA address masking, pins levels from the direction, open-drain and
+ *  			pull settings and the levels driven from outside by the tests.
+ *  		-	GPIOLOCK / GPIOCR commit: GPIOCR is writable only while the port is unlocked
+ *  			and gates the writes to GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN.
+ *  		-	Edge and level interrupts in GPIORIS, GPIOMIS and write-1-to-clear GPIOICR.
+ *  		-	Clock gating: an access to a port or to the uDMA whose clock is off, or
+ *  			through the aperture not selected by GPIOHBCTL, is a fault and is dropped.
+ *  		The uDMA registers are served by TivaUdmaModel.c, the bit-band alias of the
+ *  		peripherals is resolved to the aliased bit and any other address (core
+ *  		registers) is a plain memory.
+ *  		The critical sections (HW_ENTER_CRITICAL) exclude each other across threads.
+ *  		A test can model a device on the pins with a hook called after every GPIODATA
+ *  		access, the device answers by driving the pins (HW_RegsModelDrivePins()).
+ *  		Not compiled for the target.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef TIVA_REGS_MODEL_H_
+#define TIVA_REGS_MODEL_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+
+#if !defined(__arm__)
+/* Defined data types */
+typedef void (*HW_RegsModelPinsHookType)(uint8 PortId, boolean Written);	/*!< Called after a GPIODATA access, Written is TRUE for a write */
+
+/* Functions Proto Types */
+/**
+ *	\brief		Resets every register of the model (and of the uDMA model) to its reset value,
+ *				releases the pins driven from outside, clears the faults and the pins hook.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_RegsModelReset(void);
+
+/**
+ *	\brief		Reads a register.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\return		uint32: 	Value of the register, 0 on a fault.
+ */
+uint32 HW_RegsModelRead(HW_AddressBusSizeType Address);
+
+/**
+ *	\brief		Writes a register.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+void HW_RegsModelWrite(HW_AddressBusSizeType Address, uint32 Value);
+
+/**
+ *	\brief		Reads a register, clears then sets some of its bits and writes it back.
+ *	\param[in] 	Address: 	Address of the register.
+ *	\param[in] 	ClearMask: 	Bits to be cleared.
+ *	\param[in] 	SetMask: 	Bits to be set.
+ *	\return		None.
+ */
+void HW_RegsModelModify(HW_AddressBusSizeType Address, uint32 ClearMask, uint32 SetMask);
+
+/**
+ *	\brief		Drives pins of a port from outside, the other pins are released.
+ *				A released input reads high if it has a pull-up and low otherwise.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\param[in] 	Mask: 		Pins driven from outside.
+ *	\param[in] 	Levels: 	Levels of the driven pins.
+ *	\return		None.
+ */
+void HW_RegsModelDrivePins(uint8 PortId, uint8 Mask, uint8 Levels);
+
+/**
+ *	\brief		Returns the levels of the pins of a port.
+ *	\param[in] 	PortId: 	ID of the port.
+ *	\return		uint8: 		Levels of the pins.
+ */
+uint8 HW_RegsModelGetPins(uint8 PortId);
+
+/**
+ *	\brief		Returns the number of faulty accesses since the reset.
+ *	\param[out] AddressPtr: 	Pointer to the address of the last fault, NULL_PTR if not needed.
+ *	\return		uint32: 		Number of faults.
+ */
+uint32 HW_RegsModelGetFaults(HW_AddressBusSizeType* AddressPtr);
+
+/**
+ *	\brief		Keeps GPIO ports not ready until the next reset: their PRGPIO bits read 0
+ *				and their accesses are faults, even with their clocks on.
+ *	\param[in] 	PortsMask: 	Ports kept not ready (PRGPIO bits).
+ *	\return		None.
+ */
+void HW_RegsModelHoldPorts(uint8 PortsMask);
+
+/**
+ *	\brief		Sets the hook called after every GPIODATA access of a port, once the pins are
+ *				updated, until the next reset. The hook may drive the pins.
+ *	\param[in] 	Hook: 	Hook, NULL_PTR for none.
+ *	\return		None.
+ */
+void HW_RegsModelSetPinsHook(HW_RegsModelPinsHookType Hook);
+
+/**
+ *	\brief		Locks the interrupts of the model, backend of HW_ENTER_CRITICAL.
+ *				Threads of a host test stand for the task and the interrupts: a critical
+ *				section of a thread waits for the critical section of another thread to end.
+ *	\param		None.
+ *	\return		uint32: 	Interrupts mask of the thread before the call, 1 if locked.
+ */
+uint32 HW_RegsModelEnterCritical(void);
+
+/**
+ *	\brief		Restores the interrupts mask of the calling thread, backend of HW_EXIT_CRITICAL.
+ *	\param[in] 	State: 	Interrupts mask returned by the matching HW_RegsModelEnterCritical().
+ *	\return		None.
+ */
+void HW_RegsModelExitCritical(uint32 State);
+#endif /* Host check */
+
+#endif /* TIVA_REGS_MODEL_H_ */
@@ -0,0 +1,308 @@
+/**
+ *  \file	TivaUdmaModel.c
+ *  \brief 	Host model of the Tiva C uDMA controller.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Inclusion */
+#include "TivaUdmaModel.h"
+
+#if !defined(__arm__)
+/* Macros */
+/* Fields of the control word */
+#define HW_UDMA_MODEL_DSTINC(CHCTL)		(uint8)(((CHCTL) >> 30) & 0x03)
+#define HW_UDMA_MODEL_DSTSIZE(CHCTL)	(uint8)(((CHCTL) >> 28) & 0x03)
+#define HW_UDMA_MODEL_SRCINC(CHCTL)		(uint8)(((CHCTL) >> 26) & 0x03)
+#define HW_UDMA_MODEL_ARBSIZE(CHCTL)	(uint8)(((CHCTL) >> 14) & 0x0F)
+#define HW_UDMA_MODEL_XFERSIZE(CHCTL)	(uint16)(((CHCTL) >> HW_UDMA_XFERSIZE_SHIFT) & 0x3FF)
+#define HW_UDMA_MODEL_INC_NONE			0x03	/*!< Increment field value of a fixed address */
+
+/* Check that an address is in the peripherals region */
+#define HW_UDMA_MODEL_IS_PERIPH(ADDRESS)	\
+	(((ADDRESS) >= HW_PERIPH_BA) && ((ADDRESS) < (HW_PERIPH_BA + 0x100000)))
+
+/* Defined data types */
+typedef struct{
+	uint32	HW_Cfg;			/*!< DMACFG */
+	uint32	HW_CtlBase;		/*!< DMACTLBASE */
+	uint32	HW_UseBurst;	/*!< DMAUSEBURSTSET / DMAUSEBURSTCLR */
+	uint32	HW_ReqMask;		/*!< DMAREQMASKSET / DMAREQMASKCLR */
+	uint32	HW_Ena;			/*!< DMAENASET / DMAENACLR */
+	uint32	HW_Alt;			/*!< DMAALTSET / DMAALTCLR */
+	uint32	HW_Prio;		/*!< DMAPRIOSET / DMAPRIOCLR */
+	uint32	HW_ChAsgn;		/*!< DMACHASGN */
+	uint32	HW_ChIs;		/*!< DMACHIS */
+	uint32	HW_ChMap[4];	/*!< DMACHMAP0 to DMACHMAP3 */
+}HW_UdmaModelRegsType;	/*!< Registers of the model */
+
+/* Private Variables */
+static HW_UdmaModelRegsType HW_UdmaModelRegs;	/*!< Registers of the model */
+static uint32 HW_UdmaModelItems;				/*!< Items moved since the reset */
+
+/* Private Functions Proto Types */
+/**
+ *	\brief		Moves an item.
+ *	\param[in] 	Source: 		Source address.
+ *	\param[in] 	Destination: 	Destination address.
+ *	\param[in] 	Size: 			Size field of the item (0: 8 bits, 1: 16 bits, 2: 32 bits).
+ *	\return		None.
+ */
+static void HW_UdmaModelMove(uint32 Source, uint32 Destination, uint8 Size);
+
+/* Private Functions Declaration */
+/**
+ *	\brief		Moves an item.
+ *	\param[in] 	Source: 		Source address.
+ *	\param[in] 	Destination: 	Destination address.
+ *	\param[in] 	Size: 			Size field of the item (0: 8 bits, 1: 16 bits, 2: 32 bits).
+ *	\return		None.
+ */
+static void HW_UdmaModelMove(uint32 Source, uint32 Destination, uint8 Size)
+{
+	/* Needed Variables */
+	uint32 HW_Item;
+	
+	if(HW_UDMA_MODEL_IS_PERIPH(Source))
+	{
+		HW_Item = (uint32)HW_R_8RIG(Source);
+	}
+	else if(0 == Size)
+	{
+		HW_Item = *(const volatile uint8*)Source;
+	}
+	else if(1 == Size)
+	{
+		HW_Item = *(const volatile uint16*)Source;
+	}
+	else
+	{
+		/* uint32 is wider than 32 bits on the host */
+		HW_Item = *(const volatile unsigned int*)Source;
+	}
+	
+	if(HW_UDMA_MODEL_IS_PERIPH(Destination))
+	{
+		HW_W_8RIG(Destination, HW_Item);
+	}
+	else if(0 == Size)
+	{
+		*(volatile uint8*)Destination = (uint8)HW_Item;
+	}
+	else if(1 == Size)
+	{
+		*(volatile uint16*)Destination = (uint16)HW_Item;
+	}
+	else
+	{
+		*(volatile unsigned int*)Destination = (unsigned int)HW_Item;
+	}
+}
+
+/* Public Functions Declaration */
+/**
+ *	\brief		Resets the registers of the model and its count of moved items.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_UdmaModelReset(void)
+{
+	/* Needed Variables */
+	uint8 HW_Index;
+	
+	HW_UdmaModelRegs.HW_Cfg = 0;
+	HW_UdmaModelRegs.HW_CtlBase = 0;
+	HW_UdmaModelRegs.HW_UseBurst = 0;
+	HW_UdmaModelRegs.HW_ReqMask = 0;
+	HW_UdmaModelRegs.HW_Ena = 0;
+	HW_UdmaModelRegs.HW_Alt = 0;
+	HW_UdmaModelRegs.HW_Prio = 0;
+	HW_UdmaModelRegs.HW_ChAsgn = 0;
+	HW_UdmaModelRegs.HW_ChIs = 0;
+	for(HW_Index = 0; HW_Index < 4; HW_Index++)
+	{
+		HW_UdmaModelRegs.HW_ChMap[HW_Index] = 0;
+	}
+	HW_UdmaModelItems = 0;
+}
+
+/**
+ *	\brief		Reads a uDMA register.
+ *	\param[in] 	Offset: 	Offset of the register from HW_UDMA_BA.
+ *	\return		uint32: 	Value of the register.
+ */
+uint32 HW_UdmaModelRead(HW_AddressBusSizeType Offset)
+{
+	/* Needed Variables */
+	uint32 HW_Value = 0;
+	
+	switch(Offset)
+	{
+		case HW_DMASTAT_OFFSET:			HW_Value = HW_UdmaModelRegs.HW_Cfg & 0x01;			break;
+		case HW_DMACTLBASE_OFFSET:		HW_Value = HW_UdmaModelRegs.HW_CtlBase;				break;
+		case HW_DMAALTBASE_OFFSET:		HW_Value = HW_UdmaModelRegs.HW_CtlBase + (HW_UDMA_ALT_WORDS * sizeof(uint32));	break;
+		case HW_DMAUSEBURSTSET_OFFSET:	HW_Value = HW_UdmaModelRegs.HW_UseBurst;			break;
+		case HW_DMAREQMASKSET_OFFSET:	HW_Value = HW_UdmaModelRegs.HW_ReqMask;				break;
+		case HW_DMAENASET_OFFSET:		HW_Value = HW_UdmaModelRegs.HW_Ena;					break;
+		case HW_DMAALTSET_OFFSET:		HW_Value = HW_UdmaModelRegs.HW_Alt;					break;
+		case HW_DMAPRIOSET_OFFSET:		HW_Value = HW_UdmaModelRegs.HW_Prio;				break;
+		case HW_DMACHASGN_OFFSET:		HW_Value = HW_UdmaModelRegs.HW_ChAsgn;				break;
+		case HW_DMACHIS_OFFSET:			HW_Value = HW_UdmaModelRegs.HW_ChIs;				break;
+		default:
+			if((Offset >= HW_DMACHMAP0_OFFSET) && (Offset < (HW_DMACHMAP0_OFFSET + 0x10)))
+			{
+				HW_Value = HW_UdmaModelRegs.HW_ChMap[(Offset - HW_DMACHMAP0_OFFSET) >> 2];
+			}
+			else
+			{
+				/* Write only or reserved register, reads 0 */
+			}
+			break;
+	}
+	
+	return HW_Value;
+}
+
+/**
+ *	\brief		Writes a uDMA register.
+ *	\param[in] 	Offset: 	Offset of the register from HW_UDMA_BA.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+void HW_UdmaModelWrite(HW_AddressBusSizeType Offset, uint32 Value)
+{
+	switch(Offset)
+	{
+		case HW_DMACFG_OFFSET:			HW_UdmaModelRegs.HW_Cfg = Value & 0x01;				break;
+		case HW_DMACTLBASE_OFFSET:		HW_UdmaModelRegs.HW_CtlBase = Value & ~(uint32)0x3FF;	break;
+		case HW_DMAUSEBURSTSET_OFFSET:	HW_UdmaModelRegs.HW_UseBurst |= Value;				break;
+		case HW_DMAUSEBURSTCLR_OFFSET:	HW_UdmaModelRegs.HW_UseBurst &= ~Value;				break;
+		case HW_DMAREQMASKSET_OFFSET:	HW_UdmaModelRegs.HW_ReqMask |= Value;				break;
+		case HW_DMAREQMASKCLR_OFFSET:	HW_UdmaModelRegs.HW_ReqMask &= ~Value;				break;
+		case HW_DMAENASET_OFFSET:		HW_UdmaModelRegs.HW_Ena |= Value;					break;
+		case HW_DMAENACLR_OFFSET:		HW_UdmaModelRegs.HW_Ena &= ~Value;					break;
+		case HW_DMAALTSET_OFFSET:		HW_UdmaModelRegs.HW_Alt |= Value;					break;
+		case HW_DMAALTCLR_OFFSET:		HW_UdmaModelRegs.HW_Alt &= ~Value;					break;
+		case HW_DMAPRIOSET_OFFSET:		HW_UdmaModelRegs.HW_Prio |= Value;					break;
+		case HW_DMAPRIOCLR_OFFSET:		HW_UdmaModelRegs.HW_Prio &= ~Value;					break;
+		case HW_DMACHASGN_OFFSET:		HW_UdmaModelRegs.HW_ChAsgn = Value;					break;
+		case HW_DMACHIS_OFFSET:			HW_UdmaModelRegs.HW_ChIs &= ~Value;					break;
+		default:
+			if((Offset >= HW_DMACHMAP0_OFFSET) && (Offset < (HW_DMACHMAP0_OFFSET + 0x10)))
+			{
+				HW_UdmaModelRegs.HW_ChMap[(Offset - HW_DMACHMAP0_OFFSET) >> 2] = Value;
+			}
+			else
+			{
+				/* Read only or reserved register */
+			}
+			break;
+	}
+}
+
+/**
+ *	\brief		Raises a single request of the peripheral mapped to a channel.
+ *				Moves up to the arbitration size items of the active structure, completes it
+ *				(stop mode, completion status) when its last item is moved and switches to
+ *				the other structure in ping-pong mode.
+ *	\param[in] 	Channel: 	uDMA channel.
+ *	\return		uint16: 	Number of moved items, 0 if the channel isn't enabled.
+ */
+uint16 HW_UdmaModelRequest(uint8 Channel)
+{
+	/* Needed Variables */
+	uint32 HW_Bit = (uint32)1 << Channel;
+	volatile uint32* HW_TablePtr = (volatile uint32*)HW_UdmaModelRegs.HW_CtlBase;
+	volatile uint32* HW_StructurePtr;
+	uint32 HW_Control;
+	uint32 HW_Mode;
+	uint16 HW_Left;
+	uint16 HW_Arbitration;
+	uint16 HW_Moved = 0;
+	uint8 HW_SrcStep;
+	uint8 HW_DstStep;
+	uint32 HW_Source;
+	uint32 HW_Destination;
+	
+	if((0 != HW_UdmaModelRegs.HW_Cfg) && (0 != (HW_UdmaModelRegs.HW_Ena & HW_Bit)) &&
+	   (0 == (HW_UdmaModelRegs.HW_ReqMask & HW_Bit)))
+	{
+		HW_StructurePtr = &HW_TablePtr[((0 != (HW_UdmaModelRegs.HW_Alt & HW_Bit)) ? HW_UDMA_ALT_WORDS : 0) +
+									   ((uint32)Channel << 2)];
+		HW_Control = HW_StructurePtr[HW_UDMA_CHCTL];
+		HW_Mode = HW_Control & HW_UDMA_XFERMODE_MASK;
+	
+		if(HW_UDMA_XFERMODE_STOP == HW_Mode)
+		{
+			/* Invalid structure, the channel ends */
+			HW_UdmaModelRegs.HW_Ena &= ~HW_Bit;
+		}
+		else
+		{
+			HW_Left = (uint16)(HW_UDMA_MODEL_XFERSIZE(HW_Control) + 1);
+			HW_Arbitration = (uint16)(1 << HW_UDMA_MODEL_ARBSIZE(HW_Control));
+			HW_SrcStep = (HW_UDMA_MODEL_INC_NONE == HW_UDMA_MODEL_SRCINC(HW_Control)) ?
+						 0 : (uint8)(1 << HW_UDMA_MODEL_SRCINC(HW_Control));
+			HW_DstStep = (HW_UDMA_MODEL_INC_NONE == HW_UDMA_MODEL_DSTINC(HW_Control)) ?
+						 0 : (uint8)(1 << HW_UDMA_MODEL_DSTINC(HW_Control));
+	
+			/* The end pointers are fixed, the next item is found from the items left */
+			while((HW_Moved < HW_Arbitration) && (0 != HW_Left))
+			{
+				HW_Source = HW_StructurePtr[HW_UDMA_SRCENDP] - ((uint32)(HW_Left - 1) * HW_SrcStep);
+				HW_Destination = HW_StructurePtr[HW_UDMA_DSTENDP] - ((uint32)(HW_Left - 1) * HW_DstStep);
+				HW_UdmaModelMove(HW_Source, HW_Destination, HW_UDMA_MODEL_DSTSIZE(HW_Control));
+				HW_Left--;
+				HW_Moved++;
+			}
+			HW_UdmaModelItems += HW_Moved;
+	
+			if(0 != HW_Left)
+			{
+				HW_StructurePtr[HW_UDMA_CHCTL] = (HW_Control & ~((uint32)0x3FF << HW_UDMA_XFERSIZE_SHIFT)) |
+												 ((uint32)(HW_Left - 1) << HW_UDMA_XFERSIZE_SHIFT);
+			}
+			else
+			{
+				/* Structure done, its mode goes back to stop */
+				HW_StructurePtr[HW_UDMA_CHCTL] = HW_Control & ~(HW_UDMA_XFERMODE_MASK | ((uint32)0x3FF << HW_UDMA_XFERSIZE_SHIFT));
+				HW_UdmaModelRegs.HW_ChIs |= HW_Bit;
+				if(HW_UDMA_XFERMODE_PINGPONG == HW_Mode)
+				{
+					HW_UdmaModelRegs.HW_Alt ^= HW_Bit;
+					HW_StructurePtr = &HW_TablePtr[((0 != (HW_UdmaModelRegs.HW_Alt & HW_Bit)) ? HW_UDMA_ALT_WORDS : 0) +
+												   ((uint32)Channel << 2)];
+					if(HW_UDMA_XFERMODE_STOP == (HW_StructurePtr[HW_UDMA_CHCTL] & HW_UDMA_XFERMODE_MASK))
+					{
+						HW_UdmaModelRegs.HW_Ena &= ~HW_Bit;
+					}
+					else
+					{
+						/* The other structure follows */
+					}
+				}
+				else
+				{
+					HW_UdmaModelRegs.HW_Ena &= ~HW_Bit;
+				}
+			}
+		}
+	}
+	else
+	{
+		/* Request ignored */
+	}
+	
+	return HW_Moved;
+}
+
+/**
+ *	\brief		Returns the number of items moved since the reset.
+ *	\param		None.
+ *	\return		uint32: 	Number of moved items.
+ */
+uint32 HW_UdmaModelGetItems(void)
+{
+	return HW_UdmaModelItems;
+}
+#endif /* Host check */
@@ -0,0 +1,66 @@
+/**
+ *  \file	TivaUdmaModel.h
+ *  \brief 	Host model of the Tiva C uDMA controller, to run the uDMA users off target.
+ *  		The host register backend forwards the accesses to the uDMA registers to
+ *  		HW_UdmaModelRead() / HW_UdmaModelWrite() and the tests raise the peripheral
+ *  		requests with HW_UdmaModelRequest(). The model walks the channel control
+ *  		table like the controller does: basic and ping-pong modes, 8/16/32 bits items,
+ *  		source and destination increments and arbitration size. Items moved to the
+ *  		peripherals region are written through HW_W_8RIG.
+ *  		Not compiled for the target.
+ *  \author	Ahmed Wageh.
+ *  \date	16/10/2026
+ */
+
+/* Header guard */
+#ifndef TIVA_UDMA_MODEL_H_
+#define TIVA_UDMA_MODEL_H_
+
+/* Inclusion */
+#include "Std_Types.h"		/* Contains useful data types */
+#include "PlatformTypes.h"	/* Contains standard data types */
+#include "TivaHW.h"			/* Contains addresses and HW data for Tiva C */
+
+#if !defined(__arm__)
+/* Functions Proto Types */
+/**
+ *	\brief		Resets the registers of the model and its count of moved items.
+ *	\param		None.
+ *	\return		None.
+ */
+void HW_UdmaModelReset(void);
+
+/**
+ *	\brief		Reads a uDMA register.
+ *	\param[in] 	Offset: 	Offset of the register from HW_UDMA_BA.
+ *	\return		uint32: 	Value of the register.
+ */
+uint32 HW_UdmaModelRead(HW_AddressBusSizeType Offset);
+
+/**
+ *	\brief		Writes a uDMA register.
+ *	\param[in] 	Offset: 	Offset of the register from HW_UDMA_BA.
+ *	\param[in] 	Value: 		Value to be written.
+ *	\return		None.
+ */
+void HW_UdmaModelWrite(HW_AddressBusSizeType Offset, uint32 Value);
+
+/**
+ *	\brief		Raises a single request of the peripheral mapped to a channel.
+ *				Moves up to the arbitration size items of the active structure, completes it
+ *				(stop mode, completion status) when its last item is moved and switches to
+ *				the other structure in ping-pong mode.
+ *	\param[in] 	Channel: 	uDMA channel.
+ *	\return		uint16: 	Number of moved items, 0 if the channel isn't enabled.
+ */
+uint16 HW_UdmaModelRequest(uint8 Channel);
+
+/**
+ *	\brief		Returns the number of items moved since the reset.
+ *	\param		None.
+ *	\return		uint32: 	Number of moved items.
+ */
+uint32 HW_UdmaModelGetItems(void);
+#endif /* Host check */
+
+#endif /* TIVA_UDMA_MODEL_H_ */